@@ -9,7 +9,6 @@
  */
 
 #include "autocompleteservice.h"
-#include <QThread>
 #include "autocompleteworker.h"
 #include "completionquery.h"
 #include "../Common/flags.h"
@@ -50,16 +49,9 @@ namespace AutoComplete {
         Helpers::AsyncCoordinatorLocker locker(coordinator);
         Q_UNUSED(locker);
 
-        m_AutoCompleteWorker = new AutoCompleteWorker(coordinator, m_AutoCompleteModel, m_PresetsManager);
-
-        QThread *thread = new QThread();
-        m_AutoCompleteWorker->moveToThread(thread);
-
-        QObject::connect(thread, &QThread::started, m_AutoCompleteWorker, &AutoCompleteWorker::process);
-        QObject::connect(m_AutoCompleteWorker, &AutoCompleteWorker::stopped, thread, &QThread::quit);
+        m_AutoCompleteWorker = new AutoCompleteWorker(coordinator, m_AutoCompleteModel, m_PresetsManager, &m_KeywordsFrequencies);
 
         QObject::connect(m_AutoCompleteWorker, &AutoCompleteWorker::stopped, m_AutoCompleteWorker, &AutoCompleteWorker::deleteLater);
-        QObject::connect(thread, &QThread::finished, thread, &QThread::deleteLater);
 
         QObject::connect(this, &AutoCompleteService::cancelAutoCompletion,
                          m_AutoCompleteWorker, &AutoCompleteWorker::cancel);
@@ -70,8 +62,8 @@ namespace AutoComplete {
         QObject::connect(m_AutoCompleteWorker, &AutoCompleteWorker::destroyed,
                          this, &AutoCompleteService::workerDestroyed);
 
-        LOG_DEBUG << "starting thread...";
-        thread->start();
+        LOG_DEBUG << "starting worker...";
+        m_AutoCompleteWorker->doWorkOnExecutor(Common::TaskPriority::Interactive);
 
         emit serviceAvailable(m_RestartRequired);
     }
@@ -113,6 +105,16 @@ namespace AutoComplete {
         stopService();
     }
 
+    void AutoCompleteService::warmup() {
+        LOG_DEBUG << "#";
+        if (m_AutoCompleteWorker == NULL) {
+            LOG_WARNING << "Worker is NULL";
+            return;
+        }
+
+        m_AutoCompleteWorker->submitWarmup();
+    }
+
     void AutoCompleteService::generateCompletions(const QString &prefix, Common::BasicKeywordsModel *basicModel) {
         if (m_AutoCompleteWorker == NULL) {
             LOG_WARNING << "Worker is NULL";
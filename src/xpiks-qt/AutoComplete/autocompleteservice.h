@@ -14,6 +14,7 @@
 #include <QObject>
 #include <QString>
 #include "../Common/iservicebase.h"
+#include "keywordsfrequencytrie.h"
 
 namespace Common {
     class BasicKeywordsModel;
@@ -56,7 +57,9 @@ namespace AutoComplete {
 
     public:
         void restartWorker();
+        void warmup();
         void generateCompletions(const QString &prefix, Common::BasicKeywordsModel *basicModel);
+        KeywordsFrequencyTrie *getKeywordsFrequencies() { return &m_KeywordsFrequencies; }
 
     private slots:
         void workerFinished();
@@ -72,6 +75,8 @@ namespace AutoComplete {
 #endif
 
     private:
+        // outlives worker restarts, filled by the metadata cache
+        KeywordsFrequencyTrie m_KeywordsFrequencies;
         AutoCompleteWorker *m_AutoCompleteWorker;
         KeywordsAutoCompleteModel *m_AutoCompleteModel;
         KeywordsPresets::PresetKeywordsModel *m_PresetsManager;
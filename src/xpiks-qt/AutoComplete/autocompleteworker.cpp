@@ -13,20 +13,27 @@
 #include "../Common/defines.h"
 #include <QStringList>
 #include "../Helpers/asynccoordinator.h"
+#include "../Helpers/startuptimeline.h"
 #include "../KeywordsPresets/presetkeywordsmodel.h"
 #include "keywordsautocompletemodel.h"
 #include "../Common/basickeywordsmodel.h"
 
+#define MAX_KEYWORD_COMPLETIONS 8
+
 namespace AutoComplete {
     AutoCompleteWorker::AutoCompleteWorker(Helpers::AsyncCoordinator *initCoordinator,
                                            KeywordsAutoCompleteModel *autoCompleteModel,
                                            KeywordsPresets::PresetKeywordsModel *presetsManager,
+                                           KeywordsFrequencyTrie *keywordsFrequencies,
                                            QObject *parent) :
         QObject(parent),
         m_PresetsCompletionEngine(presetsManager),
+        m_KeywordsCompletionEngine(keywordsFrequencies),
         m_InitCoordinator(initCoordinator),
         m_AutoCompleteModel(autoCompleteModel),
-        m_PresetsManager(presetsManager)
+        m_PresetsManager(presetsManager),
+        m_EnginesInitAttempted(false),
+        m_EnginesInitialized(false)
     {
         Q_ASSERT(presetsManager != nullptr);
         Q_ASSERT(autoCompleteModel != nullptr);
@@ -35,6 +42,7 @@ namespace AutoComplete {
     AutoCompleteWorker::~AutoCompleteWorker() {
         m_FaceCompletionEngine.finalize();
         m_PresetsCompletionEngine.finalize();
+        m_KeywordsCompletionEngine.finalize();
         LOG_INFO << "destroyed";
     }
 
@@ -44,6 +52,22 @@ namespace AutoComplete {
         Helpers::AsyncCoordinatorUnlocker unlocker(m_InitCoordinator);
         Q_UNUSED(unlocker);
 
+        // completion sources are loaded on first use or on idle
+        return true;
+    }
+
+    void AutoCompleteWorker::warmupWorker() {
+        LOG_DEBUG << "#";
+        ensureEnginesInitialized();
+    }
+
+    bool AutoCompleteWorker::ensureEnginesInitialized() {
+        if (m_EnginesInitAttempted) { return m_EnginesInitialized; }
+        m_EnginesInitAttempted = true;
+
+        Helpers::StartupStageTimer stageTimer("Autocomplete sources");
+        Q_UNUSED(stageTimer);
+
         bool success = false;
 
         do {
@@ -55,13 +79,23 @@ namespace AutoComplete {
                 break;
             }
 
+            if (!m_KeywordsCompletionEngine.initialize()) {
+                break;
+            }
+
             success = true;
         } while(false);
 
+        m_EnginesInitialized = success;
         return success;
     }
 
     void AutoCompleteWorker::processOneItem(std::shared_ptr<CompletionQuery> &item) {
+        if (!ensureEnginesInitialized()) {
+            LOG_WARNING << "Completion engines are not available";
+            return;
+        }
+
         if (!item->getNeedsUpdate()) {
             generateCompletions(item);
         } else {
@@ -96,7 +130,12 @@ namespace AutoComplete {
                 completionsModel.setPresetCompletions(completionsList);
             }
         } else {
-            if (m_FaceCompletionEngine.generateCompletions(*item.get(), completionsList)) {
+            std::vector<CompletionResult> keywordsCompletions, wordlistCompletions;
+            m_KeywordsCompletionEngine.generateCompletions(*item.get(), keywordsCompletions);
+            m_FaceCompletionEngine.generateCompletions(*item.get(), wordlistCompletions);
+            mergeCompletions(keywordsCompletions, wordlistCompletions, MAX_KEYWORD_COMPLETIONS, completionsList);
+
+            if (!completionsList.empty()) {
                 generatedCount = completionsList.size();
                 auto &completionsModel = m_AutoCompleteModel->getInnerModel();
                 completionsModel.setKeywordCompletions(completionsList);
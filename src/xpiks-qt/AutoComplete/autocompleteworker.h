@@ -16,6 +16,7 @@
 #include "completionquery.h"
 #include "libfacecompletionengine.h"
 #include "presetscompletionengine.h"
+#include "keywordscompletionengine.h"
 
 namespace Helpers {
     class AsyncCoordinator;
@@ -37,14 +38,18 @@ namespace AutoComplete {
         explicit AutoCompleteWorker(Helpers::AsyncCoordinator *initCoordinator,
                                     KeywordsAutoCompleteModel *autoCompleteModel,
                                     KeywordsPresets::PresetKeywordsModel *presetsManager,
+                                    KeywordsFrequencyTrie *keywordsFrequencies,
                                     QObject *parent = 0);
         virtual ~AutoCompleteWorker();
 
     protected:
         virtual bool initWorker() override;
+        virtual const char *getWorkerName() const override { return "AutoCompleteWorker"; }
+        virtual void warmupWorker() override;
         virtual void processOneItem(std::shared_ptr<CompletionQuery> &item) override;
 
     private:
+        bool ensureEnginesInitialized();
         void generateCompletions(std::shared_ptr<CompletionQuery> &item);
         void updateCompletions(std::shared_ptr<CompletionQuery> &item);
 
@@ -63,9 +68,12 @@ namespace AutoComplete {
     private:
         LibFaceCompletionEngine m_FaceCompletionEngine;
         PresetsCompletionEngine m_PresetsCompletionEngine;
+        KeywordsCompletionEngine m_KeywordsCompletionEngine;
         Helpers::AsyncCoordinator *m_InitCoordinator;
         KeywordsAutoCompleteModel *m_AutoCompleteModel;
         KeywordsPresets::PresetKeywordsModel *m_PresetsManager;
+        bool m_EnginesInitAttempted;
+        bool m_EnginesInitialized;
     };
 }
 
@@ -23,18 +23,22 @@ namespace AutoComplete {
     struct CompletionResult {
         CompletionResult(const QString &completion):
             m_Completion(completion),
-            m_PresetID(-1)
+            m_PresetID(-1),
+            m_Score(0)
         {
         }
 
         CompletionResult(const QString &completion, int presetID):
             m_Completion(completion),
-            m_PresetID(presetID)
+            m_PresetID(presetID),
+            m_Score(0)
         {
         }
 
         QString m_Completion;
         int m_PresetID;
+        // frequency in the source of the completion, comparable only within one engine
+        int m_Score;
     };
 
     class CompletionQuery {
@@ -0,0 +1,86 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "keywordscompletionengine.h"
+#include <QSet>
+#include <algorithm>
+#include "keywordsfrequencytrie.h"
+#include "../Common/defines.h"
+
+#define GENERATE_COMPLETIONS_COUNT 8
+
+namespace AutoComplete {
+    KeywordsCompletionEngine::KeywordsCompletionEngine(KeywordsFrequencyTrie *keywordsFrequencies):
+        m_KeywordsFrequencies(keywordsFrequencies)
+    {
+        Q_ASSERT(keywordsFrequencies != nullptr);
+    }
+
+    bool KeywordsCompletionEngine::initialize() {
+        LOG_DEBUG << "#";
+        // frequencies are loaded and updated by the metadata cache
+        return true;
+    }
+
+    void KeywordsCompletionEngine::finalize() {
+        LOG_DEBUG << "#";
+    }
+
+    bool KeywordsCompletionEngine::generateCompletions(const CompletionQuery &query, std::vector<CompletionResult> &completions) {
+        const int count = m_KeywordsFrequencies->prompt(query.getPrefix(), GENERATE_COMPLETIONS_COUNT, completions);
+        return count > 0;
+    }
+
+    struct ScoredCompletion {
+        const CompletionResult *m_Completion;
+        double m_RelativeScore;
+        bool m_IsKeyword;
+    };
+
+    void appendScored(const std::vector<CompletionResult> &completions, bool isKeyword, std::vector<ScoredCompletion> &scored) {
+        int maxScore = 0;
+        for (auto &completion: completions) {
+            maxScore = std::max(maxScore, completion.m_Score);
+        }
+
+        for (auto &completion: completions) {
+            const double relativeScore = (maxScore > 0) ? (double)completion.m_Score / maxScore : 0.0;
+            scored.push_back({&completion, relativeScore, isKeyword});
+        }
+    }
+
+    void mergeCompletions(const std::vector<CompletionResult> &keywordsCompletions,
+                          const std::vector<CompletionResult> &wordlistCompletions,
+                          size_t maxCount,
+                          std::vector<CompletionResult> &merged) {
+        std::vector<ScoredCompletion> scored;
+        scored.reserve(keywordsCompletions.size() + wordlistCompletions.size());
+        appendScored(keywordsCompletions, true, scored);
+        appendScored(wordlistCompletions, false, scored);
+
+        std::stable_sort(scored.begin(), scored.end(), [](const ScoredCompletion &left, const ScoredCompletion &right) {
+            if (left.m_RelativeScore != right.m_RelativeScore) { return left.m_RelativeScore > right.m_RelativeScore; }
+            return left.m_IsKeyword && !right.m_IsKeyword;
+        });
+
+        QSet<QString> added;
+        merged.reserve(merged.size() + std::min(maxCount, scored.size()));
+
+        for (auto &item: scored) {
+            if ((size_t)added.size() >= maxCount) { break; }
+
+            const QString &completion = item.m_Completion->m_Completion;
+            if (added.contains(completion)) { continue; }
+
+            added.insert(completion);
+            merged.push_back(*item.m_Completion);
+        }
+    }
+}
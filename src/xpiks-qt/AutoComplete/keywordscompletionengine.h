@@ -0,0 +1,42 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef KEYWORDSCOMPLETIONENGINE_H
+#define KEYWORDSCOMPLETIONENGINE_H
+
+#include "completionenginebase.h"
+
+namespace AutoComplete {
+    class KeywordsFrequencyTrie;
+
+    // completes keywords the user already used in the library and in the current session
+    class KeywordsCompletionEngine: public CompletionEngineBase
+    {
+    public:
+        KeywordsCompletionEngine(KeywordsFrequencyTrie *keywordsFrequencies);
+
+        // CompletionEngineBase interface
+    public:
+        virtual bool initialize() override;
+        virtual void finalize() override;
+        virtual bool generateCompletions(const CompletionQuery &query, std::vector<CompletionResult> &completions) override;
+
+    private:
+        KeywordsFrequencyTrie *m_KeywordsFrequencies;
+    };
+
+    // scores of every source are relative to its best completion, user keywords win ties
+    void mergeCompletions(const std::vector<CompletionResult> &keywordsCompletions,
+                          const std::vector<CompletionResult> &wordlistCompletions,
+                          size_t maxCount,
+                          std::vector<CompletionResult> &merged);
+}
+
+#endif // KEYWORDSCOMPLETIONENGINE_H
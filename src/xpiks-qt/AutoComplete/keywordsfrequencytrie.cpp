@@ -0,0 +1,235 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "keywordsfrequencytrie.h"
+#include <QSet>
+#include <queue>
+#include <algorithm>
+#include "../Common/defines.h"
+
+#define ROOT_NODE_INDEX 0
+#define INVALID_NODE_INDEX 0xFFFFFFFF
+
+namespace AutoComplete {
+    KeywordsFrequencyTrie::TrieNode::TrieNode(quint32 parent, QChar c):
+        m_Parent(parent),
+        m_FirstChild(INVALID_NODE_INDEX),
+        m_NextSibling(INVALID_NODE_INDEX),
+        m_Count(0),
+        m_MaxCount(0),
+        m_Char(c)
+    {
+    }
+
+    KeywordsFrequencyTrie::KeywordsFrequencyTrie():
+        m_KeywordsCount(0)
+    {
+        m_Nodes.emplace_back(INVALID_NODE_INDEX, QChar());
+    }
+
+    void KeywordsFrequencyTrie::clear() {
+        QWriteLocker locker(&m_Lock);
+        Q_UNUSED(locker);
+
+        m_Nodes.clear();
+        m_Nodes.shrink_to_fit();
+        m_Nodes.emplace_back(INVALID_NODE_INDEX, QChar());
+        m_KeywordsCount = 0;
+    }
+
+    void KeywordsFrequencyTrie::accountKeywords(const QStringList &keywords, int sign) {
+        QSet<QString> accounted;
+        accounted.reserve(keywords.size());
+
+        QWriteLocker locker(&m_Lock);
+        Q_UNUSED(locker);
+
+        for (auto &keyword: keywords) {
+            const QString normalized = keyword.trimmed().toLower();
+            if (normalized.isEmpty() || accounted.contains(normalized)) { continue; }
+
+            accounted.insert(normalized);
+            accountUnsafe(normalized, sign);
+        }
+    }
+
+    void KeywordsFrequencyTrie::accountFrequencies(const QHash<QString, int> &frequencies) {
+        LOG_DEBUG << frequencies.size() << "keyword(s)";
+
+        QWriteLocker locker(&m_Lock);
+        Q_UNUSED(locker);
+
+        for (auto it = frequencies.constBegin(), end = frequencies.constEnd(); it != end; ++it) {
+            const QString normalized = it.key().trimmed().toLower();
+            if (normalized.isEmpty()) { continue; }
+
+            accountUnsafe(normalized, it.value());
+        }
+    }
+
+    int KeywordsFrequencyTrie::prompt(const QString &prefix, int maxCount, std::vector<CompletionResult> &completions) const {
+        if (maxCount <= 0) { return 0; }
+
+        // nodes are expanded in order of the biggest count in their subtree,
+        // keyword itself is pushed back as a separate candidate with own count
+        struct Candidate {
+            int m_Score;
+            quint32 m_NodeIndex;
+            bool m_IsKeyword;
+        };
+
+        auto candidateLess = [](const Candidate &left, const Candidate &right) {
+            if (left.m_Score != right.m_Score) { return left.m_Score < right.m_Score; }
+            // keywords go before subtrees with the same score
+            if (left.m_IsKeyword != right.m_IsKeyword) { return right.m_IsKeyword; }
+            return left.m_NodeIndex > right.m_NodeIndex;
+        };
+
+        QReadLocker locker(&m_Lock);
+        Q_UNUSED(locker);
+
+        const quint32 prefixNode = findNodeUnsafe(prefix.trimmed().toLower());
+        if (prefixNode == INVALID_NODE_INDEX) { return 0; }
+        if (m_Nodes[prefixNode].m_MaxCount <= 0) { return 0; }
+
+        std::priority_queue<Candidate, std::vector<Candidate>, decltype(candidateLess)> candidates(candidateLess);
+        candidates.push({m_Nodes[prefixNode].m_MaxCount, prefixNode, false});
+
+        int added = 0;
+        while (!candidates.empty() && (added < maxCount)) {
+            const Candidate candidate = candidates.top();
+            candidates.pop();
+
+            const TrieNode &node = m_Nodes[candidate.m_NodeIndex];
+
+            if (candidate.m_IsKeyword) {
+                completions.emplace_back(retrieveWordUnsafe(candidate.m_NodeIndex));
+                completions.back().m_Score = node.m_Count;
+                added++;
+                continue;
+            }
+
+            if (node.m_Count > 0) {
+                candidates.push({node.m_Count, candidate.m_NodeIndex, true});
+            }
+
+            quint32 child = node.m_FirstChild;
+            while (child != INVALID_NODE_INDEX) {
+                const TrieNode &childNode = m_Nodes[child];
+                if (childNode.m_MaxCount > 0) {
+                    candidates.push({childNode.m_MaxCount, child, false});
+                }
+
+                child = childNode.m_NextSibling;
+            }
+        }
+
+        return added;
+    }
+
+    int KeywordsFrequencyTrie::getKeywordsCount() const {
+        QReadLocker locker(&m_Lock);
+        Q_UNUSED(locker);
+        return m_KeywordsCount;
+    }
+
+    quint32 KeywordsFrequencyTrie::findNodeUnsafe(const QString &word) const {
+        quint32 current = ROOT_NODE_INDEX;
+
+        for (const QChar c: word) {
+            quint32 child = m_Nodes[current].m_FirstChild;
+            while ((child != INVALID_NODE_INDEX) && (m_Nodes[child].m_Char != c)) {
+                child = m_Nodes[child].m_NextSibling;
+            }
+
+            if (child == INVALID_NODE_INDEX) { return INVALID_NODE_INDEX; }
+            current = child;
+        }
+
+        return current;
+    }
+
+    quint32 KeywordsFrequencyTrie::findOrAddNodeUnsafe(const QString &word) {
+        quint32 current = ROOT_NODE_INDEX;
+
+        for (const QChar c: word) {
+            quint32 child = m_Nodes[current].m_FirstChild;
+            while ((child != INVALID_NODE_INDEX) && (m_Nodes[child].m_Char != c)) {
+                child = m_Nodes[child].m_NextSibling;
+            }
+
+            if (child == INVALID_NODE_INDEX) {
+                child = (quint32)m_Nodes.size();
+                m_Nodes.emplace_back(current, c);
+                m_Nodes[child].m_NextSibling = m_Nodes[current].m_FirstChild;
+                m_Nodes[current].m_FirstChild = child;
+            }
+
+            current = child;
+        }
+
+        return current;
+    }
+
+    void KeywordsFrequencyTrie::accountUnsafe(const QString &keyword, int delta) {
+        if (delta == 0) { return; }
+
+        quint32 nodeIndex;
+        if (delta > 0) {
+            nodeIndex = findOrAddNodeUnsafe(keyword);
+        } else {
+            nodeIndex = findNodeUnsafe(keyword);
+            if (nodeIndex == INVALID_NODE_INDEX) { return; }
+        }
+
+        TrieNode &node = m_Nodes[nodeIndex];
+        const int previousCount = node.m_Count;
+        // removals of keywords accounted before the library was loaded should not go negative
+        node.m_Count = std::max(0, previousCount + delta);
+
+        if ((previousCount == 0) && (node.m_Count > 0)) { m_KeywordsCount++; }
+        else if ((previousCount > 0) && (node.m_Count == 0)) { m_KeywordsCount--; }
+
+        updateMaxCountUnsafe(nodeIndex);
+    }
+
+    void KeywordsFrequencyTrie::updateMaxCountUnsafe(quint32 nodeIndex) {
+        while (nodeIndex != INVALID_NODE_INDEX) {
+            TrieNode &node = m_Nodes[nodeIndex];
+
+            int maxCount = node.m_Count;
+            quint32 child = node.m_FirstChild;
+            while (child != INVALID_NODE_INDEX) {
+                maxCount = std::max(maxCount, m_Nodes[child].m_MaxCount);
+                child = m_Nodes[child].m_NextSibling;
+            }
+
+            if (maxCount == node.m_MaxCount) { break; }
+
+            node.m_MaxCount = maxCount;
+            nodeIndex = node.m_Parent;
+        }
+    }
+
+    QString KeywordsFrequencyTrie::retrieveWordUnsafe(quint32 nodeIndex) const {
+        int length = 0;
+        for (quint32 i = nodeIndex; i != ROOT_NODE_INDEX; i = m_Nodes[i].m_Parent) { length++; }
+
+        // filled from the end so surrogate pairs keep their order
+        QString word(length, QChar());
+        while (nodeIndex != ROOT_NODE_INDEX) {
+            const TrieNode &node = m_Nodes[nodeIndex];
+            word[--length] = node.m_Char;
+            nodeIndex = node.m_Parent;
+        }
+
+        return word;
+    }
+}
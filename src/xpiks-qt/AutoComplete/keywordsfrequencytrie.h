@@ -0,0 +1,65 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef KEYWORDSFREQUENCYTRIE_H
+#define KEYWORDSFREQUENCYTRIE_H
+
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QChar>
+#include <QReadWriteLock>
+#include <vector>
+#include "completionquery.h"
+
+namespace AutoComplete {
+    // prefix tree of the keywords used by the user with count of artworks per keyword
+    // every node knows the biggest count in its subtree so top completions
+    // are found by visiting only nodes which can contain them
+    class KeywordsFrequencyTrie
+    {
+    public:
+        KeywordsFrequencyTrie();
+
+    public:
+        void clear();
+        // sign is +1 for keywords of the artwork being added and -1 for removed ones
+        void accountKeywords(const QStringList &keywords, int sign);
+        void accountFrequencies(const QHash<QString, int> &frequencies);
+        int prompt(const QString &prefix, int maxCount, std::vector<CompletionResult> &completions) const;
+        int getKeywordsCount() const;
+
+    private:
+        quint32 findNodeUnsafe(const QString &word) const;
+        quint32 findOrAddNodeUnsafe(const QString &word);
+        void accountUnsafe(const QString &keyword, int delta);
+        void updateMaxCountUnsafe(quint32 nodeIndex);
+        QString retrieveWordUnsafe(quint32 nodeIndex) const;
+
+    private:
+        struct TrieNode {
+            TrieNode(quint32 parent, QChar c);
+
+            quint32 m_Parent;
+            quint32 m_FirstChild;
+            quint32 m_NextSibling;
+            int m_Count;
+            // biggest count of the node or any of its descendants
+            int m_MaxCount;
+            QChar m_Char;
+        };
+
+        mutable QReadWriteLock m_Lock;
+        std::vector<TrieNode> m_Nodes;
+        int m_KeywordsCount;
+    };
+}
+
+#endif // KEYWORDSFREQUENCYTRIE_H
@@ -12,10 +12,13 @@
 #include <QCoreApplication>
 #include <QDir>
 #include <QFileInfo>
+#include <QStandardPaths>
 #include <string>
+#include <climits>
 #include <src/libfaceapi.hpp>
 #include <include/types.hpp>
 #include "../Common/defines.h"
+#include "../Helpers/constants.h"
 
 #define FREQUENCY_TABLE_FILENAME "en_wordlist.tsv"
 #define GENERATE_COMPLETIONS_COUNT 8
@@ -57,18 +60,7 @@ namespace AutoComplete {
         wordlistPath = resourcesDir.absoluteFilePath(FREQUENCY_TABLE_FILENAME);
 
         if (QFileInfo(wordlistPath).exists()) {
-            try {
-                m_Soufleur = new Souffleur();
-                importResult = m_Soufleur->import(wordlistPath.toStdString().c_str());
-                if (!importResult) {
-                    LOG_WARNING << "Failed to import" << wordlistPath;
-                } else {
-                    LOG_INFO << "LIBFACE initialized with" << wordlistPath;
-                }
-            }
-            catch (...) {
-                LOG_WARNING << "Exception while initializing LIBFACE with" << wordlistPath;
-            }
+            importResult = initializeIndex(wordlistPath) || initializeSouffleur(wordlistPath);
         } else {
             LOG_WARNING << "File not found:" << wordlistPath;
         }
@@ -76,9 +68,48 @@ namespace AutoComplete {
         return importResult;
     }
 
+    bool LibFaceCompletionEngine::initializeIndex(const QString &wordlistPath) {
+        QString appDataPath = XPIKS_USERDATA_PATH;
+        if (appDataPath.isEmpty()) { return false; }
+
+        QDir appDataDir(appDataPath);
+        const QString indexPath = appDataDir.filePath(Constants::AUTOCOMPLETE_INDEX_FILENAME);
+
+        bool success = m_WordlistIndex.open(indexPath, wordlistPath);
+        if (!success) {
+            // first run or the wordlist was updated
+            success = WordlistIndex::compile(wordlistPath, indexPath) &&
+                    m_WordlistIndex.open(indexPath, wordlistPath);
+        }
+
+        return success;
+    }
+
+    bool LibFaceCompletionEngine::initializeSouffleur(const QString &wordlistPath) {
+        LOG_DEBUG << "#";
+        bool importResult = false;
+
+        try {
+            m_Soufleur = new Souffleur();
+            importResult = m_Soufleur->import(wordlistPath.toStdString().c_str());
+            if (!importResult) {
+                LOG_WARNING << "Failed to import" << wordlistPath;
+            } else {
+                LOG_INFO << "LIBFACE initialized with" << wordlistPath;
+            }
+        }
+        catch (...) {
+            LOG_WARNING << "Exception while initializing LIBFACE with" << wordlistPath;
+        }
+
+        return importResult;
+    }
+
     void LibFaceCompletionEngine::finalize() {
         LOG_DEBUG << "#";
 
+        m_WordlistIndex.close();
+
         if (m_Soufleur != nullptr) {
             delete m_Soufleur;
             m_Soufleur = nullptr;
@@ -86,25 +117,33 @@ namespace AutoComplete {
     }
 
     bool LibFaceCompletionEngine::generateCompletions(const CompletionQuery &query, std::vector<CompletionResult> &completions) {
-        Q_ASSERT(m_Soufleur != nullptr);
+        Q_ASSERT(m_WordlistIndex.isOpened() || (m_Soufleur != nullptr));
         const QString &prefix = query.getPrefix();
 
-        uint_t completionsCount = GENERATE_COMPLETIONS_COUNT;
-        vp_t rawCompletions = m_Soufleur->prompt(prefix.toStdString(), completionsCount);
-
-        QSet<QString> completionsSet;
-        completionsSet.reserve(completionsCount);
+        QStringList phrases;
+        std::vector<quint32> frequencies;
+        if (m_WordlistIndex.isOpened()) {
+            m_WordlistIndex.prompt(prefix, GENERATE_COMPLETIONS_COUNT, phrases, frequencies);
+        } else {
+            uint_t completionsCount = GENERATE_COMPLETIONS_COUNT;
+            vp_t rawCompletions = m_Soufleur->prompt(prefix.toStdString(), completionsCount);
+            for (auto &suggestion: rawCompletions) {
+                phrases.append(QString::fromStdString(suggestion.phrase).trimmed());
+                frequencies.push_back((quint32)suggestion.weight);
+            }
+        }
 
-        const size_t size = rawCompletions.size();
-        completions.reserve((int)size);
-        completionsSet.reserve((int)size);
+        Q_ASSERT(frequencies.size() == (size_t)phrases.size());
 
-        for (size_t i = 0; i < size; ++i) {
-            const phrase_t &suggestion = rawCompletions[i];
-            const QString phrase = QString::fromStdString(suggestion.phrase).trimmed();
+        QSet<QString> completionsSet;
+        completionsSet.reserve(phrases.size());
+        completions.reserve(completions.size() + phrases.size());
 
+        for (int i = 0; i < phrases.size(); i++) {
+            const QString &phrase = phrases[i];
             if (!completionsSet.contains(phrase)) {
                 completions.push_back(CompletionResult(phrase));
+                completions.back().m_Score = (int)qMin(frequencies[i], (quint32)INT_MAX);
                 completionsSet.insert(phrase);
             }
         }
@@ -12,6 +12,7 @@
 #define LIBFACECOMPLETIONENGINE_H
 
 #include "completionenginebase.h"
+#include "wordlistindex.h"
 
 class Souffleur;
 
@@ -29,6 +30,11 @@ namespace AutoComplete {
         virtual bool generateCompletions(const CompletionQuery &query, std::vector<CompletionResult> &completions) override;
 
     private:
+        bool initializeIndex(const QString &wordlistPath);
+        bool initializeSouffleur(const QString &wordlistPath);
+
+    private:
+        WordlistIndex m_WordlistIndex;
         Souffleur *m_Soufleur;
     };
 }
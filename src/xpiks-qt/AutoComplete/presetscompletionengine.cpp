@@ -14,6 +14,7 @@
 
 #define MAX_PRESETS_IN_AC_COUNT 10
 #define PRESET_SIMILARITY_THRESHOLD 80
+#define MAX_SIMILAR_PRESETS_CANDIDATES 50
 
 namespace AutoComplete {
     PresetsCompletionEngine::PresetsCompletionEngine(KeywordsPresets::PresetKeywordsModel *presetsModel):
@@ -37,23 +38,23 @@ namespace AutoComplete {
 
         const size_t initialSize = completions.size();
 
-        m_PresetsModel->foreachPreset([&completions, &searchTerm](size_t, KeywordsPresets::PresetModel *preset) {
+        // only names sharing parts with the term are checked for similarity
+        m_PresetsModel->foreachPresetCandidate(searchTerm, MAX_PRESETS_IN_AC_COUNT, MAX_SIMILAR_PRESETS_CANDIDATES,
+                                               [&completions, &searchTerm](size_t, KeywordsPresets::PresetModel *preset, bool isMatch) {
             const QString &presetName = preset->m_PresetName;
 
             bool canAdd = false;
 
-            if (searchTerm.isEmpty() ||
-                    presetName.contains(searchTerm, Qt::CaseInsensitive)) {
+            if (isMatch) {
                 canAdd = true;
             } else {
-                int percentsSimilar = Helpers::levensteinPercentage(presetName, searchTerm);
                 int percentageThreshold = PRESET_SIMILARITY_THRESHOLD;
 
                 if (searchTerm.length() < presetName.length()) {
                     percentageThreshold = (PRESET_SIMILARITY_THRESHOLD * searchTerm.length()) / presetName.length();
                 }
 
-                canAdd = percentsSimilar >= percentageThreshold;
+                canAdd = Helpers::hasLevensteinPercentage(presetName, searchTerm, percentageThreshold);
             }
 
             bool shouldContinue = true;
@@ -63,17 +63,16 @@ namespace AutoComplete {
         if (sourceRow < 0 || sourceRow >= m_StringsList.length()) { return false; }
         if (m_SearchTerm.trimmed().isEmpty()) { return true; }
 
-        QString item = m_StringsList.at(sourceRow).toLower();
+        const QString &item = m_StringsList.at(sourceRow);
         if (item.contains(m_SearchTerm, Qt::CaseInsensitive)) { return true; }
 
-        int percentsSimilar = Helpers::levensteinPercentage(item, m_SearchTerm);
         int percentageThreshold = m_Threshold;
 
         if (m_SearchTerm.length() < item.length()) {
             percentageThreshold = (m_Threshold * m_SearchTerm.length()) / item.length();
         }
 
-        return (percentsSimilar >= percentageThreshold);
+        return Helpers::hasLevensteinPercentage(item, m_SearchTerm, percentageThreshold);
     }
 
     QHash<int, QByteArray> StringFilterProxyModel::roleNames() const {
@@ -0,0 +1,357 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "wordlistindex.h"
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QDateTime>
+#include <algorithm>
+#include <cstring>
+#include <queue>
+#include <vector>
+#include "../Common/defines.h"
+
+#define WORDLIST_INDEX_MAGIC "XACI"
+#define WORDLIST_INDEX_VERSION 1
+#define WORDLIST_INDEX_BYTE_ORDER_MARK 0x01020304
+#define INVALID_PHRASE_INDEX 0xFFFFFFFF
+
+namespace AutoComplete {
+    struct WordlistIndexHeader {
+        char m_Magic[4];
+        quint32 m_ByteOrderMark;
+        quint32 m_Version;
+        quint32 m_PhrasesCount;
+        quint32 m_StringsSize;
+        quint32 m_Reserved;
+        qint64 m_SourceSize;
+        qint64 m_SourceModified;
+    };
+
+    struct WordlistIndexEntry {
+        quint32 m_Offset;
+        quint32 m_Length;
+        quint32 m_Frequency;
+    };
+
+    struct CompiledPhrase {
+        QByteArray m_Phrase;
+        quint32 m_Frequency;
+    };
+
+    int comparePhrases(const char *left, quint32 leftLength, const char *right, quint32 rightLength) {
+        const int result = memcmp(left, right, qMin(leftLength, rightLength));
+        if (result != 0) { return result; }
+        if (leftLength == rightLength) { return 0; }
+        return leftLength < rightLength ? -1 : 1;
+    }
+
+    bool readPhrases(const QString &wordlistPath, std::vector<CompiledPhrase> &phrases) {
+        QFile wordlistFile(wordlistPath);
+        if (!wordlistFile.open(QIODevice::ReadOnly)) {
+            LOG_WARNING << "Failed to open" << wordlistPath;
+            return false;
+        }
+
+        while (!wordlistFile.atEnd()) {
+            const QByteArray line = wordlistFile.readLine();
+            const int tabIndex = line.indexOf('\t');
+            if (tabIndex <= 0) { continue; }
+
+            bool ok = false;
+            const quint32 frequency = line.left(tabIndex).trimmed().toUInt(&ok);
+            if (!ok) { continue; }
+
+            QByteArray phrase = line.mid(tabIndex + 1).trimmed();
+            if (phrase.isEmpty()) { continue; }
+
+            phrases.push_back({phrase, frequency});
+        }
+
+        return true;
+    }
+
+    void sortAndDeduplicate(std::vector<CompiledPhrase> &phrases) {
+        std::sort(phrases.begin(), phrases.end(), [](const CompiledPhrase &left, const CompiledPhrase &right) {
+            return comparePhrases(left.m_Phrase.constData(), (quint32)left.m_Phrase.size(),
+                                  right.m_Phrase.constData(), (quint32)right.m_Phrase.size()) < 0;
+        });
+
+        // duplicated phrases keep the biggest frequency
+        size_t last = 0;
+        for (size_t i = 1; i < phrases.size(); i++) {
+            if (phrases[i].m_Phrase == phrases[last].m_Phrase) {
+                phrases[last].m_Frequency = qMax(phrases[last].m_Frequency, phrases[i].m_Frequency);
+            } else {
+                last++;
+                if (last != i) { phrases[last] = std::move(phrases[i]); }
+            }
+        }
+
+        if (!phrases.empty()) { phrases.resize(last + 1); }
+    }
+
+    WordlistIndex::WordlistIndex():
+        m_Data(nullptr),
+        m_Entries(nullptr),
+        m_Tree(nullptr),
+        m_Strings(nullptr),
+        m_PhrasesCount(0)
+    {
+    }
+
+    WordlistIndex::~WordlistIndex() {
+        close();
+    }
+
+    bool WordlistIndex::compile(const QString &wordlistPath, const QString &indexPath) {
+        LOG_INFO << wordlistPath << "->" << indexPath;
+
+        QFileInfo wordlistInfo(wordlistPath);
+        std::vector<CompiledPhrase> phrases;
+        if (!readPhrases(wordlistPath, phrases)) { return false; }
+
+        sortAndDeduplicate(phrases);
+
+        const quint32 count = (quint32)phrases.size();
+
+        std::vector<WordlistIndexEntry> entries;
+        entries.reserve(count);
+        QByteArray strings;
+        for (auto &phrase: phrases) {
+            entries.push_back({(quint32)strings.size(), (quint32)phrase.m_Phrase.size(), phrase.m_Frequency});
+            strings.append(phrase.m_Phrase);
+        }
+
+        // iterative segment tree: leaves are at [count, 2*count), tree[1] is the root
+        std::vector<quint32> tree(2 * (size_t)count, INVALID_PHRASE_INDEX);
+        for (quint32 i = 0; i < count; i++) { tree[count + i] = i; }
+        for (quint32 i = count - 1; i >= 1 && count > 0; i--) {
+            const quint32 left = tree[2 * i], right = tree[2 * i + 1];
+            const quint32 leftFrequency = entries[left].m_Frequency, rightFrequency = entries[right].m_Frequency;
+            // on equal frequencies alphabetically first phrase wins
+            if (leftFrequency != rightFrequency) {
+                tree[i] = leftFrequency > rightFrequency ? left : right;
+            } else {
+                tree[i] = qMin(left, right);
+            }
+        }
+
+        WordlistIndexHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.m_Magic, WORDLIST_INDEX_MAGIC, sizeof(header.m_Magic));
+        header.m_ByteOrderMark = WORDLIST_INDEX_BYTE_ORDER_MARK;
+        header.m_Version = WORDLIST_INDEX_VERSION;
+        header.m_PhrasesCount = count;
+        header.m_StringsSize = (quint32)strings.size();
+        header.m_SourceSize = wordlistInfo.size();
+        header.m_SourceModified = wordlistInfo.lastModified().toMSecsSinceEpoch();
+
+        QSaveFile indexFile(indexPath);
+        if (!indexFile.open(QIODevice::WriteOnly)) {
+            LOG_WARNING << "Failed to open" << indexPath;
+            return false;
+        }
+
+        indexFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        indexFile.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(WordlistIndexEntry));
+        indexFile.write(reinterpret_cast<const char*>(tree.data()), tree.size() * sizeof(quint32));
+        indexFile.write(strings);
+
+        const bool success = indexFile.commit();
+        LOG_INFO << "Compiled" << count << "phrases:" << success;
+        return success;
+    }
+
+    bool WordlistIndex::open(const QString &indexPath, const QString &wordlistPath) {
+        LOG_DEBUG << indexPath;
+        close();
+
+        m_IndexFile.setFileName(indexPath);
+        if (!m_IndexFile.open(QIODevice::ReadOnly)) {
+            LOG_INFO << "Cannot open" << indexPath;
+            return false;
+        }
+
+        const qint64 fileSize = m_IndexFile.size();
+        bool success = false;
+
+        do {
+            if (fileSize < (qint64)sizeof(WordlistIndexHeader)) { break; }
+
+            uchar *data = m_IndexFile.map(0, fileSize);
+            if (data == nullptr) {
+                LOG_WARNING << "Failed to map" << indexPath;
+                break;
+            }
+
+            m_Data = data;
+            const WordlistIndexHeader *header = reinterpret_cast<const WordlistIndexHeader*>(m_Data);
+            if ((memcmp(header->m_Magic, WORDLIST_INDEX_MAGIC, sizeof(header->m_Magic)) != 0) ||
+                    (header->m_ByteOrderMark != WORDLIST_INDEX_BYTE_ORDER_MARK) ||
+                    (header->m_Version != WORDLIST_INDEX_VERSION)) {
+                LOG_WARNING << "Incompatible index format";
+                break;
+            }
+
+            const qint64 count = header->m_PhrasesCount;
+            const qint64 expectedSize = (qint64)sizeof(WordlistIndexHeader) +
+                    count * (qint64)sizeof(WordlistIndexEntry) +
+                    2 * count * (qint64)sizeof(quint32) +
+                    (qint64)header->m_StringsSize;
+            if (expectedSize != fileSize) {
+                LOG_WARNING << "Index is corrupted: expected size" << expectedSize << "actual" << fileSize;
+                break;
+            }
+
+            if (!wordlistPath.isEmpty()) {
+                QFileInfo wordlistInfo(wordlistPath);
+                if ((header->m_SourceSize != wordlistInfo.size()) ||
+                        (header->m_SourceModified != wordlistInfo.lastModified().toMSecsSinceEpoch())) {
+                    LOG_INFO << "Index is outdated for" << wordlistPath;
+                    break;
+                }
+            }
+
+            m_PhrasesCount = header->m_PhrasesCount;
+            m_Entries = reinterpret_cast<const WordlistIndexEntry*>(m_Data + sizeof(WordlistIndexHeader));
+            m_Tree = reinterpret_cast<const quint32*>(m_Entries + m_PhrasesCount);
+            m_Strings = reinterpret_cast<const char*>(m_Tree + 2 * (size_t)m_PhrasesCount);
+            success = true;
+        } while (false);
+
+        if (!success) {
+            close();
+        } else {
+            LOG_INFO << "Mapped" << m_PhrasesCount << "phrases from" << indexPath;
+        }
+
+        return success;
+    }
+
+    void WordlistIndex::close() {
+        if (m_Data != nullptr) {
+            m_IndexFile.unmap(const_cast<uchar*>(m_Data));
+            m_Data = nullptr;
+        }
+
+        if (m_IndexFile.isOpen()) {
+            m_IndexFile.close();
+        }
+
+        m_Entries = nullptr;
+        m_Tree = nullptr;
+        m_Strings = nullptr;
+        m_PhrasesCount = 0;
+    }
+
+    int WordlistIndex::prompt(const QString &prefix, int maxCount, QStringList &phrases) const {
+        std::vector<quint32> frequencies;
+        return prompt(prefix, maxCount, phrases, frequencies);
+    }
+
+    int WordlistIndex::prompt(const QString &prefix, int maxCount, QStringList &phrases, std::vector<quint32> &frequencies) const {
+        if (!isOpened() || (m_PhrasesCount == 0) || (maxCount <= 0)) { return 0; }
+
+        const QByteArray prefixBytes = prefix.toUtf8();
+        quint32 first = 0, last = 0;
+        getPrefixRange(prefixBytes, first, last);
+        if (first >= last) { return 0; }
+
+        // best phrase of each candidate range is in the queue, when it is taken
+        // the range is split into the parts to the left and to the right of it
+        struct Candidate {
+            quint32 m_Index;
+            quint32 m_First;
+            quint32 m_Last;
+        };
+
+        auto candidateLess = [this](const Candidate &left, const Candidate &right) {
+            return getBetter(left.m_Index, right.m_Index) == right.m_Index;
+        };
+
+        std::priority_queue<Candidate, std::vector<Candidate>, decltype(candidateLess)> candidates(candidateLess);
+        candidates.push({getBestInRange(first, last), first, last});
+
+        int added = 0;
+        while (!candidates.empty() && (added < maxCount)) {
+            const Candidate candidate = candidates.top();
+            candidates.pop();
+
+            const WordlistIndexEntry &entry = m_Entries[candidate.m_Index];
+            phrases.append(QString::fromUtf8(m_Strings + entry.m_Offset, (int)entry.m_Length));
+            frequencies.push_back(entry.m_Frequency);
+            added++;
+
+            if (candidate.m_First < candidate.m_Index) {
+                candidates.push({getBestInRange(candidate.m_First, candidate.m_Index), candidate.m_First, candidate.m_Index});
+            }
+
+            if (candidate.m_Index + 1 < candidate.m_Last) {
+                candidates.push({getBestInRange(candidate.m_Index + 1, candidate.m_Last), candidate.m_Index + 1, candidate.m_Last});
+            }
+        }
+
+        return added;
+    }
+
+    void WordlistIndex::getPrefixRange(const QByteArray &prefix, quint32 &first, quint32 &last) const {
+        // first phrase not less than prefix
+        quint32 low = 0, high = m_PhrasesCount;
+        while (low < high) {
+            const quint32 middle = low + (high - low) / 2;
+            if (compareWithPrefix(middle, prefix) < 0) { low = middle + 1; } else { high = middle; }
+        }
+
+        first = low;
+
+        // phrases with the prefix are contiguous: first one that does not start with it
+        high = m_PhrasesCount;
+        while (low < high) {
+            const quint32 middle = low + (high - low) / 2;
+            if (compareWithPrefix(middle, prefix) == 0) { low = middle + 1; } else { high = middle; }
+        }
+
+        last = low;
+    }
+
+    quint32 WordlistIndex::getBestInRange(quint32 first, quint32 last) const {
+        quint32 best = INVALID_PHRASE_INDEX;
+
+        for (first += m_PhrasesCount, last += m_PhrasesCount; first < last; first >>= 1, last >>= 1) {
+            if (first & 1) { best = getBetter(best, m_Tree[first++]); }
+            if (last & 1) { best = getBetter(best, m_Tree[--last]); }
+        }
+
+        return best;
+    }
+
+    quint32 WordlistIndex::getBetter(quint32 left, quint32 right) const {
+        if (left == INVALID_PHRASE_INDEX) { return right; }
+        if (right == INVALID_PHRASE_INDEX) { return left; }
+
+        const quint32 leftFrequency = m_Entries[left].m_Frequency;
+        const quint32 rightFrequency = m_Entries[right].m_Frequency;
+        if (leftFrequency != rightFrequency) {
+            return leftFrequency > rightFrequency ? left : right;
+        }
+
+        return qMin(left, right);
+    }
+
+    // 0 if phrase starts with the prefix, otherwise order of the phrase relative to the prefix
+    int WordlistIndex::compareWithPrefix(quint32 index, const QByteArray &prefix) const {
+        const WordlistIndexEntry &entry = m_Entries[index];
+        const quint32 prefixLength = (quint32)prefix.size();
+        const int result = memcmp(m_Strings + entry.m_Offset, prefix.constData(), qMin(entry.m_Length, prefixLength));
+        if (result != 0) { return result; }
+        return entry.m_Length < prefixLength ? -1 : 0;
+    }
+}
@@ -0,0 +1,64 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef WORDLISTINDEX_H
+#define WORDLISTINDEX_H
+
+#include <QString>
+#include <QStringList>
+#include <QFile>
+#include <QtGlobal>
+#include <vector>
+
+namespace AutoComplete {
+    struct WordlistIndexEntry;
+
+    // Wordlist with phrase frequencies compiled into a binary file:
+    // phrases sorted by utf-8 bytes, segment tree of most frequent
+    // phrase in a range and the strings blob. The file is mapped
+    // read-only, so opening it costs no parsing and its pages are
+    // shared through the page cache
+    class WordlistIndex
+    {
+    public:
+        WordlistIndex();
+        ~WordlistIndex();
+
+    public:
+        // parses libface's "frequency\tphrase" table into indexPath
+        static bool compile(const QString &wordlistPath, const QString &indexPath);
+
+    public:
+        // fails if index is corrupted or was compiled from another version of the wordlist
+        bool open(const QString &indexPath, const QString &wordlistPath);
+        void close();
+        bool isOpened() const { return m_Data != nullptr; }
+        quint32 getPhrasesCount() const { return m_PhrasesCount; }
+        // most frequent phrases starting with prefix in descending frequency order
+        int prompt(const QString &prefix, int maxCount, QStringList &phrases) const;
+        int prompt(const QString &prefix, int maxCount, QStringList &phrases, std::vector<quint32> &frequencies) const;
+
+    private:
+        void getPrefixRange(const QByteArray &prefix, quint32 &first, quint32 &last) const;
+        quint32 getBestInRange(quint32 first, quint32 last) const;
+        quint32 getBetter(quint32 left, quint32 right) const;
+        int compareWithPrefix(quint32 index, const QByteArray &prefix) const;
+
+    private:
+        QFile m_IndexFile;
+        const uchar *m_Data;
+        const WordlistIndexEntry *m_Entries;
+        const quint32 *m_Tree;
+        const char *m_Strings;
+        quint32 m_PhrasesCount;
+    };
+}
+
+#endif // WORDLISTINDEX_H
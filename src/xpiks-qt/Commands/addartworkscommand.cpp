@@ -53,7 +53,8 @@ std::shared_ptr<Commands::ICommandResult> Commands::AddArtworksCommand::execute(
 
     const int newFilesCount = artworksRepository->getNewFilesCount(m_FilePathes);
     const int initialCount = artItemsModel->rowCount();
-    const bool filesWereAccounted = artworksRepository->beginAccountingFiles(m_FilePathes);
+    const bool filesAreListed = getFilesAreListedFlag();
+    const bool filesWereAccounted = artworksRepository->beginAccountingFiles(m_FilePathes, filesAreListed);
 
     MetadataIO::ArtworksSnapshot artworksToImport;
     artworksToImport.reserve(newFilesCount);
@@ -73,7 +74,7 @@ std::shared_ptr<Commands::ICommandResult> Commands::AddArtworksCommand::execute(
             const QString &filename = m_FilePathes[i];
             qint64 directoryID = 0;
 
-            if (artworksRepository->accountFile(filename, directoryID, directoryFlags)) {
+            if (artworksRepository->accountFile(filename, directoryID, directoryFlags, filesAreListed)) {
                 Models::ArtworkMetadata *artwork = artItemsModel->createArtwork(filename, directoryID);
                 commandManager->connectArtworkSignals(artwork);
 
@@ -94,29 +95,48 @@ std::shared_ptr<Commands::ICommandResult> Commands::AddArtworksCommand::execute(
     artworksRepository->watchFilePaths(filesToWatch);
     artworksRepository->updateFilesCounts();
 
-    QHash<QString, QHash<QString, QString> > vectorsHash;
-    decomposeVectors(vectorsHash);
     QVector<int> modifiedIndices;
+    int attachedCount = 0;
+
+    if (filesAreListed) {
+        // vectors were found in the same listing so directories are not listed again
+        // and they are matched only against new artworks so that a directory
+        // split into several batches does not attach its vectors twice
+        QVector<int> listedAttachedIndices;
+        QHash<QString, QHash<QString, QString> > listedVectors;
+        Helpers::groupVectorsByDirectory(m_VectorsPathes, listedVectors);
+        attachedCount = Helpers::findAndAttachVectors(artworksToImport.getWeakSnapshot(), listedVectors, listedAttachedIndices);
+
+        foreach (int index, listedAttachedIndices) {
+            modifiedIndices.append(initialCount + index);
+        }
+    } else {
+        QHash<QString, QHash<QString, QString> > vectorsHash;
+        decomposeVectors(vectorsHash);
+        attachedCount = artItemsModel->attachVectors(vectorsHash, modifiedIndices);
 
-    int attachedCount = artItemsModel->attachVectors(vectorsHash, modifiedIndices);
-
-    if (getAutoFindVectorsFlag()) {
-        QVector<int> autoAttachedIndices;
-        attachedCount = Helpers::findAndAttachVectors(artworksToImport.getWeakSnapshot(), autoAttachedIndices);
+        if (getAutoFindVectorsFlag()) {
+            QVector<int> autoAttachedIndices;
+            attachedCount = Helpers::findAndAttachVectors(artworksToImport.getWeakSnapshot(), autoAttachedIndices);
 
-        foreach (int index, autoAttachedIndices) {
-            modifiedIndices.append(initialCount + index);
+            foreach (int index, autoAttachedIndices) {
+                modifiedIndices.append(initialCount + index);
+            }
         }
     }
 
+    artItemsModel->updateItems(modifiedIndices, QVector<int>() << Models::ArtItemsModel::HasVectorAttachedRole);
+
+    if (m_Batches) {
+        return afterBatchAddedHandler(commandManager, artworksToImport, initialCount, (int)artworksToImport.size(), attachedCount);
+    }
+
     int importID = 0;
 
     if (newFilesCount > 0) {
         importID = afterAddedHandler(commandManager, artworksToImport, filesToWatch, initialCount, newFilesCount);
     }
 
-    artItemsModel->updateItems(modifiedIndices, QVector<int>() << Models::ArtItemsModel::HasVectorAttachedRole);
-
     std::shared_ptr<AddArtworksCommandResult> result(new AddArtworksCommandResult(
                                                          newFilesCount,
                                                          attachedCount,
@@ -149,6 +169,69 @@ int Commands::AddArtworksCommand::afterAddedHandler(CommandManager *commandManag
     return importID;
 }
 
+std::shared_ptr<Commands::ICommandResult> Commands::AddArtworksCommand::afterBatchAddedHandler(CommandManager *commandManager, const MetadataIO::ArtworksSnapshot &artworksToImport, int initialCount, int newFilesCount, int attachedCount) const {
+    Models::ArtworksRepository *artworksRepository = commandManager->getArtworksRepository();
+    auto *xpiks = commandManager->getDelegator();
+    AddedArtworksBatches &batches = *m_Batches;
+
+    if (newFilesCount > 0) {
+        // cached metadata of the batch is read while next batches are listed
+        batches.m_StorageReadBatchIDs.append(xpiks->readMetadataFromStorage(artworksToImport));
+        accountVectors(artworksRepository, artworksToImport.getWeakSnapshot());
+        artworksRepository->refresh();
+        xpiks->generatePreviews(artworksToImport);
+
+        batches.m_AddedArtworks.append(artworksToImport.getWeakSnapshot());
+
+        const int lastIndex = initialCount + newFilesCount - 1;
+        if (!batches.m_AddedRanges.empty() && (batches.m_AddedRanges.last().second + 1 == initialCount)) {
+            batches.m_AddedRanges.last().second = lastIndex;
+        } else {
+            batches.m_AddedRanges.append(qMakePair(initialCount, lastIndex));
+        }
+    }
+
+    batches.m_AttachedVectorsCount += attachedCount;
+
+    if (!getIsLastBatchFlag()) {
+        std::shared_ptr<AddArtworksCommandResult> result(new AddArtworksCommandResult(newFilesCount, attachedCount, 0, false, false));
+        return result;
+    }
+
+    const MetadataIO::ArtworksSnapshot &addedArtworks = batches.m_AddedArtworks;
+    const int addedCount = (int)addedArtworks.size();
+    LOG_INFO << addedCount << "files added in" << batches.m_StorageReadBatchIDs.size() << "batch(es)";
+
+    int importID = 0;
+
+    if (addedCount > 0) {
+        importID = xpiks->readMetadata(addedArtworks, batches.m_StorageReadBatchIDs);
+        batches.m_ImportID = importID;
+
+        std::unique_ptr<UndoRedo::IHistoryItem> addArtworksItem(new UndoRedo::AddArtworksHistoryItem(getCommandID(), batches.m_AddedRanges));
+        xpiks->recordHistoryItem(addArtworksItem);
+
+        QStringList addedFiles;
+        addedFiles.reserve(addedCount);
+        for (auto *artwork: addedArtworks.getWeakSnapshot()) {
+            addedFiles.append(artwork->getFilepath());
+        }
+
+        xpiks->addToRecentFiles(addedFiles);
+
+        if (!getIsSessionRestoreFlag()) {
+            xpiks->saveSessionInBackground();
+        }
+    }
+
+    std::shared_ptr<AddArtworksCommandResult> result(new AddArtworksCommandResult(
+                                                         addedCount,
+                                                         batches.m_AttachedVectorsCount,
+                                                         importID,
+                                                         getAutoImportFlag()));
+    return result;
+}
+
 void Commands::AddArtworksCommand::decomposeVectors(QHash<QString, QHash<QString, QString> > &vectors) const {
     int size = m_VectorsPathes.size();
     LOG_DEBUG << size << "item(s)";
@@ -167,6 +250,8 @@ void Commands::AddArtworksCommand::decomposeVectors(QHash<QString, QHash<QString
 }
 
 void Commands::AddArtworksCommandResult::afterExecCallback(const Commands::ICommandManager *commandManagerInterface) const {
+    if (!m_IsFinished) { return; }
+
     CommandManager *commandManager = (CommandManager*)commandManagerInterface;
 
 #ifndef CORE_TESTS
@@ -174,7 +259,6 @@ void Commands::AddArtworksCommandResult::afterExecCallback(const Commands::IComm
         LOG_DEBUG << "Autoimport is ON. Proceeding...";
         MetadataIO::MetadataIOCoordinator *ioCoordinator = commandManager->getMetadataIOCoordinator();
         ioCoordinator->continueReading(false);
-        QCoreApplication::processEvents(QEventLoop::ExcludeUserInputEvents);
     }
 #endif
 
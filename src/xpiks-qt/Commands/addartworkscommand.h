@@ -13,16 +13,31 @@
 
 #include <QStringList>
 #include <QHash>
+#include <QVector>
+#include <QPair>
+#include <memory>
 #include "commandbase.h"
 #include "../Common/flags.h"
-
-namespace MetadataIO {
-    class ArtworksSnapshot;
-}
+#include "../MetadataIO/artworkssnapshot.h"
 
 namespace Commands {
     class CommandManager;
 
+    // files of listed directories are added in several batches
+    // which are imported and recorded in history as a single add
+    struct AddedArtworksBatches {
+        AddedArtworksBatches():
+            m_AttachedVectorsCount(0),
+            m_ImportID(0)
+        { }
+
+        MetadataIO::ArtworksSnapshot m_AddedArtworks;
+        QVector<QPair<int, int> > m_AddedRanges;
+        QVector<quint32> m_StorageReadBatchIDs;
+        int m_AttachedVectorsCount;
+        int m_ImportID;
+    };
+
     class AddArtworksCommand : public CommandBase
     {
     public:
@@ -30,7 +45,9 @@ namespace Commands {
             FlagAutoFindVectors = 1 << 0,
             FlagIsFullDirectory = 1 << 1,
             FlagIsSessionRestore = 1 << 2,
-            FlagAutoImport = 1 << 3
+            FlagAutoImport = 1 << 3,
+            FlagFilesAreListed = 1 << 4,
+            FlagIsLastBatch = 1 << 5
         };
 
     private:
@@ -38,6 +55,8 @@ namespace Commands {
         inline bool getIsFullDirectoryFlag() const { return Common::HasFlag(m_Flags, FlagIsFullDirectory); }
         inline bool getIsSessionRestoreFlag() const { return Common::HasFlag(m_Flags, FlagIsSessionRestore); }
         inline bool getAutoImportFlag() const { return Common::HasFlag(m_Flags, FlagAutoImport); }
+        inline bool getFilesAreListedFlag() const { return Common::HasFlag(m_Flags, FlagFilesAreListed); }
+        inline bool getIsLastBatchFlag() const { return Common::HasFlag(m_Flags, FlagIsLastBatch); }
 
     public:
         AddArtworksCommand(const QStringList &pathes, const QStringList &vectorPathes, Common::flag_t flags) :
@@ -47,6 +66,15 @@ namespace Commands {
             m_Flags(flags)
         { }
 
+        AddArtworksCommand(const QStringList &pathes, const QStringList &vectorPathes, Common::flag_t flags,
+                           const std::shared_ptr<AddedArtworksBatches> &batches) :
+            CommandBase(CommandType::AddArtworks),
+            m_FilePathes(pathes),
+            m_VectorsPathes(vectorPathes),
+            m_Flags(flags),
+            m_Batches(batches)
+        { Q_ASSERT(batches); }
+
         virtual ~AddArtworksCommand();
 
     public:
@@ -57,21 +85,26 @@ namespace Commands {
                               const MetadataIO::ArtworksSnapshot &artworksToImport,
                               QStringList filesToWatch,
                               int initialCount, int newFilesCount) const;
+        std::shared_ptr<ICommandResult> afterBatchAddedHandler(CommandManager *commandManager,
+                                                               const MetadataIO::ArtworksSnapshot &artworksToImport,
+                                                               int initialCount, int newFilesCount, int attachedCount) const;
         void decomposeVectors(QHash<QString, QHash<QString, QString> > &vectors) const;
 
     public:
         QStringList m_FilePathes;
         QStringList m_VectorsPathes;
         Common::flag_t m_Flags;
+        std::shared_ptr<AddedArtworksBatches> m_Batches;
     };
 
     class AddArtworksCommandResult : public CommandResult {
     public:
-        AddArtworksCommandResult(int addedFilesCount, int attachedVectorsCount, int importID, bool autoImport):
+        AddArtworksCommandResult(int addedFilesCount, int attachedVectorsCount, int importID, bool autoImport, bool isFinished = true):
             m_NewFilesAdded(addedFilesCount),
             m_AttachedVectorsCount(attachedVectorsCount),
             m_ImportID(importID),
-            m_AutoImport(autoImport)
+            m_AutoImport(autoImport),
+            m_IsFinished(isFinished)
         { }
 
     public:
@@ -82,6 +115,8 @@ namespace Commands {
         int m_AttachedVectorsCount;
         int m_ImportID;
         bool m_AutoImport;
+        // intermediate batches neither import nor report added files
+        bool m_IsFinished;
     };
 }
 
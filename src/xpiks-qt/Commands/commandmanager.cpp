@@ -60,11 +60,15 @@
 #include "../QMLExtensions/videocachingservice.h"
 #include "../QMLExtensions/artworksupdatehub.h"
 #include "../Helpers/asynccoordinator.h"
+#include "../Helpers/startuptimeline.h"
 #include "../Helpers/database.h"
 #include "../Models/switchermodel.h"
 #include "../Connectivity/requestsservice.h"
 #include "../AutoComplete/keywordsautocompletemodel.h"
 #include "../MetadataIO/csvexportmodel.h"
+#include <QTimer>
+
+#define DEFERRED_INIT_DELAY 500
 
 Commands::CommandManager::CommandManager():
     QObject(),
@@ -431,6 +435,11 @@ void Commands::CommandManager::connectEntitiesSignalsSlots() const {
         QObject::connect(m_MetadataIOCoordinator, &MetadataIO::MetadataIOCoordinator::metadataReadingFinished,
                          m_ArtItemsModel, &Models::ArtItemsModel::modifiedArtworksCountChanged);
 
+        // queued because the reading hub finalizes the import after the signal
+        QObject::connect(m_MetadataIOCoordinator, &MetadataIO::MetadataIOCoordinator::metadataReadingFinished,
+                         m_ArtItemsModel, &Models::ArtItemsModel::onMetadataReadingFinished,
+                         Qt::QueuedConnection);
+
         QObject::connect(m_MetadataIOCoordinator, &MetadataIO::MetadataIOCoordinator::metadataWritingFinished,
                          m_ArtItemsModel, &Models::ArtItemsModel::modifiedArtworksCountChanged);
     }
@@ -647,21 +656,36 @@ void Commands::CommandManager::afterConstructionCallback() {
                 new Helpers::AsyncCoordinatorStartParams(&m_InitCoordinator));
 
 #ifndef CORE_TESTS
-    bool dbInitialized = m_DatabaseManager->initialize();
-    Q_ASSERT(dbInitialized);
-    if (!dbInitialized) {
-        LOG_WARNING << "Failed to initialize the DB. Xpiks will crash soon";
+    {
+        Helpers::StartupStageTimer stageTimer("Database");
+        Q_UNUSED(stageTimer);
+        bool dbInitialized = m_DatabaseManager->initialize();
+        Q_ASSERT(dbInitialized);
+        if (!dbInitialized) {
+            LOG_WARNING << "Failed to initialize the DB. Xpiks will crash soon";
+        }
     }
 
-    m_MaintenanceService->startService();
-    m_ImageCachingService->startService(coordinatorParams);
-    m_VideoCachingService->startService();
-    m_MetadataIOService->startService();
+    {
+        Helpers::StartupStageTimer stageTimer("IO services");
+        Q_UNUSED(stageTimer);
+        m_MaintenanceService->startService();
+        m_ImageCachingService->startService(coordinatorParams);
+        m_VideoCachingService->startService();
+        m_MetadataIOService->startService();
+    }
 #endif
-    m_SpellCheckerService->startService(coordinatorParams);
-    m_WarningsService->startService(emptyParams);
-    m_AutoCompleteService->startService(coordinatorParams);
-    m_TranslationService->startService(coordinatorParams);
+
+    {
+        // workers of these services load dictionaries and completion sources
+        // on first use or when warmed up after session is restored
+        Helpers::StartupStageTimer stageTimer("Lazy services");
+        Q_UNUSED(stageTimer);
+        m_SpellCheckerService->startService(coordinatorParams);
+        m_WarningsService->startService(emptyParams);
+        m_AutoCompleteService->startService(coordinatorParams);
+        m_TranslationService->startService(coordinatorParams);
+    }
 
     QCoreApplication::processEvents();
 
@@ -677,14 +701,20 @@ void Commands::CommandManager::afterConstructionCallback() {
     m_WarningsService->initWarningsSettings();
     m_TranslationManager->initializeDictionaries();
     m_UploadInfoRepository->initializeConfig();
-    m_PresetsModel->initializePresets();
-    m_CsvExportModel->initializeExportPlans(&m_InitCoordinator);
-    m_KeywordsSuggestor->initSuggestionEngines();
+#endif
+
+#ifdef INTEGRATION_TESTS
+    // tests expect presets and export plans to be available right away
+    initializeDeferredServices();
 #endif
 
     executeMaintenanceJobs();
 
-    m_MainDelegator.readSession();
+    {
+        Helpers::StartupStageTimer stageTimer("Read session");
+        Q_UNUSED(stageTimer);
+        m_MainDelegator.readSession();
+    }
 }
 
 void Commands::CommandManager::afterInnerServicesInitialized() {
@@ -698,13 +728,21 @@ void Commands::CommandManager::afterInnerServicesInitialized() {
     m_SwitcherModel->initialize();
 #endif
 
-    int newFilesAdded = m_MainDelegator.restoreReadSession();
+    int newFilesAdded = 0;
+    {
+        Helpers::StartupStageTimer stageTimer("Restore session");
+        Q_UNUSED(stageTimer);
+        newFilesAdded = m_MainDelegator.restoreReadSession();
+    }
+
     if (newFilesAdded > 0) {
         // immediately save restored session - to beat race between
         // saving session from Add Command and restoring FULL_DIR flag
         m_MainDelegator.saveSessionInBackground();
     }
 
+    Helpers::StartupTimeline::getInstance().reportMilestone("Session restored");
+
 #if !defined(CORE_TESTS) && !defined(INTEGRATION_TESTS)
     m_SwitcherModel->afterInitializedCallback();
 #endif
@@ -712,6 +750,45 @@ void Commands::CommandManager::afterInnerServicesInitialized() {
 #ifndef CORE_TESTS
     m_UpdateService->startChecking();
 #endif
+
+#if !defined(CORE_TESTS) && !defined(INTEGRATION_TESTS)
+    // let the main window process pending events first
+    QTimer::singleShot(DEFERRED_INIT_DELAY, this, SLOT(initializeDeferredServices()));
+#endif
+}
+
+void Commands::CommandManager::initializeDeferredServices() {
+    LOG_DEBUG << "#";
+
+#ifndef CORE_TESTS
+    {
+        Helpers::StartupStageTimer stageTimer("Presets");
+        Q_UNUSED(stageTimer);
+        m_PresetsModel->initializePresets();
+    }
+
+    {
+        Helpers::StartupStageTimer stageTimer("CSV export plans");
+        Q_UNUSED(stageTimer);
+        m_CsvExportModel->initializeExportPlans(nullptr);
+    }
+
+    {
+        Helpers::StartupStageTimer stageTimer("Suggestion engines");
+        Q_UNUSED(stageTimer);
+        m_KeywordsSuggestor->initSuggestionEngines();
+    }
+#endif
+
+    m_SpellCheckerService->warmup();
+    m_AutoCompleteService->warmup();
+#ifndef CORE_TESTS
+    m_MetadataIOService->warmup();
+#endif
+
+    Helpers::StartupTimeline &timeline = Helpers::StartupTimeline::getInstance();
+    timeline.reportMilestone("Deferred services initialized");
+    timeline.logSummary();
 }
 
 void Commands::CommandManager::executeMaintenanceJobs() {
@@ -221,6 +221,7 @@ namespace Commands {
 
     private slots:
         void servicesInitialized(int status);
+        void initializeDeferredServices();
 
     public:
         // methods for getters
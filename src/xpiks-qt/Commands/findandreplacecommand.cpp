@@ -42,10 +42,21 @@ namespace Commands {
             if (!element->getIsSelected()) { continue; }
 
             Models::ArtworkMetadata *artwork = locker->getArtworkMetadata();
+            Common::SearchFlags flags = m_Flags;
+
+            // fields without hits found by the preview are left untouched
+            std::shared_ptr<Models::PreviewArtworkElement> preview = std::dynamic_pointer_cast<Models::PreviewArtworkElement>(locker);
+            if (preview) {
+                if (!preview->hasTitleMatch()) { Common::UnsetFlag(flags, Common::SearchFlags::Title); }
+                if (!preview->hasDescriptionMatch()) { Common::UnsetFlag(flags, Common::SearchFlags::Description); }
+                if (!preview->hasKeywordsMatch()) { Common::UnsetFlag(flags, Common::SearchFlags::Keywords); }
+
+                if (((int)flags & (int)Common::SearchFlags::Metadata) == 0) { continue; }
+            }
 
             artworksBackups.emplace_back(artwork);
 
-            bool succeeded = artwork->replace(m_ReplaceWhat, m_ReplaceTo, m_Flags);
+            bool succeeded = artwork->replace(m_ReplaceWhat, m_ReplaceTo, flags);
             if (succeeded) {
                 LOG_FOR_TESTS << "Succeeded";
                 itemsToSave.push_back(artwork);
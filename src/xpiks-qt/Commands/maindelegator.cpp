@@ -155,25 +155,40 @@ namespace Commands {
 
     int MainDelegator::readMetadata(const MetadataIO::ArtworksSnapshot &snapshot) const {
         LOG_DEBUG << "#";
+        const quint32 batchID = readMetadataFromStorage(snapshot);
+        return readMetadata(snapshot, QVector<quint32>() << batchID);
+    }
+
+    int MainDelegator::readMetadata(const MetadataIO::ArtworksSnapshot &snapshot, const QVector<quint32> &storageReadBatchIDs) const {
+        LOG_DEBUG << storageReadBatchIDs.size() << "storage batch(es)";
         int importID = 0;
 
     #ifndef CORE_TESTS
-        auto *metadataIOService = m_CommandManager->getMetadataIOService();
         auto *metadataIOCoordinator = m_CommandManager->getMetadataIOCoordinator();
+        if (metadataIOCoordinator != nullptr) {
+            importID = metadataIOCoordinator->readMetadataExifTool(snapshot, storageReadBatchIDs);
+        }
+    #else
+        Q_UNUSED(snapshot);
+        Q_UNUSED(storageReadBatchIDs);
+    #endif
+
+        return importID;
+    }
+
+    quint32 MainDelegator::readMetadataFromStorage(const MetadataIO::ArtworksSnapshot &snapshot) const {
         quint32 batchID = INVALID_BATCH_ID;
 
+    #ifndef CORE_TESTS
+        auto *metadataIOService = m_CommandManager->getMetadataIOService();
         if (metadataIOService != nullptr) {
             batchID = metadataIOService->readArtworks(snapshot);
         }
-
-        if (metadataIOCoordinator != nullptr) {
-            importID = metadataIOCoordinator->readMetadataExifTool(snapshot, batchID);
-        }
     #else
         Q_UNUSED(snapshot);
     #endif
 
-        return importID;
+        return batchID;
     }
 
     int MainDelegator::reimportMetadata(const MetadataIO::ArtworksSnapshot &snapshot) const {
@@ -157,6 +157,8 @@ namespace Commands {
         void setArtworksForZipping(MetadataIO::ArtworksSnapshot &artworks) const;
         void setArtworksForCsvExport(MetadataIO::ArtworksSnapshot::Container &rawSnapshot) const;
         int readMetadata(const MetadataIO::ArtworksSnapshot &snapshot) const;
+        int readMetadata(const MetadataIO::ArtworksSnapshot &snapshot, const QVector<quint32> &storageReadBatchIDs) const;
+        quint32 readMetadataFromStorage(const MetadataIO::ArtworksSnapshot &snapshot) const;
         int reimportMetadata(const MetadataIO::ArtworksSnapshot &snapshot) const;
         void writeMetadata(const MetadataIO::WeakArtworksSnapshot &artworks, bool useBackups) const;
         void wipeAllMetadata(const MetadataIO::ArtworksSnapshot &artworks, bool useBackups) const;
@@ -16,6 +16,7 @@
 #include <QDebug>
 #include <QDateTime>
 #include <QStandardPaths>
+#include <QAtomicInt>
 
 #define STRINGIZE_(x) #x
 #define STRINGIZE(x) STRINGIZE_(x)
@@ -27,8 +28,17 @@
 #define qInfo qDebug
 #endif
 
-#define LOG_DEBUG qDebug()
-#define LOG_INFO qInfo()
+namespace Common {
+    // 0 - debug, 1 - info, 2 - warning
+    // checked before anything is formatted for a log line
+    inline QAtomicInt &minimumLogSeverity() {
+        static QAtomicInt severity(0);
+        return severity;
+    }
+}
+
+#define LOG_DEBUG if (Common::minimumLogSeverity().load() > 0) {} else qDebug()
+#define LOG_INFO if (Common::minimumLogSeverity().load() > 1) {} else qInfo()
 
 #ifdef QT_DEBUG
 #define LOG_FOR_DEBUG qDebug()
@@ -11,29 +11,76 @@
 #ifndef ITEMPROCESSINGWORKER_H
 #define ITEMPROCESSINGWORKER_H
 
+// items processed by one executor task before it yields to other queues
+#define EXECUTOR_SLICE_ITEMS 16
+
 #include <QWaitCondition>
 #include <QMutex>
+#include <QAtomicInt>
+#include <QAtomicInteger>
+#include <QThread>
+#include <QHash>
+#include <QPair>
+#include <QSet>
 #include <deque>
 #include <memory>
 #include <vector>
-#include <tuple>
-#include <algorithm>
+#include <utility>
 #include "../Common/flags.h"
 #include "../Common/defines.h"
+#include "../Common/mpscqueue.h"
+#include "../Common/workstealingexecutor.h"
 #include "../Helpers/threadhelpers.h"
+#include "../Helpers/tracing.h"
+#include "../Helpers/metrics.h"
 
 namespace Common {
+    // producers only push to a lock-free queue and never wait for the consumer
+    // items are moved to the local deque by whoever holds m_QueueMutex
     template<typename T>
     class ItemProcessingWorker
     {
     public:
         typedef quint32 batch_id_t;
-        typedef std::tuple<std::shared_ptr<T>, Common::flag_t, batch_id_t> ItemType;
+        // identity of the target item and kind of the request
+        typedef QPair<quintptr, quint64> coalescing_key_t;
+
+    private:
+        struct QueueItem {
+            QueueItem():
+                m_Flags(0),
+                m_BatchID(INVALID_BATCH_ID),
+                m_Sequence(0),
+                m_SubmittedAtUs(0)
+            { }
+
+            QueueItem(const std::shared_ptr<T> &item, Common::flag_t flags, batch_id_t batchID):
+                m_Item(item),
+                m_Flags(flags),
+                m_BatchID(batchID),
+                m_Sequence(0),
+                m_SubmittedAtUs(Helpers::MetricsRegistry::getInstance().nowUs())
+            { }
+
+            std::shared_ptr<T> m_Item;
+            Common::flag_t m_Flags;
+            batch_id_t m_BatchID;
+            // 0 means the item is not coalesced
+            quint64 m_Sequence;
+            coalescing_key_t m_Key;
+            qint64 m_SubmittedAtUs;
+        };
 
     public:
         ItemProcessingWorker(int delayPeriod = 0xffffffff):
+            m_Metrics(nullptr),
+            m_Executor(nullptr),
+            m_Priority(Common::TaskPriority::Normal),
             m_BatchID(1),
+            m_NextSequence(1),
             m_DelayPeriod(delayPeriod),
+            m_IsScheduled(0),
+            m_PendingCount(0),
             m_Cancel(false),
             m_IsRunning(false)
         { }
@@ -44,31 +91,34 @@ namespace Common {
         enum WorkerFlags {
             FlagIsSeparator = 1 << 0,
             FlagIsStopper = 1 << 1,
-            FlagIsWithDelay = 1 << 2
+            FlagIsWithDelay = 1 << 2,
+            FlagIsWarmup = 1 << 3,
+            FlagIsFirst = 1 << 4
         };
 
     protected:
         inline bool getIsSeparatorFlag(Common::flag_t flags) const { return Common::HasFlag(flags, FlagIsSeparator); }
         inline bool getIsStopperFlag(Common::flag_t flags) const { return Common::HasFlag(flags, FlagIsStopper); }
         inline bool getWithDelayFlag(Common::flag_t flags) const { return Common::HasFlag(flags, FlagIsWithDelay); }
+        inline bool getIsWarmupFlag(Common::flag_t flags) const { return Common::HasFlag(flags, FlagIsWarmup); }
+        inline bool getIsFirstFlag(Common::flag_t flags) const { return Common::HasFlag(flags, FlagIsFirst); }
 
     public:
         void submitSeparator() {
             if (m_Cancel) { return; }
 
-            m_QueueMutex.lock();
-            {
-                Common::flag_t flags = 0;
-                Common::SetFlag(flags, FlagIsSeparator);
+            Common::flag_t flags = 0;
+            Common::SetFlag(flags, FlagIsSeparator);
+            enqueue(QueueItem(std::shared_ptr<T>(), flags, INVALID_BATCH_ID));
+        }
 
-                bool wasEmpty = m_Queue.empty();
-                m_Queue.emplace_back(std::shared_ptr<T>(), flags, INVALID_BATCH_ID);
+        // asks worker to do deferred initialization when it has nothing else to do
+        void submitWarmup() {
+            if (m_Cancel) { return; }
 
-                if (wasEmpty) {
-                    m_WaitAnyItem.wakeOne();
-                }
-            }
-            m_QueueMutex.unlock();
+            Common::flag_t flags = 0;
+            Common::SetFlag(flags, FlagIsWarmup);
+            enqueue(QueueItem(std::shared_ptr<T>(), flags, INVALID_BATCH_ID));
         }
 
         batch_id_t submitItem(const std::shared_ptr<T> &item) {
@@ -76,19 +126,10 @@ namespace Common {
                 return INVALID_BATCH_ID;
             }
 
-            batch_id_t batchID;
-            Common::flag_t flags = 0;
-            m_QueueMutex.lock();
-            {
-                batchID = getNextBatchID();
-                bool wasEmpty = m_Queue.empty();
-                m_Queue.emplace_back(item, flags, batchID);
-
-                if (wasEmpty) {
-                    m_WaitAnyItem.wakeOne();
-                }
-            }
-            m_QueueMutex.unlock();
+            const batch_id_t batchID = getNextBatchID();
+            QueueItem queueItem(item, 0, batchID);
+            assignSequence(queueItem);
+            enqueue(std::move(queueItem));
 
             return batchID;
         }
@@ -98,19 +139,13 @@ namespace Common {
                 return INVALID_BATCH_ID;
             }
 
-            batch_id_t batchID;
             Common::flag_t flags = 0;
-            m_QueueMutex.lock();
-            {
-                batchID = getNextBatchID();
-                bool wasEmpty = m_Queue.empty();
-                m_Queue.emplace_front(item, flags, batchID);
+            Common::SetFlag(flags, FlagIsFirst);
 
-                if (wasEmpty) {
-                    m_WaitAnyItem.wakeOne();
-                }
-            }
-            m_QueueMutex.unlock();
+            const batch_id_t batchID = getNextBatchID();
+            QueueItem queueItem(item, flags, batchID);
+            assignSequence(queueItem);
+            enqueue(std::move(queueItem));
 
             return batchID;
         }
@@ -120,28 +155,27 @@ namespace Common {
                 return INVALID_BATCH_ID;
             }
 
-            batch_id_t batchID;
+            const batch_id_t batchID = getNextBatchID();
             Common::flag_t commonFlags = 0;
-            m_QueueMutex.lock();
-            {
-                batchID = getNextBatchID();
-                bool wasEmpty = m_Queue.empty();
 
-                const size_t size = items.size();
-                for (size_t i = 0; i < size; ++i) {
-                    auto &item = items.at(i);
+            const size_t size = items.size();
+            std::vector<QueueItem> queueItems;
+            queueItems.reserve(size);
 
-                    Common::flag_t flags = commonFlags;
-                    if (i % m_DelayPeriod == 0) { Common::SetFlag(flags, FlagIsWithDelay); }
+            for (size_t i = 0; i < size; ++i) {
+                Common::flag_t flags = commonFlags;
+                if (i % m_DelayPeriod == 0) { Common::SetFlag(flags, FlagIsWithDelay); }
 
-                    m_Queue.emplace_back(item, flags, batchID);
-                }
+                queueItems.emplace_back(items.at(i), flags, batchID);
+                assignSequence(queueItems.back());
+            }
 
-                if (wasEmpty) {
-                    m_WaitAnyItem.wakeOne();
-                }
+            if (!queueItems.empty()) {
+                const int previousCount = m_PendingCount.fetchAndAddOrdered((int)size);
+                m_Incoming.pushMany(queueItems);
+                updateQueueDepth(previousCount + (int)size);
+                if (previousCount == 0) { wakeUpWorker(); }
             }
-            m_QueueMutex.unlock();
 
             return batchID;
         }
@@ -149,44 +183,31 @@ namespace Common {
         void cancelPendingJobs() {
             m_QueueMutex.lock();
             {
-                m_Queue.clear();
+                clearPendingItems();
             }
             m_QueueMutex.unlock();
 
             onQueueIsEmpty();
         }
 
+        // cancelled items are skipped when they reach the head of the queue
         void cancelBatch(batch_id_t batchID) {
             if (batchID == INVALID_BATCH_ID) { return; }
 
-            bool isEmpty = false;
-            m_QueueMutex.lock();
-            {
-                m_Queue.erase(std::remove_if(m_Queue.begin(), m_Queue.end(),
-                                             [&batchID](const ItemType &item) {
-                    return std::get<2>(item) == batchID;
-                }),
-                              m_Queue.end());
-
-                isEmpty = m_Queue.empty();
-            }
-            m_QueueMutex.unlock();
-
-            if (isEmpty) {
-                onQueueIsEmpty();
-            }
+            QMutexLocker locker(&m_QueueMutex);
+            m_CancelledBatches.insert(batchID);
         }
 
         bool hasPendingJobs() {
-            QMutexLocker locker(&m_QueueMutex);
-            bool isEmpty = m_Queue.empty();
-            return !isEmpty;
+            return m_PendingCount.load() > 0;
         }
 
         bool isCancelled() const { return m_Cancel; }
         bool isRunning() const { return m_IsRunning; }
 
         void doWork() {
+            initMetrics();
+
             if (initWorker()) {
                 m_IsRunning = true;
                 runWorkerLoop();
@@ -201,19 +222,34 @@ namespace Common {
         void stopWorking(bool immediately=true) {
             m_Cancel = true;
 
-            m_QueueMutex.lock();
-            {
-                if (immediately) {
-                    m_Queue.clear();
+            if (immediately) {
+                m_QueueMutex.lock();
+                {
+                    clearPendingItems();
                 }
+                m_QueueMutex.unlock();
+            }
 
-                Common::flag_t flags = 0;
-                Common::SetFlag(flags, FlagIsStopper);
+            Common::flag_t flags = 0;
+            Common::SetFlag(flags, FlagIsStopper);
+            enqueue(QueueItem(std::shared_ptr<T>(), flags, INVALID_BATCH_ID));
+        }
 
-                m_Queue.emplace_back(std::shared_ptr<T>(), flags, INVALID_BATCH_ID);
-                m_WaitAnyItem.wakeOne();
+        // runs the worker as a serial queue on the shared executor instead of a dedicated thread
+        // items are still processed one by one and in the order of submission
+        void doWorkOnExecutor(Common::TaskPriority priority) {
+            Common::WorkStealingExecutor *executor = &Common::WorkStealingExecutor::getInstance();
+            initMetrics();
+            m_Priority = priority;
+            // nothing else is scheduled until initialization is done
+            m_IsScheduled.storeRelease(1);
+            m_Executor.storeRelease(executor);
+
+            if (!executor->submit([this]() { initOnExecutor(); }, m_Priority)) {
+                LOG_WARNING << "Executor is stopped";
+                m_Cancel = true;
+                workerStopped();
             }
-            m_QueueMutex.unlock();
         }
 
         void waitIdle() {
@@ -226,6 +262,20 @@ namespace Common {
         virtual void onQueueIsEmpty() = 0;
         virtual void workerStopped() = 0;
 
+        // override to load heavy resources on idle instead of in initWorker()
+        virtual void warmupWorker() { }
+        // string literal used for tracing
+        virtual const char *getWorkerName() const { return "ItemProcessingWorker"; }
+        // has to be unique for workers running in a pool so their gauges do not overwrite each other
+        virtual QString getMetricsName() const { return QString::fromLatin1(getWorkerName()); }
+        // opt-in: a pending item is dropped when newer item with the same key is submitted
+        // called from producer threads so it should only look at immutable data of the item
+        virtual bool tryGetCoalescingKey(const std::shared_ptr<T> &item, coalescing_key_t &key) const {
+            Q_UNUSED(item);
+            Q_UNUSED(key);
+            return false;
+        }
+
         virtual void processOneItemEx(std::shared_ptr<T> &item, batch_id_t batchID, Common::flag_t flags) {
             Q_UNUSED(flags);
             Q_UNUSED(batchID);
@@ -241,62 +291,327 @@ namespace Common {
                     break;
                 }
 
-                bool noMoreItems = false;
-                std::shared_ptr<T> item;
-                Common::flag_t flags = 0;
-                batch_id_t batchID = INVALID_BATCH_ID;
+                QueueItem queueItem;
+                bool hasItem = false, anyDiscarded = false, noMoreItems = false;
 
                 m_QueueMutex.lock();
                 {
-                    while (m_Queue.empty()) {
+                    while (m_PendingCount.load() <= 0) {
                         bool waitResult = m_WaitAnyItem.wait(&m_QueueMutex);
                         if (!waitResult) {
                             LOG_WARNING << "Waiting failed for new items";
                         }
                     }
 
-                    auto &nextItem = m_Queue.front();
-                    item = std::get<0>(nextItem);
-                    flags = std::get<1>(nextItem);
-                    batchID = std::get<2>(nextItem);
-                    m_Queue.pop_front();
+                    hasItem = tryTakeItem(queueItem, anyDiscarded);
+                    noMoreItems = m_PendingCount.load() == 0;
+                }
+                m_QueueMutex.unlock();
+
+                if (!hasItem) {
+                    if (noMoreItems) {
+                        if (anyDiscarded) { onQueueIsEmpty(); }
+                    } else {
+                        // producer has not linked its item yet
+                        QThread::yieldCurrentThread();
+                    }
+
+                    continue;
+                }
+
+                if ((queueItem.m_Item.get() == nullptr) && getIsStopperFlag(queueItem.m_Flags)) { break; }
+
+                processItem(queueItem);
+
+                if (noMoreItems) {
+                    onQueueIsEmpty();
+                }
+            }
+        }
+
+    private:
+        void processItem(QueueItem &queueItem) {
+            std::shared_ptr<T> &item = queueItem.m_Item;
+            const Common::flag_t flags = queueItem.m_Flags;
+            Helpers::MetricsRegistry &metrics = Helpers::MetricsRegistry::getInstance();
+            const qint64 startUs = metrics.nowUs();
+
+            m_IdleEvent.reset();
+            {
+                TRACE_SPAN_CAT("worker", getWorkerName());
+
+                try {
+                    if ((item.get() == nullptr) && getIsWarmupFlag(flags)) {
+                        warmupWorker();
+                    } else {
+                        processOneItemEx(item, queueItem.m_BatchID, flags);
+                    }
+                }
+                catch (...) {
+                    LOG_WARNING << "Exception while processing item!";
+                }
+            }
+            m_IdleEvent.set();
+
+            Helpers::WorkerMetrics *workerMetrics = m_Metrics.loadAcquire();
+            if (workerMetrics != nullptr) {
+                workerMetrics->m_WaitTime->record(startUs - queueItem.m_SubmittedAtUs);
+                workerMetrics->m_ProcessingTime->record(metrics.nowUs() - startUs);
+                workerMetrics->m_Processed->add();
+            }
+        }
+
+        void initMetrics() {
+            Helpers::WorkerMetrics *metrics = Helpers::MetricsRegistry::getInstance().getWorkerMetrics(getMetricsName());
+            m_Metrics.storeRelease(metrics);
+        }
 
-                    noMoreItems = m_Queue.empty();
+        // producers update the depth too so the gauge shows the backlog
+        // even while the consumer is busy with a long item
+        void updateQueueDepth(int pendingCount) {
+            Helpers::WorkerMetrics *metrics = m_Metrics.loadAcquire();
+            if (metrics != nullptr) { metrics->m_QueueDepth->set(pendingCount); }
+        }
+
+        void enqueue(QueueItem &&queueItem) {
+            // counted before it is published so the consumer never sees negative count
+            const int previousCount = m_PendingCount.fetchAndAddOrdered(1);
+            m_Incoming.push(std::move(queueItem));
+            updateQueueDepth(previousCount + 1);
+            if (previousCount == 0) { wakeUpWorker(); }
+        }
+
+        void wakeUpWorker() {
+            Common::WorkStealingExecutor *executor = m_Executor.loadAcquire();
+            if (executor == nullptr) {
+                m_QueueMutex.lock();
+                {
+                    m_WaitAnyItem.wakeOne();
                 }
                 m_QueueMutex.unlock();
+            } else if (m_IsScheduled.testAndSetOrdered(0, 1)) {
+                executor->submit([this]() { processSlice(); }, m_Priority);
+            }
+        }
+
+        void assignSequence(QueueItem &queueItem) {
+            if (!tryGetCoalescingKey(queueItem.m_Item, queueItem.m_Key)) { return; }
+
+            QMutexLocker locker(&m_CoalescingLock);
+            queueItem.m_Sequence = m_NextSequence++;
+            m_LatestByKey[queueItem.m_Key] = queueItem.m_Sequence;
+        }
+
+        // returns false if newer item with the same key was submitted
+        bool takeSequence(const QueueItem &queueItem) {
+            if (queueItem.m_Sequence == 0) { return true; }
+
+            QMutexLocker locker(&m_CoalescingLock);
+            auto it = m_LatestByKey.find(queueItem.m_Key);
+            if ((it == m_LatestByKey.end()) || (it.value() != queueItem.m_Sequence)) { return false; }
+
+            m_LatestByKey.erase(it);
+            return true;
+        }
 
-                if ((item.get() == nullptr) && getIsStopperFlag(flags)) { break; }
+        void releaseSequence(const QueueItem &queueItem) {
+            if (queueItem.m_Sequence == 0) { return; }
 
-                m_IdleEvent.reset();
+            QMutexLocker locker(&m_CoalescingLock);
+            auto it = m_LatestByKey.find(queueItem.m_Key);
+            if ((it != m_LatestByKey.end()) && (it.value() == queueItem.m_Sequence)) {
+                m_LatestByKey.erase(it);
+            }
+        }
+
+        // should be called with locked m_QueueMutex
+        void drainIncoming() {
+            QueueItem queueItem;
+            while (m_Incoming.tryPop(queueItem)) {
+                if (getIsFirstFlag(queueItem.m_Flags)) {
+                    m_Queue.emplace_front(std::move(queueItem));
+                } else {
+                    m_Queue.emplace_back(std::move(queueItem));
+                }
+            }
+        }
+
+        // should be called with locked m_QueueMutex
+        bool tryTakeItem(QueueItem &queueItem, bool &anyDiscarded) {
+            drainIncoming();
+
+            bool found = false;
+            while (!m_Queue.empty()) {
+                queueItem = std::move(m_Queue.front());
+                m_Queue.pop_front();
+                m_PendingCount.fetchAndAddOrdered(-1);
+
+                if (m_CancelledBatches.contains(queueItem.m_BatchID)) {
+                    releaseSequence(queueItem);
+                    countDiscarded();
+                    anyDiscarded = true;
+                    continue;
+                }
+
+                if (!takeSequence(queueItem)) {
+                    countDiscarded();
+                    anyDiscarded = true;
+                    continue;
+                }
+
+                found = true;
+                break;
+            }
+
+            const int pendingCount = m_PendingCount.load();
+            // everything submitted before cancelBatch() was called is already taken
+            if (pendingCount == 0) {
+                m_CancelledBatches.clear();
+            }
+
+            Helpers::WorkerMetrics *metrics = m_Metrics.loadAcquire();
+            if (metrics != nullptr) {
+                metrics->m_QueueDepth->set(pendingCount);
+                metrics->m_Batches->set(m_BatchID.load() - 1);
+            }
+
+            return found;
+        }
+
+        void countDiscarded() {
+            Helpers::WorkerMetrics *metrics = m_Metrics.loadAcquire();
+            if (metrics != nullptr) { metrics->m_Discarded->add(); }
+        }
+
+        // should be called with locked m_QueueMutex
+        void clearPendingItems() {
+            drainIncoming();
+
+            std::deque<QueueItem> stoppers;
+            for (auto &queueItem: m_Queue) {
+                if (getIsStopperFlag(queueItem.m_Flags)) {
+                    stoppers.emplace_back(std::move(queueItem));
+                } else {
+                    releaseSequence(queueItem);
+                }
+            }
+
+            const int removedCount = (int)(m_Queue.size() - stoppers.size());
+            m_Queue.swap(stoppers);
+            m_PendingCount.fetchAndAddOrdered(-removedCount);
+
+            Helpers::WorkerMetrics *metrics = m_Metrics.loadAcquire();
+            if (metrics != nullptr) {
+                metrics->m_Discarded->add(removedCount);
+                metrics->m_QueueDepth->set(m_PendingCount.load());
+            }
+        }
+
+        void initOnExecutor() {
+            if (!initWorker()) {
+                m_Cancel = true;
+                workerStopped();
+                return;
+            }
+
+            m_IsRunning = true;
+            m_IdleEvent.set();
+
+            processSlice();
+        }
+
+        // processes a few items and reschedules itself if there is more work
+        void processSlice() {
+            for (int i = 0; i < EXECUTOR_SLICE_ITEMS; i++) {
+                if (m_Cancel) {
+                    LOG_INFO << "Cancelled. Exiting...";
+                    stopOnExecutor();
+                    return;
+                }
+
+                QueueItem queueItem;
+                bool hasItem = false, anyDiscarded = false, noMoreItems = false;
+
+                m_QueueMutex.lock();
                 {
-                    try {
-                        processOneItemEx(item, batchID, flags);
-                    }
-                    catch (...) {
-                        LOG_WARNING << "Exception while processing item!";
+                    hasItem = tryTakeItem(queueItem, anyDiscarded);
+                    noMoreItems = m_PendingCount.load() == 0;
+                }
+                m_QueueMutex.unlock();
+
+                if (!hasItem) {
+                    if (!noMoreItems) {
+                        // producer has not linked its item yet
+                        QThread::yieldCurrentThread();
+                        continue;
                     }
+
+                    if (anyDiscarded) { onQueueIsEmpty(); }
+
+                    m_IsScheduled.storeRelease(0);
+                    // producer could have seen the flag set right before it was reset
+                    if ((m_PendingCount.load() > 0) && m_IsScheduled.testAndSetOrdered(0, 1)) { continue; }
+
+                    return;
+                }
+
+                if ((queueItem.m_Item.get() == nullptr) && getIsStopperFlag(queueItem.m_Flags)) {
+                    stopOnExecutor();
+                    return;
                 }
-                m_IdleEvent.set();
+
+                processItem(queueItem);
 
                 if (noMoreItems) {
                     onQueueIsEmpty();
                 }
+
+                // instead of sleeping the pool thread, let other queues run before continuing
+                if (getWithDelayFlag(queueItem.m_Flags) || (m_Priority == Common::TaskPriority::Background)) {
+                    break;
+                }
             }
+
+            // m_IsScheduled is still set so nobody else could schedule this queue
+            if (!m_Executor.loadAcquire()->submit([this]() { processSlice(); }, m_Priority)) {
+                LOG_WARNING << "Executor is stopped";
+                stopOnExecutor();
+            }
+        }
+
+        void stopOnExecutor() {
+            m_IsRunning = false;
+            // worker can be deleted right after this call
+            workerStopped();
         }
 
     private:
         inline batch_id_t getNextBatchID() {
-            batch_id_t id = m_BatchID++;
+            batch_id_t id = m_BatchID.fetchAndAddOrdered(1);
             return id;
         }
 
     private:
         Helpers::ManualResetEvent m_IdleEvent;
         QWaitCondition m_WaitAnyItem;
+        Common::MpscQueue<QueueItem> m_Incoming;
+        // set before the first item is taken, read by producers and the consumer
+        QAtomicPointer<Helpers::WorkerMetrics> m_Metrics;
+        // guards consumer side: m_Incoming pops, m_Queue and m_CancelledBatches
         QMutex m_QueueMutex;
-        std::deque<ItemType> m_Queue;
-        batch_id_t m_BatchID;
+        std::deque<QueueItem> m_Queue;
+        QSet<batch_id_t> m_CancelledBatches;
+        QMutex m_CoalescingLock;
+        QHash<coalescing_key_t, quint64> m_LatestByKey;
+        QAtomicPointer<Common::WorkStealingExecutor> m_Executor;
+        Common::TaskPriority m_Priority;
+        QAtomicInteger<batch_id_t> m_BatchID;
+        quint64 m_NextSequence;
         unsigned int m_DelayPeriod;
+        // serial queue has a task in the executor
+        QAtomicInt m_IsScheduled;
+        // submitted but not yet taken items including ones not yet linked
+        QAtomicInt m_PendingCount;
         volatile bool m_Cancel;
         volatile bool m_IsRunning;
     };
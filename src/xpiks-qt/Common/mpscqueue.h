@@ -0,0 +1,99 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef MPSCQUEUE_H
+#define MPSCQUEUE_H
+
+#include <QAtomicPointer>
+#include <utility>
+#include <vector>
+
+namespace Common {
+    // unbounded multiple producers single consumer queue (D. Vyukov)
+    // producers never lock each other out, consumer calls have to be serialized
+    template<typename T>
+    class MpscQueue
+    {
+    private:
+        struct Node {
+            Node(): m_Next(nullptr) { }
+            Node(T &&value): m_Next(nullptr), m_Value(std::move(value)) { }
+
+            QAtomicPointer<Node> m_Next;
+            T m_Value;
+        };
+
+    public:
+        MpscQueue() {
+            Node *stub = new Node();
+            m_Head.store(stub);
+            m_Tail = stub;
+        }
+
+        virtual ~MpscQueue() {
+            T value;
+            while (tryPop(value)) { }
+            delete m_Tail;
+        }
+
+    private:
+        MpscQueue(MpscQueue const&);
+        void operator=(MpscQueue const&);
+
+    public:
+        void push(T &&value) {
+            Node *node = new Node(std::move(value));
+            link(node, node);
+        }
+
+        // items are published at once and stay contiguous
+        void pushMany(std::vector<T> &values) {
+            if (values.empty()) { return; }
+
+            Node *first = new Node(std::move(values.front()));
+            Node *last = first;
+
+            const size_t size = values.size();
+            for (size_t i = 1; i < size; i++) {
+                Node *node = new Node(std::move(values[i]));
+                last->m_Next.store(node);
+                last = node;
+            }
+
+            link(first, last);
+        }
+
+        // can return false while some push is in progress
+        bool tryPop(T &value) {
+            Node *tail = m_Tail;
+            Node *next = tail->m_Next.loadAcquire();
+            if (next == nullptr) { return false; }
+
+            value = std::move(next->m_Value);
+            // next becomes the new stub
+            m_Tail = next;
+            delete tail;
+
+            return true;
+        }
+
+    private:
+        void link(Node *first, Node *last) {
+            Node *previous = m_Head.fetchAndStoreOrdered(last);
+            previous->m_Next.storeRelease(first);
+        }
+
+    private:
+        QAtomicPointer<Node> m_Head;
+        Node *m_Tail;
+    };
+}
+
+#endif // MPSCQUEUE_H
@@ -0,0 +1,256 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "workstealingexecutor.h"
+#include <QThread>
+#include "defines.h"
+
+#define PRIORITIES_COUNT 3
+#define MIN_EXECUTOR_THREADS 2
+
+namespace Common {
+    // allows tasks scheduled from the executor thread to land in its own queue
+    static thread_local WorkStealingExecutor *tl_CurrentExecutor = nullptr;
+    static thread_local int tl_CurrentQueueIndex = -1;
+
+    class ExecutorThread: public QThread {
+    public:
+        ExecutorThread(WorkStealingExecutor *executor, int index):
+            m_Executor(executor),
+            m_Index(index)
+        { }
+
+    protected:
+        virtual void run() override {
+            m_Executor->runThread(m_Index);
+        }
+
+    private:
+        WorkStealingExecutor *m_Executor;
+        int m_Index;
+    };
+
+    WorkStealingExecutor::WorkStealingExecutor(int threadsCount):
+        m_BackgroundRunning(0),
+        m_NextQueue(0),
+        m_ThreadsCount(threadsCount > 0 ? threadsCount : qMax(MIN_EXECUTOR_THREADS, QThread::idealThreadCount())),
+        m_IsStarted(0),
+        m_IsStopped(false)
+    {
+        // background tasks should never occupy all threads
+        // so interactive requests always have somewhere to run
+        m_MaxBackgroundThreads = qMax(1, m_ThreadsCount - 1);
+
+        m_Queues.reserve(m_ThreadsCount);
+        for (int i = 0; i < m_ThreadsCount; i++) {
+            m_Queues.emplace_back(new WorkQueue());
+        }
+    }
+
+    WorkStealingExecutor::~WorkStealingExecutor() {
+        stop();
+    }
+
+    bool WorkStealingExecutor::submit(const Task &task, TaskPriority priority) {
+        if (m_IsStopped) { return false; }
+
+        ensureStarted();
+
+        const int p = (int)priority;
+        Q_ASSERT((0 <= p) && (p < PRIORITIES_COUNT));
+
+        int index = 0;
+        if (tl_CurrentExecutor == this) {
+            index = tl_CurrentQueueIndex;
+        } else {
+            index = (m_NextQueue.fetchAndAddRelaxed(1) & 0x7FFFFFFF) % m_ThreadsCount;
+        }
+
+        WorkQueue &queue = *m_Queues[index];
+        {
+            QMutexLocker locker(&queue.m_Lock);
+            queue.m_Tasks[p].push_back(task);
+        }
+
+        m_PendingCount[p].ref();
+
+        {
+            QMutexLocker locker(&m_SleepLock);
+            m_TasksAvailable.wakeOne();
+        }
+
+        return true;
+    }
+
+    void WorkStealingExecutor::stop() {
+        {
+            QMutexLocker locker(&m_SleepLock);
+            if (m_IsStopped) { return; }
+            m_IsStopped = true;
+            m_TasksAvailable.wakeAll();
+        }
+
+        QMutexLocker locker(&m_StartLock);
+        LOG_INFO << "Waiting for" << m_Threads.size() << "threads";
+
+        for (QThread *thread: m_Threads) {
+            thread->wait();
+            delete thread;
+        }
+
+        m_Threads.clear();
+    }
+
+    void WorkStealingExecutor::ensureStarted() {
+        if (m_IsStarted.loadAcquire() != 0) { return; }
+
+        QMutexLocker locker(&m_StartLock);
+        if (m_IsStarted.loadAcquire() != 0) { return; }
+
+        LOG_INFO << "Starting" << m_ThreadsCount << "threads";
+
+        m_Threads.reserve(m_ThreadsCount);
+        for (int i = 0; i < m_ThreadsCount; i++) {
+            QThread *thread = new ExecutorThread(this, i);
+            m_Threads.push_back(thread);
+            thread->start();
+        }
+
+        m_IsStarted.storeRelease(1);
+    }
+
+    void WorkStealingExecutor::runThread(int index) {
+        tl_CurrentExecutor = this;
+        tl_CurrentQueueIndex = index;
+        QThread *thread = QThread::currentThread();
+        bool isLowPriority = false;
+
+        for (;;) {
+            Task task;
+            int priority = 0;
+
+            if (tryTakeTask(index, task, priority)) {
+                // background services used to run on their own low priority threads
+                const bool isBackground = (priority == (int)TaskPriority::Background);
+                if (isBackground != isLowPriority) {
+                    thread->setPriority(isBackground ? QThread::LowPriority : QThread::NormalPriority);
+                    isLowPriority = isBackground;
+                }
+
+                try {
+                    task();
+                }
+                catch (...) {
+                    LOG_WARNING << "Exception while executing task!";
+                }
+
+                if (priority == (int)TaskPriority::Background) {
+                    m_BackgroundRunning.deref();
+                }
+
+                QMutexLocker locker(&m_SleepLock);
+                // freed background slot or the last task before stopping
+                if (m_IsStopped) {
+                    m_TasksAvailable.wakeAll();
+                } else if (priority == (int)TaskPriority::Background) {
+                    m_TasksAvailable.wakeOne();
+                }
+
+                continue;
+            }
+
+            QMutexLocker locker(&m_SleepLock);
+            bool shouldExit = false;
+
+            while (!hasRunnableTasks()) {
+                const bool anyPending = (m_PendingCount[0].load() > 0) ||
+                        (m_PendingCount[1].load() > 0) ||
+                        (m_PendingCount[2].load() > 0);
+
+                if (m_IsStopped && !anyPending) {
+                    shouldExit = true;
+                    break;
+                }
+
+                m_TasksAvailable.wait(&m_SleepLock);
+            }
+
+            if (shouldExit) { break; }
+        }
+
+        tl_CurrentExecutor = nullptr;
+        tl_CurrentQueueIndex = -1;
+    }
+
+    bool WorkStealingExecutor::tryTakeTask(int index, Task &task, int &priority) {
+        for (int p = 0; p < PRIORITIES_COUNT; p++) {
+            if (m_PendingCount[p].load() <= 0) { continue; }
+
+            const bool isBackground = (p == (int)TaskPriority::Background);
+            if (isBackground) {
+                if (m_BackgroundRunning.fetchAndAddOrdered(1) >= m_MaxBackgroundThreads) {
+                    m_BackgroundRunning.deref();
+                    continue;
+                }
+            }
+
+            if (tryPopOwn(index, p, task) || trySteal(index, p, task)) {
+                m_PendingCount[p].deref();
+                priority = p;
+                return true;
+            }
+
+            if (isBackground) {
+                m_BackgroundRunning.deref();
+            }
+        }
+
+        return false;
+    }
+
+    bool WorkStealingExecutor::tryPopOwn(int index, int priority, Task &task) {
+        WorkQueue &queue = *m_Queues[index];
+        QMutexLocker locker(&queue.m_Lock);
+
+        auto &tasks = queue.m_Tasks[priority];
+        if (tasks.empty()) { return false; }
+
+        // FIFO so that rescheduled serial queues do not starve others
+        task = std::move(tasks.front());
+        tasks.pop_front();
+        return true;
+    }
+
+    bool WorkStealingExecutor::trySteal(int index, int priority, Task &task) {
+        for (int i = 1; i < m_ThreadsCount; i++) {
+            WorkQueue &queue = *m_Queues[(index + i) % m_ThreadsCount];
+            QMutexLocker locker(&queue.m_Lock);
+
+            auto &tasks = queue.m_Tasks[priority];
+            if (tasks.empty()) { continue; }
+
+            task = std::move(tasks.front());
+            tasks.pop_front();
+            return true;
+        }
+
+        return false;
+    }
+
+    bool WorkStealingExecutor::canTakeBackground() const {
+        return m_BackgroundRunning.load() < m_MaxBackgroundThreads;
+    }
+
+    bool WorkStealingExecutor::hasRunnableTasks() const {
+        return (m_PendingCount[(int)TaskPriority::Interactive].load() > 0) ||
+                (m_PendingCount[(int)TaskPriority::Normal].load() > 0) ||
+                ((m_PendingCount[(int)TaskPriority::Background].load() > 0) && canTakeBackground());
+    }
+}
@@ -0,0 +1,93 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef WORKSTEALINGEXECUTOR_H
+#define WORKSTEALINGEXECUTOR_H
+
+#include <QWaitCondition>
+#include <QAtomicInt>
+#include <QMutex>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <deque>
+
+class QThread;
+
+namespace Common {
+    enum struct TaskPriority {
+        Interactive = 0,
+        Normal = 1,
+        Background = 2
+    };
+
+    // process-wide pool of threads shared by all background services
+    // every thread owns a queue per priority and steals from others when idle
+    class WorkStealingExecutor
+    {
+    public:
+        typedef std::function<void()> Task;
+
+    public:
+        static WorkStealingExecutor& getInstance()
+        {
+            static WorkStealingExecutor instance;
+            return instance;
+        }
+
+    public:
+        // 0 means "as many as cores"
+        WorkStealingExecutor(int threadsCount = 0);
+        virtual ~WorkStealingExecutor();
+
+    private:
+        WorkStealingExecutor(WorkStealingExecutor const&);
+        void operator=(WorkStealingExecutor const&);
+
+    public:
+        int getThreadsCount() const { return m_ThreadsCount; }
+        bool submit(const Task &task, TaskPriority priority);
+        // executes everything already submitted and joins threads
+        void stop();
+
+    private:
+        struct WorkQueue {
+            QMutex m_Lock;
+            std::deque<Task> m_Tasks[3];
+        };
+
+        void ensureStarted();
+        void runThread(int index);
+        bool tryTakeTask(int index, Task &task, int &priority);
+        bool tryPopOwn(int index, int priority, Task &task);
+        bool trySteal(int index, int priority, Task &task);
+        bool canTakeBackground() const;
+        bool hasRunnableTasks() const;
+
+    private:
+        friend class ExecutorThread;
+
+    private:
+        std::vector<std::unique_ptr<WorkQueue> > m_Queues;
+        std::vector<QThread *> m_Threads;
+        QMutex m_StartLock;
+        QMutex m_SleepLock;
+        QWaitCondition m_TasksAvailable;
+        QAtomicInt m_PendingCount[3];
+        QAtomicInt m_BackgroundRunning;
+        QAtomicInt m_NextQueue;
+        int m_ThreadsCount;
+        int m_MaxBackgroundThreads;
+        QAtomicInt m_IsStarted;
+        volatile bool m_IsStopped;
+    };
+}
+
+#endif // WORKSTEALINGEXECUTOR_H
@@ -24,6 +24,7 @@ namespace Connectivity {
 
     protected:
         virtual bool initWorker() override;
+        virtual const char *getWorkerName() const override { return "RequestsWorker"; }
         virtual void processOneItem(std::shared_ptr<ConnectivityRequest> &item) override;
 
     protected:
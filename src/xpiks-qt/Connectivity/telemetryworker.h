@@ -26,6 +26,7 @@ namespace Connectivity {
 
     protected:
         virtual bool initWorker() override;
+        virtual const char *getWorkerName() const override { return "TelemetryWorker"; }
         virtual void processOneItem(std::shared_ptr<AnalyticsUserEvent> &item) override;
 
     private:
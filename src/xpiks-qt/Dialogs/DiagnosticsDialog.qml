@@ -0,0 +1,231 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+import QtQuick 2.2
+import QtQuick.Controls 1.1
+import QtQuick.Layouts 1.1
+import QtQuick.Dialogs 1.1
+import QtQuick.Controls.Styles 1.1
+import QtGraphicalEffects 1.0
+import "../Constants"
+import "../Common.js" as Common;
+import "../Components"
+import "../StyledControls"
+import "../Constants/UIConfig.js" as UIConfig
+
+Item {
+    id: diagnosticsComponent
+    anchors.fill: parent
+
+    signal dialogDestruction();
+    Component.onDestruction: dialogDestruction();
+
+    function closePopup() {
+        diagnosticsComponent.destroy()
+    }
+
+    Component.onCompleted: {
+        focus = true
+        metricsModel.refresh()
+    }
+
+    Keys.onEscapePressed: closePopup()
+
+    PropertyAnimation { target: diagnosticsComponent; property: "opacity";
+        duration: 400; from: 0; to: 1;
+        easing.type: Easing.InOutQuad ; running: true }
+
+    Timer {
+        id: refreshTimer
+        interval: 1000
+        repeat: true
+        running: true
+        onTriggered: metricsModel.refresh()
+    }
+
+    // This rectange is the a overlay to partially show the parent through it
+    // and clicking outside of the 'dialog' popup will do 'nothing'
+    Rectangle {
+        anchors.fill: parent
+        id: overlay
+        color: "#000000"
+        opacity: 0.6
+        // add a mouse area so that clicks outside
+        // the dialog window will not do anything
+        MouseArea {
+            anchors.fill: parent
+        }
+    }
+
+    FocusScope {
+        anchors.fill: parent
+
+        MouseArea {
+            anchors.fill: parent
+            onWheel: wheel.accepted = true
+            onClicked: mouse.accepted = true
+            onDoubleClicked: mouse.accepted = true
+
+            property real old_x : 0
+            property real old_y : 0
+
+            onPressed:{
+                var tmp = mapToItem(diagnosticsComponent, mouse.x, mouse.y);
+                old_x = tmp.x;
+                old_y = tmp.y;
+
+                var dialogPoint = mapToItem(dialogWindow, mouse.x, mouse.y);
+                if (!Common.isInComponent(dialogPoint, dialogWindow)) {
+                    closePopup()
+                }
+            }
+
+            onPositionChanged: {
+                var old_xy = Common.movePopupInsideComponent(diagnosticsComponent, dialogWindow, mouse, old_x, old_y);
+                old_x = old_xy[0]; old_y = old_xy[1];
+            }
+        }
+
+        RectangularGlow {
+            anchors.fill: dialogWindow
+            anchors.topMargin: glowRadius/2
+            anchors.bottomMargin: -glowRadius/2
+            glowRadius: 4
+            spread: 0.0
+            color: uiColors.popupGlowColor
+            cornerRadius: glowRadius
+        }
+
+        // This rectangle is the actual popup
+        Rectangle {
+            id: dialogWindow
+            width: diagnosticsComponent.width * 0.75
+            height: diagnosticsComponent.height - 60
+            color: uiColors.popupBackgroundColor
+            anchors.centerIn: parent
+            Component.onCompleted: anchors.centerIn = undefined
+
+            RowLayout {
+                id: header
+                anchors.top: parent.top
+                anchors.left: parent.left
+                anchors.right: parent.right
+                anchors.topMargin: 20
+                anchors.leftMargin: 20
+                anchors.rightMargin: 20
+
+                StyledText {
+                    text: i18.n + qsTr("Diagnostics")
+                }
+
+                Item {
+                    Layout.fillWidth: true
+                }
+
+                StyledText {
+                    text: i18.n + qsTr("(updated every second)")
+                    isActive: false
+                }
+            }
+
+            Rectangle {
+                anchors.top: header.bottom
+                anchors.left: parent.left
+                anchors.right: parent.right
+                anchors.leftMargin: 20
+                anchors.rightMargin: 20
+                anchors.topMargin: 10
+                anchors.bottom: footer.top
+                anchors.bottomMargin: 20
+                color: uiColors.popupDarkInputBackground
+
+                StyledScrollView {
+                    id: scrollView
+                    anchors.fill: parent
+                    anchors.margins: 10
+
+                    ListView {
+                        id: metricsListView
+                        model: metricsModel
+                        spacing: 5
+
+                        delegate: Item {
+                            anchors.left: parent.left
+                            anchors.right: parent.right
+                            height: 20
+
+                            StyledText {
+                                id: metricNameText
+                                text: name
+                                width: 300
+                                elide: Text.ElideRight
+                                anchors.verticalCenter: parent.verticalCenter
+                                anchors.left: parent.left
+                            }
+
+                            StyledText {
+                                text: value
+                                anchors.verticalCenter: parent.verticalCenter
+                                anchors.left: metricNameText.right
+                                anchors.leftMargin: 10
+                                anchors.right: parent.right
+                                elide: Text.ElideRight
+                                isActive: kind !== "counter"
+                            }
+                        }
+                    }
+                }
+
+                Item {
+                    visible: metricsListView.count == 0
+                    anchors.fill: parent
+
+                    StyledText {
+                        text: i18.n + qsTr("No metrics collected yet")
+                        anchors.centerIn: parent
+                        isActive: false
+                    }
+                }
+            }
+
+            RowLayout {
+                id: footer
+                anchors.bottom: parent.bottom
+                anchors.bottomMargin: 20
+                anchors.left: parent.left
+                anchors.leftMargin: 20
+                anchors.right: parent.right
+                anchors.rightMargin: 20
+                height: 24
+                spacing: 20
+
+                StyledButton {
+                    text: i18.n + qsTr("Write to log")
+                    width: 130
+                    onClicked: {
+                        metricsModel.logSnapshot()
+                    }
+                }
+
+                Item {
+                    Layout.fillWidth: true
+                }
+
+                StyledButton {
+                    text: i18.n + qsTr("Close")
+                    width: 110
+                    onClicked: {
+                        closePopup()
+                    }
+                }
+            }
+        }
+    }
+}
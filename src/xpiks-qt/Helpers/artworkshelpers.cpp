@@ -12,6 +12,7 @@
 #include "../Models/artworkmetadata.h"
 #include "../Models/imageartwork.h"
 #include "../Models/videoartwork.h"
+#include <QFileInfo>
 #include "filehelpers.h"
 
 namespace Helpers {
@@ -105,6 +106,24 @@ namespace Helpers {
 
     int findAndAttachVectors(const MetadataIO::WeakArtworksSnapshot &artworksList, QVector<int> &modifiedIndices) {
         LOG_DEBUG << "#";
+        QSet<QString> directories;
+        for (auto *artwork: artworksList) {
+            Models::ImageArtwork *image = dynamic_cast<Models::ImageArtwork *>(artwork);
+            if ((image == NULL) || image->hasVectorAttached()) { continue; }
+
+            directories.insert(QFileInfo(image->getFilepath()).absolutePath());
+        }
+
+        // every directory is listed once instead of checking each candidate
+        QHash<QString, QHash<QString, QString> > vectors;
+        Helpers::listVectorsInDirectories(directories, vectors);
+
+        return findAndAttachVectors(artworksList, vectors, modifiedIndices);
+    }
+
+    int findAndAttachVectors(const MetadataIO::WeakArtworksSnapshot &artworksList,
+                             const QHash<QString, QHash<QString, QString> > &vectors,
+                             QVector<int> &modifiedIndices) {
         int attachedCount = 0;
         const size_t size = artworksList.size();
         modifiedIndices.reserve((int)size);
@@ -121,16 +140,11 @@ namespace Helpers {
                 continue;
             }
 
-            const QString &filepath = image->getFilepath();
-            QStringList vectors = Helpers::convertToVectorFilenames(filepath);
-
-            foreach (const QString &item, vectors) {
-                if (QFileInfo(item).exists()) {
-                    image->attachVector(item);
-                    attachedCount++;
-                    modifiedIndices.append((int)i);
-                    break;
-                }
+            const QString vectorPath = Helpers::findVectorForImage(image->getFilepath(), vectors);
+            if (!vectorPath.isEmpty()) {
+                image->attachVector(vectorPath);
+                attachedCount++;
+                modifiedIndices.append((int)i);
             }
         }
 
@@ -12,6 +12,8 @@
 #define ARTWORKSHELPERS_H
 
 #include <QVector>
+#include <QHash>
+#include <QString>
 #include <vector>
 #include <memory>
 #include "../MetadataIO/artworkssnapshot.h"
@@ -31,6 +33,10 @@ namespace Helpers {
     int retrieveImagesCount(const std::vector<std::shared_ptr<Models::ArtworkMetadataLocker> > &rawSnapshot);
     int retrieveVideosCount(const std::vector<std::shared_ptr<Models::ArtworkMetadataLocker> > &rawSnapshot);
     int findAndAttachVectors(const MetadataIO::WeakArtworksSnapshot &artworksList, QVector<int> &modifiedIndices);
+    // directory -> (lowercase filename -> vector path) when directories are already listed
+    int findAndAttachVectors(const MetadataIO::WeakArtworksSnapshot &artworksList,
+                             const QHash<QString, QHash<QString, QString> > &vectors,
+                             QVector<int> &modifiedIndices);
 }
 
 #endif // ARTWORKSHELPERS_H
@@ -9,12 +9,14 @@
  */
 
 #include "asynccoordinator.h"
+#include "tracing.h"
 
 namespace Helpers {
     AsyncCoordinator::AsyncCoordinator():
         QObject(),
         m_OpCount(1),
-        m_StatusReported(0)
+        m_StatusReported(0),
+        m_StartedAtUs(Tracer::getInstance().nowUs())
     {
         m_Timer.setSingleShot(true);
         QObject::connect(&m_Timer, &QTimer::timeout, this, &AsyncCoordinator::onTimeout);
@@ -23,6 +25,7 @@ namespace Helpers {
     void AsyncCoordinator::reset() {
         m_OpCount.store(1);
         m_StatusReported.store(0);
+        m_StartedAtUs = Tracer::getInstance().nowUs();
     }
 
     void AsyncCoordinator::allBegun(int timeoutSeconds) {
@@ -53,6 +56,13 @@ namespace Helpers {
 
     void AsyncCoordinator::reportStatus(AsyncCoordinator::CoordinationStatus status) {
         if (0 == m_StatusReported.fetchAndStoreOrdered(1)) {
+            Tracer &tracer = Tracer::getInstance();
+            if (tracer.isEnabled()) {
+                const char *name = (status == AllDone) ? "AsyncCoordinator (done)" :
+                                   (status == Timeout) ? "AsyncCoordinator (timeout)" : "AsyncCoordinator (cancel)";
+                tracer.addEvent(name, "coordinator", m_StartedAtUs, tracer.nowUs() - m_StartedAtUs);
+            }
+
             emit statusReported((int)status);
         }
     }
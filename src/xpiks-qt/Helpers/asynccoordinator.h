@@ -50,6 +50,7 @@ namespace Helpers {
         QTimer m_Timer;
         QAtomicInt m_OpCount;
         QAtomicInt m_StatusReported;
+        qint64 m_StartedAtUs;
     };
 
     class AsyncCoordinatorStartParams: public Common::ServiceStartParams {
@@ -45,6 +45,8 @@ namespace Constants {
     const char IMAGE_CACHE_TABLE[] = "imgcache";
     const char VIDEO_CACHE_TABLE[] = "vidcache";
     const char METADATA_CACHE_TABLE[] = "metadatacache";
+    const char METADATA_FINGERPRINTS_TABLE[] = "metadatafingerprints";
+    const char KEYWORDS_COOCCURRENCE_TABLE[] = "keywordscooccurrence";
 
     // different for DEBUG and RELEASE
 
@@ -85,6 +87,7 @@ namespace Constants {
     const char IMAGECACHE_DB_NAME[] = "imgcache.db";
     const char VIDEOCACHE_DB_NAME[] = "videocache.db";
     const char METADATA_CACHE_DB_NAME[] = "metadatacache.db";
+    const char AUTOCOMPLETE_INDEX_FILENAME[] = "ac_wordlist.index";
     const char LOGS_DIR[] = "logs";
 #else
     // common for DEBUG and INTEGRATION_TESTS
@@ -128,6 +131,7 @@ namespace Constants {
     const char IMAGECACHE_DB_NAME[] = "tests_imgcache.db";
     const char VIDEOCACHE_DB_NAME[] = "tests_videocache.db";
     const char METADATA_CACHE_DB_NAME[] = "tests_metadatacache.db";
+    const char AUTOCOMPLETE_INDEX_FILENAME[] = "tests_ac_wordlist.index";
     const char LOGS_DIR[] = "tests_logs";
 #else
     const char UPLOAD_HOSTS[] = "DEBUG_UPLOAD_HOSTS_HASH";
@@ -143,6 +147,7 @@ namespace Constants {
     const char IMAGECACHE_DB_NAME[] = "debug_imgcache.db";
     const char VIDEOCACHE_DB_NAME[] = "debug_videocache.db";
     const char METADATA_CACHE_DB_NAME[] = "debug_metadatacache.db";
+    const char AUTOCOMPLETE_INDEX_FILENAME[] = "debug_ac_wordlist.index";
     const char LOGS_DIR[] = "debug_logs";
 #endif
 #endif // QT_NO_DEBUG
@@ -174,6 +179,7 @@ namespace Constants {
     const char recentDirectories[] = "recentDirectories";
     const char recentFiles[] = "recentFiles";
     const char maxParallelUploads[] = "maxParallelUploads";
+    const char maxParallelVideoThumbnails[] = "maxParallelVideoThumbnails";
     const char useSpellCheck[] = "useSpellCheck";
     const char detectDuplicates[] = "detectDuplicates";
     const char userAgentId[] = "userAgentId";
@@ -21,6 +21,8 @@
 
 #define MEGABYTE (1024*1024)
 #define MAX_BLOB_BYTES (10*MEGABYTE)
+// well below default SQLITE_MAX_VARIABLE_NUMBER
+#define GET_MANY_KEYS_COUNT 100
 
 namespace Helpers {
     QString ensureDBDirectoryExists(const QString &dbDirName) {
@@ -113,8 +115,9 @@ namespace Helpers {
         }
     }
 
-    Database::Database(int id, AsyncCoordinator *finalizeCoordinator):
+    Database::Database(int id, AsyncCoordinator *finalizeCoordinator, Common::flag_t flags):
         m_ID(id),
+        m_Flags(flags),
         m_FinalizeCoordinator(finalizeCoordinator),
         m_Database(nullptr),
         m_IsOpened(false)
@@ -158,8 +161,12 @@ namespace Helpers {
         bool anyError = false;
 
         int flags = 0;
-        flags |= SQLITE_OPEN_READWRITE;
-        flags |= SQLITE_OPEN_CREATE;
+        if (getIsReadOnlyFlag()) {
+            flags |= SQLITE_OPEN_READONLY;
+        } else {
+            flags |= SQLITE_OPEN_READWRITE;
+            flags |= SQLITE_OPEN_CREATE;
+        }
         flags |= SQLITE_OPEN_FULLMUTEX;
 
         const int result = sqlite3_open_v2(fullDbPath, &m_Database, flags, nullptr);
@@ -189,12 +196,22 @@ namespace Helpers {
         Q_ASSERT(m_IsOpened);
         Q_ASSERT(m_Database != nullptr);
 
+        if (getIsReadOnlyFlag()) {
+            // journal mode is persistent and was set by the writing connection
+            executeStatement("PRAGMA cache_size = -20000;");
+            executeStatement("PRAGMA case_sensitive_like = true;");
+            executeStatement("PRAGMA query_only = true;");
+            return true;
+        }
+
         executeStatement("PRAGMA auto_vacuum = 0;");
         executeStatement("PRAGMA cache_size = -20000;");
         executeStatement("PRAGMA case_sensitive_like = true;");
         executeStatement("PRAGMA encoding = \"UTF-8\";");
         executeStatement("PRAGMA journal_mode = WAL;");
-        executeStatement("PRAGMA locking_mode = EXCLUSIVE;");
+        if (!getAllowReadersFlag()) {
+            executeStatement("PRAGMA locking_mode = EXCLUSIVE;");
+        }
         executeStatement("PRAGMA synchronous = NORMAL;");
         // executeStatement("PRAGMA quick_check;");
 
@@ -221,12 +238,17 @@ namespace Helpers {
         LOG_DEBUG << "#" << m_ID << name;
         std::shared_ptr<Database::Table> table;
 
-        QString createSql = QString("CREATE TABLE IF NOT EXISTS %1 ("
-                                    "key BLOB PRIMARY KEY NOT NULL,"
-                                    "value BLOB);").arg(name);
-        std::string createStr = createSql.toStdString();
+        int rc = SQLITE_OK;
+
+        if (!getIsReadOnlyFlag()) {
+            QString createSql = QString("CREATE TABLE IF NOT EXISTS %1 ("
+                                        "key BLOB PRIMARY KEY NOT NULL,"
+                                        "value BLOB);").arg(name);
+            std::string createStr = createSql.toStdString();
+
+            rc = sqlite3_exec(m_Database, createStr.c_str(), nullptr, nullptr, nullptr);
+        }
 
-        int rc = sqlite3_exec(m_Database, createStr.c_str(), nullptr, nullptr, nullptr);
         if (rc == SQLITE_OK) {
             table.reset(new Database::Table(m_Database, name));
 
@@ -248,6 +270,7 @@ namespace Helpers {
         m_TableName(tableName),
         m_Database(database),
         m_GetStatement(nullptr),
+        m_GetManyStatement(nullptr),
         m_SetStatement(nullptr),
         m_AddStatement(nullptr),
         m_DelStatement(nullptr),
@@ -273,6 +296,16 @@ namespace Helpers {
                 break;
             }
 
+            QString parameters = QString("?,").repeated(GET_MANY_KEYS_COUNT);
+            parameters.chop(1);
+            std::string selectManyStr = QString("SELECT key, value FROM %1 WHERE key IN (%2)").arg(m_TableName).arg(parameters).toStdString();
+            rc = sqlite3_prepare_v2(m_Database, selectManyStr.c_str(), -1, &m_GetManyStatement, 0);
+            if (rc != SQLITE_OK) {
+                LOG_WARNING << "Failed to prepare GET MANY statement:" << sqlite3_errstr(rc);
+                anyError = true;
+                break;
+            }
+
             std::string insertStr = QString("INSERT OR REPLACE INTO %1 (key, value) VALUES (?, ?)").arg(m_TableName).toStdString();
             rc = sqlite3_prepare_v2(m_Database, insertStr.c_str(), -1, &m_SetStatement, 0);
             if (rc != SQLITE_OK) {
@@ -313,6 +346,7 @@ namespace Helpers {
         LOG_DEBUG << m_TableName;
 
         finalizeSqliteStatement(m_GetStatement);
+        finalizeSqliteStatement(m_GetManyStatement);
         finalizeSqliteStatement(m_SetStatement);
         finalizeSqliteStatement(m_AddStatement);
         finalizeSqliteStatement(m_DelStatement);
@@ -357,6 +391,62 @@ namespace Helpers {
         return success;
     }
 
+    int Database::Table::tryGetMany(const QVector<QByteArray> &keysList, QVector<QByteArray> &valuesList) {
+        Q_ASSERT(m_GetManyStatement != nullptr);
+        LOG_DEBUG << keysList.size() << "key(s)";
+
+        const int size = keysList.size();
+        valuesList.clear();
+        valuesList.resize(size);
+
+        int foundCount = 0;
+        QMultiHash<QByteArray, int> keyIndices;
+        keyIndices.reserve(GET_MANY_KEYS_COUNT);
+
+        for (int start = 0; start < size; start += GET_MANY_KEYS_COUNT) {
+            const int end = qMin(start + GET_MANY_KEYS_COUNT, size);
+            keyIndices.clear();
+            bool anyError = false;
+
+            for (int i = start; i < end; i++) {
+                const QByteArray &key = keysList[i];
+                Q_ASSERT(!key.isEmpty());
+                keyIndices.insert(key, i);
+
+                if (!bindSqliteBlob(m_GetManyStatement, i - start + 1, key)) {
+                    anyError = true;
+                    break;
+                }
+            }
+
+            // unused parameters of the last chunk stay NULL and match nothing
+            if (!anyError) {
+                int rc = 0;
+                while (SQLITE_ROW == (rc = sqlite3_step(m_GetManyStatement))) {
+                    QByteArray key, value;
+
+                    if (!readSqliteBlob(m_GetManyStatement, 0, key)) { continue; }
+                    if (!readSqliteBlob(m_GetManyStatement, 1, value)) { continue; }
+
+                    auto it = keyIndices.find(key);
+                    while ((it != keyIndices.end()) && (it.key() == key)) {
+                        valuesList[it.value()] = value;
+                        foundCount++;
+                        ++it;
+                    }
+                }
+
+                if (rc != SQLITE_DONE) {
+                    LOG_WARNING << "Failed to step GET MANY statement. Error:" << sqlite3_errstr(rc);
+                }
+            }
+
+            cleanupSqliteStatement(m_GetManyStatement);
+        }
+
+        return foundCount;
+    }
+
     bool Database::Table::trySetValue(const QByteArray &key, const QByteArray &value) {
         Q_ASSERT(m_SetStatement != nullptr);
         Q_ASSERT(!key.isEmpty());
@@ -600,12 +690,12 @@ namespace Helpers {
         m_Initialized = false;
     }
 
-    std::shared_ptr<Database> DatabaseManager::openDatabase(const QString &dbName) {
+    std::shared_ptr<Database> DatabaseManager::openDatabase(const QString &dbName, Common::flag_t flags) {
         Q_ASSERT(m_Initialized);
-        LOG_DEBUG << dbName;
+        LOG_DEBUG << dbName << "flags:" << flags;
 
         const int id = getNextID();
-        std::shared_ptr<Database> db(new Database(id, &m_FinalizeCoordinator));
+        std::shared_ptr<Database> db(new Database(id, &m_FinalizeCoordinator, flags));
 
         QDir databasesDir(m_DBDirPath);
         Q_ASSERT(databasesDir.exists());
@@ -25,6 +25,7 @@
 #include <functional>
 #include "asynccoordinator.h"
 #include "../Common/defines.h"
+#include "../Common/flags.h"
 
 struct sqlite3;
 struct sqlite3_stmt;
@@ -45,13 +46,38 @@ namespace Helpers {
         }
     }
 
+    template<class TValue>
+    void restoreFailedItems(QHash<QByteArray, TValue> &hash, QVector<QPair<QByteArray, QByteArray> > &keyValuesList, const QVector<int> &failedIndices) {
+        for (auto &index: failedIndices) {
+            auto &keyValuePair = keyValuesList[index];
+
+            TValue value;
+            QByteArray &rawData = keyValuePair.second;
+            QDataStream ds(&rawData, QIODevice::ReadOnly);
+            ds >> value;
+
+            hash.insert(keyValuePair.first, value);
+        }
+    }
+
     // super simple wrapper over sqlite
     // to make it look like a key-value storage
     class Database {
     public:
-        Database(int id, AsyncCoordinator *finalizeCoordinator);
+        enum DatabaseFlags {
+            // other connections are allowed to read while this one writes
+            FlagAllowReaders = 1 << 0,
+            FlagReadOnly = 1 << 1
+        };
+
+    public:
+        Database(int id, AsyncCoordinator *finalizeCoordinator, Common::flag_t flags = 0);
         virtual ~Database();
 
+    private:
+        inline bool getAllowReadersFlag() const { return Common::HasFlag(m_Flags, FlagAllowReaders); }
+        inline bool getIsReadOnlyFlag() const { return Common::HasFlag(m_Flags, FlagReadOnly); }
+
     private:
         class Transaction {
         public:
@@ -74,6 +100,8 @@ namespace Helpers {
 
         public:
             bool tryGetValue(const QByteArray &key, QByteArray &value);
+            // values are returned in the order of keys, missing ones are left empty
+            int tryGetMany(const QVector<QByteArray> &keysList, QVector<QByteArray> &valuesList);
             bool trySetValue(const QByteArray &key, const QByteArray &value);
             bool tryAddValue(const QByteArray &key, const QByteArray &value);
             bool trySetMany(const QVector<QPair<QByteArray, QByteArray> > &keyValueList, QVector<int> &failedIndices);
@@ -86,6 +114,7 @@ namespace Helpers {
             QString m_TableName;
             sqlite3 *m_Database;
             sqlite3_stmt *m_GetStatement;
+            sqlite3_stmt *m_GetManyStatement;
             sqlite3_stmt *m_SetStatement;
             sqlite3_stmt *m_AddStatement;
             sqlite3_stmt *m_DelStatement;
@@ -106,6 +135,7 @@ namespace Helpers {
 
     private:
         int m_ID;
+        Common::flag_t m_Flags;
         AsyncCoordinator *m_FinalizeCoordinator;
         sqlite3 *m_Database;
         std::vector<std::shared_ptr<Table> > m_Tables;
@@ -130,7 +160,7 @@ namespace Helpers {
         int closeEnvironment();
 
     public:
-        std::shared_ptr<Database> openDatabase(const QString &dbName);
+        std::shared_ptr<Database> openDatabase(const QString &dbName, Common::flag_t flags = 0);
 
     public:
         void prepareToFinalize();
@@ -238,6 +268,17 @@ namespace Helpers {
             return m_WriteAheadLog.size();
         }
 
+        void forEach(const std::function<void (const TKey &, const TValue &)> &action) {
+            QReadLocker locker(&m_LockWAL);
+            Q_UNUSED(locker);
+
+            auto it = m_WriteAheadLog.constBegin();
+            auto itEnd = m_WriteAheadLog.constEnd();
+            for (; it != itEnd; ++it) {
+                action(it.key(), it.value());
+            }
+        }
+
     protected:
         virtual QByteArray keyToByteArray(const TKey &key) const = 0;
         virtual bool doFlush(std::shared_ptr<Database::Table> &dbTable, const QVector<QPair<QByteArray, QByteArray> > &keyValuesList, QVector<int> &failedIndices) = 0;
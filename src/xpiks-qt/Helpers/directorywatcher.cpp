@@ -0,0 +1,202 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "directorywatcher.h"
+#include <QDir>
+#include <QFileInfo>
+#include "../Common/defines.h"
+
+#define DIRECTORY_CHANGES_COALESCE_INTERVAL 300
+
+namespace Helpers {
+    QString normalizeFilename(const QString &filename) {
+#if defined(Q_OS_WIN) || defined(Q_OS_MAC)
+        // file systems are case insensitive by default
+        return filename.toLower();
+#else
+        return filename;
+#endif
+    }
+
+    DirectoryWatcher::DirectoryWatcher(QObject *parent):
+        QObject(parent),
+        m_TrackedFilesCount(0)
+    {
+        QObject::connect(&m_DirectoriesWatcher, &QFileSystemWatcher::directoryChanged,
+                         this, &DirectoryWatcher::onDirectoryChanged);
+
+        m_CoalesceTimer.setInterval(DIRECTORY_CHANGES_COALESCE_INTERVAL);
+        m_CoalesceTimer.setSingleShot(true);
+        QObject::connect(&m_CoalesceTimer, &QTimer::timeout, this, &DirectoryWatcher::onCoalesceTimer);
+    }
+
+    void DirectoryWatcher::addFiles(const QStringList &filePaths) {
+        QStringList newDirectories;
+
+        for (auto &filePath: filePaths) {
+            trackFile(filePath, newDirectories);
+        }
+
+        if (!newDirectories.isEmpty()) {
+            LOG_DEBUG << "Watching" << newDirectories.size() << "new directory(ies)";
+            m_DirectoriesWatcher.addPaths(newDirectories);
+        }
+    }
+
+    void DirectoryWatcher::addFile(const QString &filePath) {
+        addFiles(QStringList() << filePath);
+    }
+
+    void DirectoryWatcher::removeFiles(const QStringList &filePaths) {
+        QStringList emptyDirectories;
+
+        for (auto &filePath: filePaths) {
+            untrackFile(filePath, emptyDirectories);
+        }
+
+        if (!emptyDirectories.isEmpty()) {
+            LOG_DEBUG << "Unwatching" << emptyDirectories.size() << "directory(ies)";
+            m_DirectoriesWatcher.removePaths(emptyDirectories);
+        }
+    }
+
+    void DirectoryWatcher::removeFile(const QString &filePath) {
+        removeFiles(QStringList() << filePath);
+    }
+
+    void DirectoryWatcher::clear() {
+        LOG_DEBUG << "#";
+        m_CoalesceTimer.stop();
+
+        QStringList directories = m_DirectoriesWatcher.directories();
+        if (!directories.isEmpty()) {
+            m_DirectoriesWatcher.removePaths(directories);
+        }
+
+        m_TrackedFiles.clear();
+        m_ChangedDirectories.clear();
+        m_MissingFiles.clear();
+        m_TrackedFilesCount = 0;
+    }
+
+    bool DirectoryWatcher::isTracked(const QString &filePath) const {
+        QFileInfo fi(filePath);
+        auto it = m_TrackedFiles.constFind(fi.absolutePath());
+        if (it == m_TrackedFiles.constEnd()) { return false; }
+        return it->contains(normalizeFilename(fi.fileName()));
+    }
+
+    void DirectoryWatcher::onDirectoryChanged(const QString &directoryPath) {
+        if (!m_TrackedFiles.contains(directoryPath)) { return; }
+
+        m_ChangedDirectories.insert(directoryPath);
+        // many events come at once when files are moved or deleted
+        if (!m_CoalesceTimer.isActive()) {
+            m_CoalesceTimer.start();
+        }
+    }
+
+    void DirectoryWatcher::onCoalesceTimer() {
+        LOG_INFO << m_ChangedDirectories.size() << "directory(ies) changed";
+
+        QStringList unavailableFiles, changedFiles;
+
+        for (auto &directoryPath: m_ChangedDirectories) {
+            checkDirectory(directoryPath, unavailableFiles, changedFiles);
+        }
+
+        m_ChangedDirectories.clear();
+
+        if (!unavailableFiles.isEmpty()) {
+            LOG_INFO << unavailableFiles.size() << "file(s) became unavailable";
+            emit filesUnavailable(unavailableFiles);
+        }
+
+        if (!changedFiles.isEmpty()) {
+            emit filesChanged(changedFiles);
+        }
+    }
+
+    bool DirectoryWatcher::trackFile(const QString &filePath, QStringList &newDirectories) {
+        if (filePath.isEmpty()) { return false; }
+
+        QFileInfo fi(filePath);
+        const QString directoryPath = fi.absolutePath();
+
+        auto it = m_TrackedFiles.find(directoryPath);
+        if (it == m_TrackedFiles.end()) {
+            it = m_TrackedFiles.insert(directoryPath, QHash<QString, QString>());
+            newDirectories.append(directoryPath);
+        }
+
+        const QString key = normalizeFilename(fi.fileName());
+        if (it->contains(key)) { return false; }
+
+        it->insert(key, filePath);
+        m_TrackedFilesCount++;
+        return true;
+    }
+
+    bool DirectoryWatcher::untrackFile(const QString &filePath, QStringList &emptyDirectories) {
+        QFileInfo fi(filePath);
+        const QString directoryPath = fi.absolutePath();
+
+        auto it = m_TrackedFiles.find(directoryPath);
+        if (it == m_TrackedFiles.end()) { return false; }
+
+        if (it->remove(normalizeFilename(fi.fileName())) == 0) { return false; }
+        m_TrackedFilesCount--;
+        m_MissingFiles.remove(filePath);
+
+        if (it->isEmpty()) {
+            m_TrackedFiles.erase(it);
+            m_ChangedDirectories.remove(directoryPath);
+            emptyDirectories.append(directoryPath);
+        }
+
+        return true;
+    }
+
+    void DirectoryWatcher::checkDirectory(const QString &directoryPath, QStringList &unavailableFiles, QStringList &changedFiles) {
+        auto it = m_TrackedFiles.constFind(directoryPath);
+        if (it == m_TrackedFiles.constEnd()) { return; }
+
+        const QHash<QString, QString> &trackedFiles = it.value();
+        QDir directory(directoryPath);
+        // single listing instead of checking every tracked file
+        const QStringList entries = directory.exists() ?
+                    directory.entryList(QDir::Files | QDir::Hidden | QDir::System) :
+                    QStringList();
+
+        QSet<QString> existingFiles;
+        existingFiles.reserve(entries.size());
+        for (auto &entry: entries) {
+            existingFiles.insert(normalizeFilename(entry));
+        }
+
+        for (auto fileIt = trackedFiles.constBegin(), fileEnd = trackedFiles.constEnd(); fileIt != fileEnd; ++fileIt) {
+            const QString &filePath = fileIt.value();
+
+            if (existingFiles.contains(fileIt.key())) {
+                if (m_MissingFiles.remove(filePath)) {
+                    changedFiles.append(filePath);
+                }
+            } else if (!m_MissingFiles.contains(filePath)) {
+                m_MissingFiles.insert(filePath);
+                unavailableFiles.append(filePath);
+            }
+        }
+
+        // directory watch is dropped by the system when directory is removed
+        if (!entries.isEmpty() && !m_DirectoriesWatcher.directories().contains(directoryPath)) {
+            m_DirectoriesWatcher.addPath(directoryPath);
+        }
+    }
+}
@@ -0,0 +1,71 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef DIRECTORYWATCHER_H
+#define DIRECTORYWATCHER_H
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QSet>
+#include <QTimer>
+#include <QFileSystemWatcher>
+
+namespace Helpers {
+    // Watches only containing directories of tracked files so that
+    // big sessions do not exhaust per-file watches (inotify on Linux).
+    // Changes of directories are coalesced and checked in batches
+    // by listing each changed directory once
+    class DirectoryWatcher: public QObject
+    {
+        Q_OBJECT
+    public:
+        explicit DirectoryWatcher(QObject *parent = 0);
+
+    public:
+        void addFiles(const QStringList &filePaths);
+        void addFile(const QString &filePath);
+        void removeFiles(const QStringList &filePaths);
+        void removeFile(const QString &filePath);
+        void clear();
+
+    public:
+        int getTrackedFilesCount() const { return m_TrackedFilesCount; }
+        int getWatchedDirectoriesCount() const { return m_TrackedFiles.size(); }
+        bool isTracked(const QString &filePath) const;
+
+    signals:
+        // tracked files which disappeared from their directories
+        void filesUnavailable(const QStringList &filePaths);
+        // tracked files which became available again
+        void filesChanged(const QStringList &filePaths);
+
+    private slots:
+        void onDirectoryChanged(const QString &directoryPath);
+        void onCoalesceTimer();
+
+    private:
+        bool trackFile(const QString &filePath, QStringList &newDirectories);
+        bool untrackFile(const QString &filePath, QStringList &emptyDirectories);
+        void checkDirectory(const QString &directoryPath, QStringList &unavailableFiles, QStringList &changedFiles);
+
+    private:
+        QFileSystemWatcher m_DirectoriesWatcher;
+        // directory path -> (normalized filename -> tracked filepath)
+        QHash<QString, QHash<QString, QString> > m_TrackedFiles;
+        QSet<QString> m_ChangedDirectories;
+        QSet<QString> m_MissingFiles;
+        QTimer m_CoalesceTimer;
+        int m_TrackedFilesCount;
+    };
+}
+
+#endif // DIRECTORYWATCHER_H
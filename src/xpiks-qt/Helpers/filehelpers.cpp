@@ -13,6 +13,8 @@
 #include <QFileInfo>
 #include <QDir>
 #include <QVector>
+#include <QPair>
+#include <QtConcurrent>
 #include "../Common/defines.h"
 #include "../Helpers/constants.h"
 #include "../Models/artworkmetadata.h"
@@ -210,3 +212,86 @@ void Helpers::splitMediaFiles(const QStringList &rawFilenames, QStringList &file
         }
     }
 }
+
+Helpers::DirectoryMediaFiles Helpers::listMediaFilesInDirectory(const QString &directory) {
+    DirectoryMediaFiles result;
+    QStringList rawFilenames;
+
+    extractFilesFromDirectory(directory, rawFilenames);
+    splitMediaFiles(rawFilenames, result.first, result.second);
+
+    LOG_INFO << result.first.size() << "media file(s) and" << result.second.size() << "vector(s) found in" << directory;
+
+    return result;
+}
+
+namespace Helpers {
+    typedef QPair<QString, QHash<QString, QString> > DirectoryVectors;
+
+    DirectoryVectors listVectorsInDirectory(const QString &directory) {
+        DirectoryVectors result;
+        result.first = directory;
+
+        QDir dir(directory);
+        // name filters are case insensitive by default
+        const QStringList vectorFilenames = dir.entryList(QStringList() << "*.eps" << "*.ai", QDir::Files);
+
+        for (auto &filename: vectorFilenames) {
+            result.second.insert(filename.toLower(), dir.filePath(filename));
+        }
+
+        return result;
+    }
+}
+
+QFuture<Helpers::DirectoryMediaFiles> Helpers::discoverMediaFiles(const QStringList &directories) {
+    LOG_INFO << directories.size() << "directory(ies)";
+    // directories are listed and filtered concurrently in the global pool
+    // and every listing is reported separately as soon as it is ready
+    return QtConcurrent::mapped(directories, listMediaFilesInDirectory);
+}
+
+void Helpers::listVectorsInDirectories(const QSet<QString> &directories, QHash<QString, QHash<QString, QString> > &vectors) {
+    LOG_INFO << directories.size() << "directory(ies)";
+    if (directories.isEmpty()) { return; }
+
+    const QStringList directoriesList = directories.toList();
+    // listings of network shares are slow mostly because of latency
+    QList<DirectoryVectors> listings = QtConcurrent::blockingMapped<QList<DirectoryVectors> >(directoriesList, listVectorsInDirectory);
+
+    vectors.reserve(vectors.size() + listings.size());
+    for (auto &listing: listings) {
+        if (!listing.second.isEmpty()) {
+            vectors.insert(listing.first, listing.second);
+        }
+    }
+}
+
+void Helpers::groupVectorsByDirectory(const QStringList &vectorPaths, QHash<QString, QHash<QString, QString> > &vectors) {
+    for (auto &path: vectorPaths) {
+        QFileInfo fi(path);
+        vectors[fi.absolutePath()].insert(fi.fileName().toLower(), path);
+    }
+}
+
+QString Helpers::findVectorForImage(const QString &imagePath, const QHash<QString, QHash<QString, QString> > &vectors) {
+    QString vectorPath;
+
+    QFileInfo fi(imagePath);
+    auto it = vectors.constFind(fi.absolutePath());
+    if (it == vectors.constEnd()) { return vectorPath; }
+
+    const QHash<QString, QString> &directoryVectors = it.value();
+    // candidates are ordered by preference
+    const QStringList candidates = convertToVectorFilenames(fi.fileName());
+
+    for (auto &candidate: candidates) {
+        auto vectorIt = directoryVectors.constFind(candidate.toLower());
+        if (vectorIt != directoryVectors.constEnd()) {
+            vectorPath = vectorIt.value();
+            break;
+        }
+    }
+
+    return vectorPath;
+}
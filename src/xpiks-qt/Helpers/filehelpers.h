@@ -12,6 +12,10 @@
 #define FILENAMESHELPERS
 
 #include <QStringList>
+#include <QHash>
+#include <QSet>
+#include <QPair>
+#include <QFuture>
 
 #ifdef CORE_TESTS
     #ifdef Q_OS_WIN
@@ -44,6 +48,14 @@ namespace Helpers {
     bool ensureDirectoryExists(const QString &path);
     void extractFilesFromDirectory(const QString &directory, QStringList &filesList);
     void splitMediaFiles(const QStringList &rawFilenames, QStringList &filenames, QStringList &vectors);
+    // (media files, vectors) found in one directory
+    typedef QPair<QStringList, QStringList> DirectoryMediaFiles;
+    DirectoryMediaFiles listMediaFilesInDirectory(const QString &directory);
+    QFuture<DirectoryMediaFiles> discoverMediaFiles(const QStringList &directories);
+    // directory -> (lowercase filename -> vector path)
+    void listVectorsInDirectories(const QSet<QString> &directories, QHash<QString, QHash<QString, QString> > &vectors);
+    void groupVectorsByDirectory(const QStringList &vectorPaths, QHash<QString, QHash<QString, QString> > &vectors);
+    QString findVectorForImage(const QString &imagePath, const QHash<QString, QHash<QString, QString> > &vectors);
 }
 
 #endif // FILENAMESHELPERS
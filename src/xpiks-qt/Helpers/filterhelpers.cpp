@@ -15,6 +15,7 @@
 #include "../Common/basickeywordsmodel.h"
 #include "../Common/flags.h"
 #include "../Common/defines.h"
+#include "stringhelper.h"
 
 namespace Helpers {
     bool fitsSpecialKeywords(const QString &searchTerm, Models::ArtworkMetadata *metadata) {
@@ -199,4 +200,34 @@ namespace Helpers {
         return hasMatch;
     }
 
+    bool findSearchHits(const QString &searchTerm, Models::ArtworkMetadata *metadata, Common::SearchFlags searchFlags, SearchHits &hits) {
+        const bool caseSensitive = Common::HasFlag(searchFlags, Common::SearchFlags::CaseSensitive);
+        const Qt::CaseSensitivity caseSensitivity = caseSensitive ? Qt::CaseSensitive : Qt::CaseInsensitive;
+        const bool wholeWords = Common::HasFlag(searchFlags, Common::SearchFlags::WholeWords);
+
+        if (Common::HasFlag(searchFlags, Common::SearchFlags::Title)) {
+            findAllHits(metadata->getTitle(), searchTerm, caseSensitivity, wholeWords, hits.m_TitleHits);
+        }
+
+        if (Common::HasFlag(searchFlags, Common::SearchFlags::Description)) {
+            findAllHits(metadata->getDescription(), searchTerm, caseSensitivity, wholeWords, hits.m_DescriptionHits);
+        }
+
+        if (Common::HasFlag(searchFlags, Common::SearchFlags::Keywords)) {
+            const QStringList keywords = metadata->getKeywords();
+            const int size = keywords.size();
+
+            for (int i = 0; i < size; i++) {
+                const QString &keyword = keywords.at(i);
+                const bool hasMatch = wholeWords ?
+                                      containsWholeWords(keyword, searchTerm, caseSensitivity) :
+                                      keyword.contains(searchTerm, caseSensitivity);
+                if (hasMatch) {
+                    hits.m_KeywordsHits.push_back(i);
+                }
+            }
+        }
+
+        return hits.anyHit();
+    }
 }
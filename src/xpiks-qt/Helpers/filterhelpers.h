@@ -12,6 +12,7 @@
 #define FILTERHELPERS_H
 
 #include <QString>
+#include <vector>
 #include "../Common/flags.h"
 
 namespace Models {
@@ -19,7 +20,21 @@ namespace Models {
 }
 
 namespace Helpers {
+    struct SearchHits {
+        bool hasTitleHits() const { return !m_TitleHits.empty(); }
+        bool hasDescriptionHits() const { return !m_DescriptionHits.empty(); }
+        bool hasKeywordsHits() const { return !m_KeywordsHits.empty(); }
+        bool anyHit() const { return hasTitleHits() || hasDescriptionHits() || hasKeywordsHits(); }
+
+        std::vector<int> m_TitleHits;
+        std::vector<int> m_DescriptionHits;
+        // indices of keywords containing the term
+        std::vector<int> m_KeywordsHits;
+    };
+
     bool hasSearchMatch(const QString &searchTerm, Models::ArtworkMetadata *metadata, Common::SearchFlags searchFlags);
+    // scans every field once and finds exactly what Find & Replace would change
+    bool findSearchHits(const QString &searchTerm, Models::ArtworkMetadata *metadata, Common::SearchFlags searchFlags, SearchHits &hits);
 }
 
 #endif // FILTERHELPERS_H
@@ -1,4 +1,3 @@
-
 /*
  * This file is a part of Xpiks - cross platform application for
  * keywording and uploading images for microstocks
@@ -10,26 +9,75 @@
  */
 
 #include "logger.h"
-#include <QStringList>
 #include <QString>
 #include <QMutexLocker>
 #include <QMutex>
 #include <QFile>
-#include <QTextStream>
-#include <QTimer>
-#include <QDir>
-#include <QDateTime>
-#include <QStandardPaths>
-#include <QElapsedTimer>
 #include <iostream>
+#include <algorithm>
 #include <string>
-#include <ctime>
 #include "../Common/defines.h"
 
-#define MIN_FIRE_SIZE 20
-#define LOGGING_TIMEOUT 5
+// flush at least this often
+#define LOGS_FLUSH_INTERVAL 500
+// wake up writer earlier if that much is pending
+#define LOGS_WAKEUP_BYTES (256*1024)
+// drop new lines when writer cannot keep up
+#define LOGS_MAX_PENDING_BYTES (16*1024*1024)
+#define LOGS_CHUNK_RESERVE (64*1024)
 
 namespace Helpers {
+    LogsRingBuffer::LogsRingBuffer():
+        m_Lines(LOGS_RING_BUFFER_SIZE),
+        m_Head(0),
+        m_Tail(0),
+        m_IsAbandoned(false)
+    {
+    }
+
+    bool LogsRingBuffer::tryPush(const QByteArray &line) {
+        const size_t tail = m_Tail.load(std::memory_order_relaxed);
+        const size_t head = m_Head.load(std::memory_order_acquire);
+
+        if (tail - head >= LOGS_RING_BUFFER_SIZE) {
+            return false;
+        }
+
+        m_Lines[tail % LOGS_RING_BUFFER_SIZE] = line;
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    int LogsRingBuffer::drainTo(QByteArray &chunk) {
+        size_t head = m_Head.load(std::memory_order_relaxed);
+        const size_t tail = m_Tail.load(std::memory_order_acquire);
+        int bytesDrained = 0;
+
+        while (head != tail) {
+            QByteArray &line = m_Lines[head % LOGS_RING_BUFFER_SIZE];
+            chunk.append(line);
+            chunk.append('\n');
+            bytesDrained += line.size();
+            // release memory right away
+            line = QByteArray();
+            head++;
+        }
+
+        m_Head.store(head, std::memory_order_release);
+        return bytesDrained;
+    }
+
+    void Logger::setLogFilePath(const QString &filepath) {
+        QMutexLocker flushLocker(&m_FlushMutex);
+        Q_UNUSED(flushLocker);
+
+        if (m_LogFile.isOpen()) {
+            m_LogFile.close();
+        }
+
+        m_LogFilepath = filepath;
+    }
+
     void Logger::log(const QString &message) {
         if (!m_Stopped) {
             doLog(message);
@@ -37,86 +85,186 @@ namespace Helpers {
     }
 
     void Logger::flush() {
-        if (m_Stopped) { return; }
-
         QMutexLocker flushLocker(&m_FlushMutex);
+        Q_UNUSED(flushLocker);
 
-        while (m_QueueFlushFrom->isEmpty()) {
-            QMutexLocker logLocker(&m_LogMutex);
+        QByteArray chunk;
+        chunk.reserve(LOGS_CHUNK_RESERVE);
+        drainBuffers(chunk);
+        writeChunk(chunk);
+    }
 
-            if (m_QueueLogTo->isEmpty()) {
-                m_AnyLogsToFlush.wait(&m_LogMutex);
-            } else {
-                qSwap(m_QueueLogTo, m_QueueFlushFrom);
+    void Logger::waitAndFlush() {
+        if (m_Stopped) { return; }
+
+        m_WaitMutex.lock();
+        {
+            // stop() sets the flag under the same mutex so wakeAll() cannot be missed
+            if (!m_Stopped) {
+                m_AnyLogsToFlush.wait(&m_WaitMutex, LOGS_FLUSH_INTERVAL);
             }
         }
+        m_WaitMutex.unlock();
 
-        Q_ASSERT(m_QueueFlushFrom->length() > 0);
-        flushStream(m_QueueFlushFrom);
+        flush();
     }
 
     void Logger::stop() {
-        m_Stopped = true;
-
-        // will make waiting flush() call unblocked if any
-        doLog("Logging stopped.");
+        {
+            QMutexLocker waitLocker(&m_WaitMutex);
+            Q_UNUSED(waitLocker);
 
-        QMutexLocker flushLocker(&m_FlushMutex);
-        flushStream(m_QueueFlushFrom);
+            m_Stopped = true;
+            // will make waiting flush() call unblocked if any
+            m_AnyLogsToFlush.wakeAll();
+        }
 
         {
-            QMutexLocker logLocker(&m_LogMutex);
+            QMutexLocker flushLocker(&m_FlushMutex);
+            Q_UNUSED(flushLocker);
+
+            QByteArray chunk;
+            drainBuffers(chunk);
+            chunk.append("Logging stopped.\n");
+            writeChunk(chunk);
 
-            if (!m_QueueLogTo->isEmpty()) {
-                qSwap(m_QueueLogTo, m_QueueFlushFrom);
+            if (m_LogFile.isOpen()) {
+                m_LogFile.close();
             }
         }
-
-        flushStream(m_QueueFlushFrom);
     }
 
 #ifdef INTEGRATION_TESTS
     void Logger::emergencyFlush() {
-        flushStream(&m_LogsStorage[0]);
-        flushStream(&m_LogsStorage[1]);
+        // we might be crashing inside of the flush so never block here
+        if (!m_FlushMutex.tryLock()) { return; }
+
+        QByteArray chunk;
+        if (drainBuffers(chunk, true)) {
+            writeChunk(chunk);
+        }
+
+        m_FlushMutex.unlock();
     }
 #endif
 
+    int Logger::getSeverity(QtMsgType type) {
+        switch (type) {
+        case QtDebugMsg: return 0;
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 5, 0))
+        case QtInfoMsg: return 1;
+#endif
+        case QtWarningMsg: return 2;
+        case QtCriticalMsg: return 3;
+        case QtFatalMsg: return 4;
+        default: return 0;
+        }
+    }
+
+    LogsRingBuffer *Logger::getThreadBuffer() {
+        struct ThreadBufferHolder {
+            ~ThreadBufferHolder() {
+                // buffer is removed by the writer after it is drained
+                if (m_Buffer) { m_Buffer->abandon(); }
+            }
+
+            std::shared_ptr<LogsRingBuffer> m_Buffer;
+        };
+
+        static thread_local ThreadBufferHolder holder;
+
+        if (!holder.m_Buffer) {
+            holder.m_Buffer = std::make_shared<LogsRingBuffer>();
+
+            QMutexLocker locker(&m_BuffersLock);
+            Q_UNUSED(locker);
+            m_Buffers.push_back(holder.m_Buffer);
+        }
+
+        return holder.m_Buffer.get();
+    }
+
     void Logger::doLog(const QString &message) {
-        QMutexLocker locker(&m_LogMutex);
-        m_QueueLogTo->append(message);
-        m_AnyLogsToFlush.wakeOne();
+        const QByteArray line = message.toUtf8();
+        const qint64 size = line.size();
+
+        if (m_PendingBytes.load(std::memory_order_relaxed) + size > LOGS_MAX_PENDING_BYTES) {
+            m_DroppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        LogsRingBuffer *buffer = getThreadBuffer();
+        if (!buffer->tryPush(line)) {
+            m_DroppedCount.fetch_add(1, std::memory_order_relaxed);
+            m_AnyLogsToFlush.wakeOne();
+            return;
+        }
+
+        m_LoggedCount.fetch_add(1, std::memory_order_relaxed);
+        const qint64 pending = m_PendingBytes.fetch_add(size, std::memory_order_relaxed) + size;
+        if (pending > LOGS_WAKEUP_BYTES) {
+            m_AnyLogsToFlush.wakeOne();
+        }
+    }
+
+    bool Logger::drainBuffers(QByteArray &chunk, bool tryLockOnly) {
+        std::vector<std::shared_ptr<LogsRingBuffer> > buffers;
+        {
+            if (tryLockOnly) {
+                if (!m_BuffersLock.tryLock()) { return false; }
+            } else {
+                m_BuffersLock.lock();
+            }
+
+            // threads which are gone and had everything written
+            m_Buffers.erase(std::remove_if(m_Buffers.begin(), m_Buffers.end(),
+                                           [](const std::shared_ptr<LogsRingBuffer> &buffer) {
+                return buffer->isAbandoned() && buffer->isEmpty();
+            }),
+                            m_Buffers.end());
+
+            buffers = m_Buffers;
+            m_BuffersLock.unlock();
+        }
+
+        qint64 bytesDrained = 0;
+        for (auto &buffer: buffers) {
+            bytesDrained += buffer->drainTo(chunk);
+        }
+
+        m_PendingBytes.fetch_sub(bytesDrained, std::memory_order_relaxed);
+
+        const quint64 droppedCount = m_DroppedCount.load(std::memory_order_relaxed);
+        if (droppedCount != m_ReportedDroppedCount) {
+            chunk.append(QString("Logger dropped %1 line(s) (%2 overall)\n")
+                         .arg(droppedCount - m_ReportedDroppedCount)
+                         .arg(droppedCount).toUtf8());
+            m_ReportedDroppedCount = droppedCount;
+        }
+
+        return true;
     }
 
-    void Logger::flushStream(QStringList *logItems) {
-        Q_ASSERT(logItems != nullptr);
-        if (logItems->empty()) { return; }
+    void Logger::writeChunk(const QByteArray &chunk) {
+        if (chunk.isEmpty()) { return; }
 
 #ifdef WITH_LOGS
-        QFile outFile(m_LogFilepath);
-        if (outFile.open(QIODevice::WriteOnly | QIODevice::Text | QIODevice::Append)) {
-            QTextStream ts(&outFile);
-            ts.setCodec("UTF-8");
-
-            int size = logItems->size();
-            for (int i = 0; i < size; ++i) {
-                const QString &line = logItems->at(i);
-                ts << line;
-                endl(ts);
+        if (!m_LogFile.isOpen() && !m_LogFilepath.isEmpty()) {
+            m_LogFile.setFileName(m_LogFilepath);
+            if (!m_LogFile.open(QIODevice::WriteOnly | QIODevice::Text | QIODevice::Append)) {
+                std::cerr << "Failed to open log file" << std::endl;
             }
         }
-#endif
 
-#ifdef WITH_STDOUT_LOGS
-        int size = logItems->size();
-        for (int i = 0; i < size; ++i) {
-            const QString &line = logItems->at(i);
-            std::cout << line.toLocal8Bit().data() << std::endl;
+        if (m_LogFile.isOpen()) {
+            m_LogFile.write(chunk);
+            m_LogFile.flush();
         }
+#endif
 
+#ifdef WITH_STDOUT_LOGS
+        std::cout.write(chunk.constData(), chunk.size());
         std::cout.flush();
 #endif
-
-        logItems->clear();
     }
 }
@@ -11,12 +11,41 @@
 #ifndef LOGGER_H
 #define LOGGER_H
 
-#include <QStringList>
 #include <QString>
+#include <QByteArray>
 #include <QWaitCondition>
 #include <QMutex>
+#include <QFile>
+#include <QAtomicInt>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include "../Common/defines.h"
+
+// lines per thread
+#define LOGS_RING_BUFFER_SIZE 4096
 
 namespace Helpers {
+    // lock-free queue of formatted lines with
+    // one producer (owning thread) and one consumer (flushing thread)
+    class LogsRingBuffer {
+    public:
+        LogsRingBuffer();
+
+    public:
+        bool tryPush(const QByteArray &line);
+        int drainTo(QByteArray &chunk);
+        void abandon() { m_IsAbandoned.store(true, std::memory_order_release); }
+        bool isAbandoned() const { return m_IsAbandoned.load(std::memory_order_acquire); }
+        bool isEmpty() const { return m_Head.load(std::memory_order_acquire) == m_Tail.load(std::memory_order_acquire); }
+
+    private:
+        std::vector<QByteArray> m_Lines;
+        std::atomic_size_t m_Head;
+        std::atomic_size_t m_Tail;
+        std::atomic_bool m_IsAbandoned;
+    };
+
     class Logger
     {
     public:
@@ -28,14 +57,20 @@ namespace Helpers {
         }
 
     public:
-        void setLogFilePath(const QString &filepath) {
-            m_LogFilepath = filepath;
-        }
-
+        static int getSeverity(QtMsgType type);
+        void setLogFilePath(const QString &filepath);
         QString getLogFilePath() const { return m_LogFilepath; }
 
+        // filtering happens before message is formatted
+        void setMinimumLevel(QtMsgType type) { Common::minimumLogSeverity().store(getSeverity(type)); }
+        bool isLevelEnabled(QtMsgType type) const { return getSeverity(type) >= Common::minimumLogSeverity().load(); }
+
+        quint64 getDroppedCount() const { return m_DroppedCount.load(); }
+        quint64 getLoggedCount() const { return m_LoggedCount.load(); }
+
         void log(const QString &message);
         void flush();
+        void waitAndFlush();
         void stop();
 
 #ifdef INTEGRATION_TESTS
@@ -44,27 +79,36 @@ namespace Helpers {
 #endif
 
     private:
+        LogsRingBuffer *getThreadBuffer();
         void doLog(const QString &message);
-        void flushStream(QStringList *logItems);
+        bool drainBuffers(QByteArray &chunk, bool tryLockOnly=false);
+        void writeChunk(const QByteArray &chunk);
 
     private:
-        Logger() {
-            m_QueueLogTo = &m_LogsStorage[0];
-            m_QueueFlushFrom = &m_LogsStorage[1];
-            m_Stopped = false;
-        }
+        Logger():
+            m_PendingBytes(0),
+            m_DroppedCount(0),
+            m_ReportedDroppedCount(0),
+            m_LoggedCount(0),
+            m_Stopped(false)
+        { }
 
         Logger(Logger const&);
         void operator=(Logger const&);
 
     private:
         QString m_LogFilepath;
-        QStringList m_LogsStorage[2];
-        QStringList *m_QueueFlushFrom;
-        QStringList *m_QueueLogTo;
-        QMutex m_LogMutex;
+        QFile m_LogFile;
+        QMutex m_BuffersLock;
+        std::vector<std::shared_ptr<LogsRingBuffer> > m_Buffers;
+        // single writer at a time
         QMutex m_FlushMutex;
+        QMutex m_WaitMutex;
         QWaitCondition m_AnyLogsToFlush;
+        std::atomic<qint64> m_PendingBytes;
+        std::atomic<quint64> m_DroppedCount;
+        quint64 m_ReportedDroppedCount;
+        std::atomic<quint64> m_LoggedCount;
         volatile bool m_Stopped;
     };
 }
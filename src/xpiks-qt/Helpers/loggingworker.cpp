@@ -22,11 +22,11 @@ namespace Helpers {
 
     void LoggingWorker::process() {
         Logger &logger = Logger::getInstance();
-        const int sleepTimeout = 700;
 
         while (!m_Cancel) {
-            logger.flush();
-            QThread::msleep(sleepTimeout);
+            // single writer keeps the file open and
+            // writes everything accumulated by all threads at once
+            logger.waitAndFlush();
         }
 
         emit stopped();
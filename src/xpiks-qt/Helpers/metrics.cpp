@@ -0,0 +1,209 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "metrics.h"
+#include <QMutexLocker>
+#include <QtAlgorithms>
+#include <algorithm>
+
+namespace Helpers {
+    void updateMax(std::atomic<qint64> &maxValue, qint64 value) {
+        qint64 current = maxValue.load(std::memory_order_relaxed);
+        while ((value > current) &&
+               !maxValue.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+            // current is reloaded by compare_exchange_weak()
+        }
+    }
+
+    void MetricGauge::set(qint64 value) {
+        m_Value.store(value, std::memory_order_relaxed);
+        updateMax(m_MaxValue, value);
+    }
+
+    LatencyHistogram::LatencyHistogram():
+        m_Count(0),
+        m_Sum(0),
+        m_Max(0)
+    {
+        for (auto &bucket: m_Buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void LatencyHistogram::record(qint64 valueUs) {
+        if (valueUs < 0) { valueUs = 0; }
+
+        m_Buckets[getBucketIndex(valueUs)].fetch_add(1, std::memory_order_relaxed);
+        m_Count.fetch_add(1, std::memory_order_relaxed);
+        m_Sum.fetch_add(valueUs, std::memory_order_relaxed);
+        updateMax(m_Max, valueUs);
+    }
+
+    void LatencyHistogram::snapshot(HistogramSnapshot &snapshot) const {
+        // buckets are copied first so that percentiles do not run past the count
+        std::vector<qint64> buckets(HISTOGRAM_BUCKETS_COUNT, 0);
+        qint64 count = 0;
+        for (int i = 0; i < HISTOGRAM_BUCKETS_COUNT; i++) {
+            buckets[i] = m_Buckets[i].load(std::memory_order_relaxed);
+            count += buckets[i];
+        }
+
+        snapshot = HistogramSnapshot();
+        if (count == 0) { return; }
+
+        snapshot.m_Count = count;
+        snapshot.m_Max = m_Max.load(std::memory_order_relaxed);
+        snapshot.m_Mean = m_Sum.load(std::memory_order_relaxed) / qMax<qint64>(1, m_Count.load(std::memory_order_relaxed));
+
+        const int percents[] = {50, 90, 99};
+        qint64 *results[] = {&snapshot.m_P50, &snapshot.m_P90, &snapshot.m_P99};
+        int percentIndex = 0;
+        qint64 seen = 0;
+
+        for (int i = 0; (i < HISTOGRAM_BUCKETS_COUNT) && (percentIndex < 3); i++) {
+            seen += buckets[i];
+
+            while ((percentIndex < 3) && (seen * 100 >= count * percents[percentIndex])) {
+                *results[percentIndex] = std::min(getBucketValue(i), snapshot.m_Max);
+                percentIndex++;
+            }
+        }
+    }
+
+    int LatencyHistogram::getBucketIndex(qint64 value) {
+        if (value < HISTOGRAM_SUB_BUCKETS) { return (int)std::max<qint64>(0, value); }
+
+        const int highestBit = 63 - (int)qCountLeadingZeroBits((quint64)value);
+        const int shift = highestBit - HISTOGRAM_SUB_BUCKET_BITS;
+        if (shift > HISTOGRAM_MAX_SHIFT) { return HISTOGRAM_BUCKETS_COUNT - 1; }
+
+        const int subBucket = (int)(value >> shift) - HISTOGRAM_SUB_BUCKETS;
+        return (shift + 1) * HISTOGRAM_SUB_BUCKETS + subBucket;
+    }
+
+    qint64 LatencyHistogram::getBucketValue(int index) {
+        if (index < HISTOGRAM_SUB_BUCKETS) { return index; }
+
+        const int shift = index / HISTOGRAM_SUB_BUCKETS - 1;
+        const qint64 lowest = (qint64)(HISTOGRAM_SUB_BUCKETS + index % HISTOGRAM_SUB_BUCKETS) << shift;
+        return lowest + (((qint64)1 << shift) / 2);
+    }
+
+    QString MetricValue::formatValue() const {
+        switch (m_Kind) {
+        case MetricKind::Counter:
+            return QString::number(m_Value);
+        case MetricKind::Gauge:
+            return QString("%1 (max %2)").arg(m_Value).arg(m_MaxValue);
+        case MetricKind::Histogram:
+            return QString("count %1, mean %2us, p50 %3us, p90 %4us, p99 %5us, max %6us")
+                    .arg(m_Histogram.m_Count)
+                    .arg(m_Histogram.m_Mean)
+                    .arg(m_Histogram.m_P50)
+                    .arg(m_Histogram.m_P90)
+                    .arg(m_Histogram.m_P99)
+                    .arg(m_Histogram.m_Max);
+        }
+
+        return QString();
+    }
+
+    template<typename T>
+    T *getOrCreate(std::map<QString, std::unique_ptr<T> > &metrics, const QString &name) {
+        auto it = metrics.find(name);
+        if (it != metrics.end()) { return it->second.get(); }
+
+        T *metric = new T();
+        metrics.emplace(name, std::unique_ptr<T>(metric));
+        return metric;
+    }
+
+    MetricCounter *MetricsRegistry::getCounter(const QString &name) {
+        QMutexLocker locker(&m_Lock);
+        Q_UNUSED(locker);
+        return getOrCreate(m_Counters, name);
+    }
+
+    MetricGauge *MetricsRegistry::getGauge(const QString &name) {
+        QMutexLocker locker(&m_Lock);
+        Q_UNUSED(locker);
+        return getOrCreate(m_Gauges, name);
+    }
+
+    LatencyHistogram *MetricsRegistry::getHistogram(const QString &name) {
+        QMutexLocker locker(&m_Lock);
+        Q_UNUSED(locker);
+        return getOrCreate(m_Histograms, name);
+    }
+
+    WorkerMetrics *MetricsRegistry::getWorkerMetrics(const QString &workerName) {
+        {
+            QMutexLocker locker(&m_Lock);
+            Q_UNUSED(locker);
+            auto it = m_Workers.find(workerName);
+            if (it != m_Workers.end()) { return it->second.get(); }
+        }
+
+        const QString prefix = workerName + ".";
+
+        std::unique_ptr<WorkerMetrics> metrics(new WorkerMetrics());
+        metrics->m_Processed = getCounter(prefix + "processed");
+        metrics->m_Discarded = getCounter(prefix + "discarded");
+        metrics->m_QueueDepth = getGauge(prefix + "queue_depth");
+        metrics->m_Batches = getGauge(prefix + "batches");
+        metrics->m_WaitTime = getHistogram(prefix + "wait_time");
+        metrics->m_ProcessingTime = getHistogram(prefix + "processing_time");
+
+        QMutexLocker locker(&m_Lock);
+        Q_UNUSED(locker);
+        // same metrics could have been registered concurrently
+        auto result = m_Workers.emplace(workerName, std::move(metrics));
+        return result.first->second.get();
+    }
+
+    void MetricsRegistry::snapshot(std::vector<MetricValue> &values) const {
+        QMutexLocker locker(&m_Lock);
+        Q_UNUSED(locker);
+
+        values.reserve(values.size() + m_Counters.size() + m_Gauges.size() + m_Histograms.size());
+
+        for (auto &pair: m_Counters) {
+            MetricValue value;
+            value.m_Name = pair.first;
+            value.m_Kind = MetricKind::Counter;
+            value.m_Value = pair.second->get();
+            value.m_MaxValue = value.m_Value;
+            values.emplace_back(value);
+        }
+
+        for (auto &pair: m_Gauges) {
+            MetricValue value;
+            value.m_Name = pair.first;
+            value.m_Kind = MetricKind::Gauge;
+            value.m_Value = pair.second->get();
+            value.m_MaxValue = pair.second->getMax();
+            values.emplace_back(value);
+        }
+
+        for (auto &pair: m_Histograms) {
+            MetricValue value;
+            value.m_Name = pair.first;
+            value.m_Kind = MetricKind::Histogram;
+            pair.second->snapshot(value.m_Histogram);
+            value.m_Value = value.m_Histogram.m_Count;
+            value.m_MaxValue = value.m_Histogram.m_Max;
+            values.emplace_back(value);
+        }
+
+        std::sort(values.begin(), values.end(), [](const MetricValue &a, const MetricValue &b) {
+            return a.m_Name < b.m_Name;
+        });
+    }
+}
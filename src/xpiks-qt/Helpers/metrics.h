@@ -0,0 +1,156 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <QString>
+#include <QMutex>
+#include <QElapsedTimer>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <map>
+
+// log-linear buckets: 8 per power of two, relative error is below 12.5%
+#define HISTOGRAM_SUB_BUCKET_BITS 3
+#define HISTOGRAM_SUB_BUCKETS (1 << HISTOGRAM_SUB_BUCKET_BITS)
+// values up to 2^36 microseconds (19 hours) are distinguishable
+#define HISTOGRAM_MAX_SHIFT 33
+#define HISTOGRAM_BUCKETS_COUNT ((HISTOGRAM_MAX_SHIFT + 2) * HISTOGRAM_SUB_BUCKETS)
+
+namespace Helpers {
+    class MetricCounter {
+    public:
+        MetricCounter(): m_Value(0) { }
+
+    public:
+        void add(qint64 value = 1) { m_Value.fetch_add(value, std::memory_order_relaxed); }
+        qint64 get() const { return m_Value.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<qint64> m_Value;
+    };
+
+    class MetricGauge {
+    public:
+        MetricGauge(): m_Value(0), m_MaxValue(0) { }
+
+    public:
+        void set(qint64 value);
+        qint64 get() const { return m_Value.load(std::memory_order_relaxed); }
+        qint64 getMax() const { return m_MaxValue.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<qint64> m_Value;
+        std::atomic<qint64> m_MaxValue;
+    };
+
+    struct HistogramSnapshot {
+        HistogramSnapshot():
+            m_Count(0), m_Mean(0), m_Max(0), m_P50(0), m_P90(0), m_P99(0)
+        { }
+
+        qint64 m_Count;
+        qint64 m_Mean;
+        qint64 m_Max;
+        qint64 m_P50;
+        qint64 m_P90;
+        qint64 m_P99;
+    };
+
+    // HDR-style histogram of microseconds, recording is wait-free
+    class LatencyHistogram {
+    public:
+        LatencyHistogram();
+
+    public:
+        void record(qint64 valueUs);
+        void snapshot(HistogramSnapshot &snapshot) const;
+
+    public:
+        static int getBucketIndex(qint64 value);
+        // middle of the range of values that fall into the bucket
+        static qint64 getBucketValue(int index);
+
+    private:
+        std::atomic<qint64> m_Buckets[HISTOGRAM_BUCKETS_COUNT];
+        std::atomic<qint64> m_Count;
+        std::atomic<qint64> m_Sum;
+        std::atomic<qint64> m_Max;
+    };
+
+    enum struct MetricKind {
+        Counter,
+        Gauge,
+        Histogram
+    };
+
+    struct MetricValue {
+        QString m_Name;
+        MetricKind m_Kind;
+        qint64 m_Value;
+        qint64 m_MaxValue;
+        HistogramSnapshot m_Histogram;
+
+        QString formatValue() const;
+        QString toString() const { return m_Name + ": " + formatValue(); }
+    };
+
+    // metrics of one ItemProcessingWorker, shared by its restarts
+    struct WorkerMetrics {
+        MetricCounter *m_Processed;
+        MetricCounter *m_Discarded;
+        MetricGauge *m_QueueDepth;
+        MetricGauge *m_Batches;
+        LatencyHistogram *m_WaitTime;
+        LatencyHistogram *m_ProcessingTime;
+    };
+
+    // metrics live until the end of the process so pointers can be cached
+    class MetricsRegistry
+    {
+    public:
+        static MetricsRegistry& getInstance()
+        {
+            static MetricsRegistry instance;
+            return instance;
+        }
+
+    public:
+        qint64 nowUs() const { return m_Timer.nsecsElapsed() / 1000; }
+
+    public:
+        MetricCounter *getCounter(const QString &name);
+        MetricGauge *getGauge(const QString &name);
+        LatencyHistogram *getHistogram(const QString &name);
+        WorkerMetrics *getWorkerMetrics(const QString &workerName);
+        // sorted by name
+        void snapshot(std::vector<MetricValue> &values) const;
+
+    private:
+        MetricsRegistry() {
+            m_Timer.start();
+        }
+
+        MetricsRegistry(MetricsRegistry const&);
+        void operator=(MetricsRegistry const&);
+
+    private:
+        mutable QMutex m_Lock;
+        std::map<QString, std::unique_ptr<MetricCounter> > m_Counters;
+        std::map<QString, std::unique_ptr<MetricGauge> > m_Gauges;
+        std::map<QString, std::unique_ptr<LatencyHistogram> > m_Histograms;
+        std::map<QString, std::unique_ptr<WorkerMetrics> > m_Workers;
+        QElapsedTimer m_Timer;
+    };
+}
+
+#endif // METRICS_H
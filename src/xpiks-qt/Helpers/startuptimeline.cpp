@@ -0,0 +1,45 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "startuptimeline.h"
+#include <QMutexLocker>
+#include "../Common/defines.h"
+
+namespace Helpers {
+    void StartupTimeline::reportStage(const QString &name, qint64 startedAt, qint64 duration) {
+        LOG_INFO << "Startup stage" << name << "took" << duration << "ms" << "(started at +" << startedAt << "ms)";
+
+        QMutexLocker locker(&m_EntriesLock);
+        Q_UNUSED(locker);
+        m_Entries.emplace_back(name, startedAt, duration);
+    }
+
+    void StartupTimeline::reportMilestone(const QString &name) {
+        const qint64 elapsed = getElapsed();
+        LOG_INFO << "Startup milestone" << name << "reached at +" << elapsed << "ms";
+
+        QMutexLocker locker(&m_EntriesLock);
+        Q_UNUSED(locker);
+        m_Entries.emplace_back(name, elapsed, 0);
+    }
+
+    void StartupTimeline::logSummary() {
+        QMutexLocker locker(&m_EntriesLock);
+        Q_UNUSED(locker);
+
+        LOG_INFO << "Startup timeline:" << m_Entries.size() << "entries";
+        for (auto &entry: m_Entries) {
+            LOG_INFO << QString("  +%1 ms\t%2 ms\t%3")
+                        .arg(entry.m_StartedAt)
+                        .arg(entry.m_Duration)
+                        .arg(entry.m_Name);
+        }
+    }
+}
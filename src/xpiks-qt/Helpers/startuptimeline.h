@@ -0,0 +1,86 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef STARTUPTIMELINE_H
+#define STARTUPTIMELINE_H
+
+#include <QString>
+#include <QMutex>
+#include <QElapsedTimer>
+#include <vector>
+#include "tracing.h"
+
+namespace Helpers {
+    // collects durations of services initialization
+    // so regressions of the startup time are visible in logs
+    class StartupTimeline
+    {
+    public:
+        static StartupTimeline& getInstance()
+        {
+            static StartupTimeline instance;
+            return instance;
+        }
+
+    private:
+        struct TimelineEntry {
+            TimelineEntry(const QString &name, qint64 startedAt, qint64 duration):
+                m_Name(name),
+                m_StartedAt(startedAt),
+                m_Duration(duration)
+            { }
+
+            QString m_Name;
+            qint64 m_StartedAt;
+            qint64 m_Duration;
+        };
+
+    public:
+        qint64 getElapsed() const { return m_SinceLaunch.elapsed(); }
+        void reportStage(const QString &name, qint64 startedAt, qint64 duration);
+        void reportMilestone(const QString &name);
+        void logSummary();
+
+    private:
+        StartupTimeline() { m_SinceLaunch.start(); }
+
+        StartupTimeline(StartupTimeline const&);
+        void operator=(StartupTimeline const&);
+
+    private:
+        QMutex m_EntriesLock;
+        std::vector<TimelineEntry> m_Entries;
+        QElapsedTimer m_SinceLaunch;
+    };
+
+    class StartupStageTimer {
+    public:
+        // name should be a string literal
+        StartupStageTimer(const char *name):
+            m_Name(name),
+            m_TraceScope(name, "startup")
+        {
+            m_StartedAt = StartupTimeline::getInstance().getElapsed();
+            m_Timer.start();
+        }
+
+        virtual ~StartupStageTimer() {
+            StartupTimeline::getInstance().reportStage(QString::fromLatin1(m_Name), m_StartedAt, m_Timer.elapsed());
+        }
+
+    private:
+        const char *m_Name;
+        TraceScope m_TraceScope;
+        QElapsedTimer m_Timer;
+        qint64 m_StartedAt;
+    };
+}
+
+#endif // STARTUPTIMELINE_H
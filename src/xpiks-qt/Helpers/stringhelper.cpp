@@ -21,6 +21,8 @@
 #include <utility>
 #include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <limits>
 #include "../Common/defines.h"
 #include "../Helpers/indiceshelper.h"
 
@@ -35,6 +37,8 @@
 #endif
 
 #define SYNONYMS_DISTANCE 3
+#define MYERS_MAX_PATTERN_LENGTH 64
+#define LATIN1_SIZE 256
 
 namespace Helpers {
     bool isHex(char c) {
@@ -234,6 +238,25 @@ namespace Helpers {
         return anyHit;
     }
 
+    void findAllHits(const QString &haystack, const QString &needle, Qt::CaseSensitivity caseSensitivity,
+                     bool wholeWords, std::vector<int> &hits) {
+        const int size = needle.size();
+        if (size == 0) { return; }
+
+        int pos = 0;
+
+        while (pos != -1) {
+            pos = haystack.indexOf(needle, pos, caseSensitivity);
+            if (pos >= 0) {
+                if (!wholeWords || isAWholeWord(haystack, pos, size, true)) {
+                    hits.push_back(pos);
+                }
+
+                pos += size;
+            }
+        }
+    }
+
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 4, 0))
     QString getLastNLines(const QString &text, int N) {
         QString result;
@@ -321,7 +344,13 @@ namespace Helpers {
         return str;
     }
 
-    unsigned int levensteinDistance(const QString &a, const QString &b) {
+    inline QChar foldCase(const QChar &c, Qt::CaseSensitivity caseSensitivity) {
+        return (caseSensitivity == Qt::CaseInsensitive) ? c.toLower() : c;
+    }
+
+    // classic dynamic programming for long strings
+    // returns something bigger than maxDistance as soon as the distance cannot fit
+    unsigned int dpLevensteinDistance(const QString &a, const QString &b, unsigned int maxDistance, Qt::CaseSensitivity caseSensitivity) {
         const unsigned int lengthA = a.size(), lengthB = b.size();
         std::vector<unsigned int> costs(lengthB + 1), prevCosts(lengthB + 1);
         const unsigned int prevCostsSize = (unsigned int)prevCosts.size();
@@ -332,13 +361,19 @@ namespace Helpers {
 
         for (unsigned int i = 0; i < lengthA; i++) {
             costs[0] = i + 1;
+            unsigned int rowMinimum = costs[0];
+            const QChar charA = foldCase(a[i], caseSensitivity);
 
             for (unsigned int j = 0; j < lengthB; j++) {
                 costs[j + 1] = std::min(
                     std::min(prevCosts[1 + j] + 1, costs[j] + 1),
-                    prevCosts[j] + (a[i] == b[j] ? 0 : 1));
+                    prevCosts[j] + (charA == foldCase(b[j], caseSensitivity) ? 0 : 1));
+                rowMinimum = std::min(rowMinimum, costs[j + 1]);
             }
 
+            // values in the next rows are never smaller than minimum of this one
+            if (rowMinimum > maxDistance) { return maxDistance + 1; }
+
             costs.swap(prevCosts);
         }
 
@@ -346,10 +381,104 @@ namespace Helpers {
         return result;
     }
 
+    // Myers' bit-parallel algorithm in the Hyyro's formulation for edit distance
+    // one machine word holds a whole column of the DP matrix for patterns up to 64 symbols
+    unsigned int myersLevensteinDistance(const QString &pattern, const QString &text, unsigned int maxDistance, Qt::CaseSensitivity caseSensitivity) {
+        const int patternLength = pattern.size();
+        const int textLength = text.size();
+        Q_ASSERT((0 < patternLength) && (patternLength <= MYERS_MAX_PATTERN_LENGTH));
+
+        quint64 peqLatin1[LATIN1_SIZE];
+        std::memset(peqLatin1, 0, sizeof(peqLatin1));
+        QChar patternChars[MYERS_MAX_PATTERN_LENGTH];
+        bool anyWideChars = false;
+
+        for (int i = 0; i < patternLength; i++) {
+            const QChar c = foldCase(pattern[i], caseSensitivity);
+            patternChars[i] = c;
+
+            if (c.unicode() < LATIN1_SIZE) {
+                peqLatin1[c.unicode()] |= (quint64)1 << i;
+            } else {
+                anyWideChars = true;
+            }
+        }
+
+        const quint64 lastBit = (quint64)1 << (patternLength - 1);
+        quint64 pv = ~(quint64)0;
+        quint64 mv = 0;
+        unsigned int score = patternLength;
+
+        for (int j = 0; j < textLength; j++) {
+            const QChar c = foldCase(text[j], caseSensitivity);
+            quint64 eq = 0;
+
+            if (c.unicode() < LATIN1_SIZE) {
+                eq = peqLatin1[c.unicode()];
+            } else if (anyWideChars) {
+                for (int i = 0; i < patternLength; i++) {
+                    if (patternChars[i] == c) { eq |= (quint64)1 << i; }
+                }
+            }
+
+            const quint64 xv = eq | mv;
+            const quint64 xh = (((eq & pv) + pv) ^ pv) | eq;
+            quint64 ph = mv | ~(xh | pv);
+            quint64 mh = pv & xh;
+
+            if (ph & lastBit) {
+                score++;
+            } else if (mh & lastBit) {
+                score--;
+            }
+
+            // first row of the matrix grows by one in each column
+            ph = (ph << 1) | 1;
+            mh = mh << 1;
+            pv = mh | ~(xv | ph);
+            mv = ph & xv;
+
+            // the distance can decrease at most by one for each remaining symbol
+            const unsigned int remaining = (unsigned int)(textLength - j - 1);
+            if ((score > remaining) && (score - remaining > maxDistance)) {
+                return maxDistance + 1;
+            }
+        }
+
+        return score;
+    }
+
+    unsigned int boundedLevensteinDistance(const QString &a, const QString &b, unsigned int maxDistance, Qt::CaseSensitivity caseSensitivity) {
+        const bool aIsShorter = a.size() <= b.size();
+        const QString &shorter = aIsShorter ? a : b;
+        const QString &longer = aIsShorter ? b : a;
+
+        if (shorter.isEmpty()) { return longer.size(); }
+
+        const unsigned int lengthDiff = (unsigned int)(longer.size() - shorter.size());
+        if (lengthDiff > maxDistance) { return maxDistance + 1; }
+
+        if (shorter.size() <= MYERS_MAX_PATTERN_LENGTH) {
+            return myersLevensteinDistance(shorter, longer, maxDistance, caseSensitivity);
+        } else {
+            return dpLevensteinDistance(longer, shorter, maxDistance, caseSensitivity);
+        }
+    }
+
+    unsigned int levensteinDistance(const QString &a, const QString &b, Qt::CaseSensitivity caseSensitivity) {
+        // distance is never bigger than the length of the longest string
+        const unsigned int maxDistance = std::numeric_limits<unsigned int>::max() - 1;
+        return boundedLevensteinDistance(a, b, maxDistance, caseSensitivity);
+    }
+
+    bool isLevensteinDistanceWithin(const QString &a, const QString &b, unsigned int maxDistance, Qt::CaseSensitivity caseSensitivity) {
+        return boundedLevensteinDistance(a, b, maxDistance, caseSensitivity) <= maxDistance;
+    }
+
     int levensteinPercentage(const QString &s1, const QString &s2) {
         int maxLength = std::max(s1.length(), s2.length());
 
-        unsigned int distance = levensteinDistance(s1.toLower(), s2.toLower());
+        unsigned int distance = levensteinDistance(s1, s2, Qt::CaseInsensitive);
         int reverseDistance = maxLength - (int)distance;
 
         if (reverseDistance == 0) { return 0; }
@@ -358,6 +487,18 @@ namespace Helpers {
         return percent;
     }
 
+    bool hasLevensteinPercentage(const QString &s1, const QString &s2, int minPercentage) {
+        const int maxLength = std::max(s1.length(), s2.length());
+        if (maxLength == 0) { return minPercentage <= 0; }
+        if (minPercentage <= 0) { return true; }
+
+        // (maxLength - distance) * 100 / maxLength >= minPercentage
+        const int maxDistance = maxLength - (minPercentage * maxLength + 99) / 100;
+        if (maxDistance < 0) { return false; }
+
+        return isLevensteinDistanceWithin(s1, s2, (unsigned int)maxDistance, Qt::CaseInsensitive);
+    }
+
     bool is7BitAscii(const QByteArray &s) {
         bool anyFault = false;
         const int size = s.size();
@@ -449,7 +590,6 @@ namespace Helpers {
         const int diff = abs(length1 - length2);
         if (diff > SYNONYMS_DISTANCE) { return false; }
 
-        const auto distance = Helpers::levensteinDistance(s1.toLower(), s2.toLower());
-        return distance <= SYNONYMS_DISTANCE;
+        return isLevensteinDistanceWithin(s1, s2, SYNONYMS_DISTANCE, Qt::CaseInsensitive);
     }
 }
@@ -34,11 +34,18 @@ namespace Helpers {
     QString replaceWholeWords(const QString &text, const QString &replaceWhat,
                               const QString &replaceTo, Qt::CaseSensitivity caseSensitivity=Qt::CaseInsensitive);
     bool containsWholeWords(const QString &haystack, const QString &needle, Qt::CaseSensitivity caseSensitivity=Qt::CaseInsensitive);
+    // positions of the same occurrences which replace() or replaceWholeWords() would change
+    void findAllHits(const QString &haystack, const QString &needle, Qt::CaseSensitivity caseSensitivity,
+                     bool wholeWords, std::vector<int> &hits);
     QString getLastNLines(const QString &text, int N);
     void splitText(const QString &text, QStringList &parts);
     void splitKeywords(const QString &text, const QVector<QChar> &separators, QStringList &parts);
-    unsigned int levensteinDistance(const QString &a, const QString &b);
+    unsigned int levensteinDistance(const QString &a, const QString &b, Qt::CaseSensitivity caseSensitivity=Qt::CaseSensitive);
+    // stops as soon as the distance is known to be bigger than maxDistance
+    bool isLevensteinDistanceWithin(const QString &a, const QString &b, unsigned int maxDistance, Qt::CaseSensitivity caseSensitivity=Qt::CaseSensitive);
     int levensteinPercentage(const QString &s1, const QString &s2);
+    // same as levensteinPercentage(s1, s2) >= minPercentage
+    bool hasLevensteinPercentage(const QString &s1, const QString &s2, int minPercentage);
     bool is7BitAscii(const QByteArray &s);
     bool isPunctuation(const QChar &);
     std::string string_format(const std::string fmt, ...);
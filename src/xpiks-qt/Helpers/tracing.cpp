@@ -0,0 +1,106 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "tracing.h"
+#include <QFile>
+#include <QThread>
+#include <QMutexLocker>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QJsonDocument>
+#include <QCoreApplication>
+#include "../Common/defines.h"
+
+namespace Helpers {
+    void TraceRingBuffer::copyEvents(std::vector<TraceEvent> &events) const {
+        const size_t writeIndex = m_WriteIndex.load(std::memory_order_acquire);
+        const size_t count = std::min<size_t>(writeIndex, TRACE_RING_BUFFER_SIZE);
+        const size_t first = writeIndex - count;
+
+        events.reserve(events.size() + count);
+        for (size_t i = first; i < writeIndex; ++i) {
+            events.push_back(m_Events[i % TRACE_RING_BUFFER_SIZE]);
+        }
+    }
+
+    void Tracer::addEvent(const char *name, const char *category, qint64 startUs, qint64 durationUs) {
+        TraceRingBuffer *buffer = getThreadBuffer();
+        buffer->append(name, category, startUs, durationUs);
+    }
+
+    TraceRingBuffer *Tracer::getThreadBuffer() {
+        static thread_local TraceRingBuffer *threadBuffer = nullptr;
+
+        if (threadBuffer == nullptr) {
+            // buffers live until the end of the process so
+            // spans of finished threads still get into the dump
+            std::shared_ptr<TraceRingBuffer> buffer(new TraceRingBuffer((quint64)(quintptr)QThread::currentThreadId()));
+
+            QMutexLocker locker(&m_BuffersLock);
+            Q_UNUSED(locker);
+            m_Buffers.push_back(buffer);
+            threadBuffer = buffer.get();
+        }
+
+        return threadBuffer;
+    }
+
+    bool Tracer::dumpChromeTrace(const QString &filepath) {
+        LOG_INFO << filepath;
+
+        std::vector<std::shared_ptr<TraceRingBuffer> > buffers;
+        {
+            QMutexLocker locker(&m_BuffersLock);
+            Q_UNUSED(locker);
+            buffers = m_Buffers;
+        }
+
+        const qint64 pid = QCoreApplication::applicationPid();
+        QJsonArray traceEvents;
+        std::vector<TraceEvent> events;
+
+        for (auto &buffer: buffers) {
+            events.clear();
+            buffer->copyEvents(events);
+
+            const double tid = (double)buffer->getThreadID();
+
+            for (auto &event: events) {
+                QJsonObject eventObject;
+                eventObject.insert("name", QString::fromLatin1(event.m_Name));
+                eventObject.insert("cat", QString::fromLatin1(event.m_Category));
+                eventObject.insert("ph", QString("X"));
+                eventObject.insert("ts", (double)event.m_StartUs);
+                eventObject.insert("dur", (double)event.m_DurationUs);
+                eventObject.insert("pid", (double)pid);
+                eventObject.insert("tid", tid);
+                traceEvents.append(eventObject);
+            }
+        }
+
+        QJsonObject rootObject;
+        rootObject.insert("traceEvents", traceEvents);
+        rootObject.insert("displayTimeUnit", QString("ms"));
+
+        QJsonDocument doc(rootObject);
+
+        bool success = false;
+        QFile file(filepath);
+        if (file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            success = file.write(doc.toJson(QJsonDocument::Compact)) != -1;
+            file.close();
+        } else {
+            LOG_WARNING << "Failed to open" << filepath;
+        }
+
+        LOG_INFO << "Dumped" << traceEvents.size() << "trace events from" << buffers.size() << "thread(s)";
+        return success;
+    }
+}
@@ -0,0 +1,132 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TRACING_H
+#define TRACING_H
+
+#include <QString>
+#include <QMutex>
+#include <QAtomicInt>
+#include <QElapsedTimer>
+#include <vector>
+#include <memory>
+#include <atomic>
+
+#define TRACE_RING_BUFFER_SIZE 16384
+
+namespace Helpers {
+    struct TraceEvent {
+        // names and categories are always string literals
+        const char *m_Name;
+        const char *m_Category;
+        qint64 m_StartUs;
+        qint64 m_DurationUs;
+    };
+
+    // single writer (owning thread), read only when dumping
+    class TraceRingBuffer {
+    public:
+        TraceRingBuffer(quint64 threadID):
+            m_Events(TRACE_RING_BUFFER_SIZE),
+            m_WriteIndex(0),
+            m_ThreadID(threadID)
+        { }
+
+    public:
+        void append(const char *name, const char *category, qint64 startUs, qint64 durationUs) {
+            const size_t index = m_WriteIndex.load(std::memory_order_relaxed);
+            TraceEvent &event = m_Events[index % TRACE_RING_BUFFER_SIZE];
+            event.m_Name = name;
+            event.m_Category = category;
+            event.m_StartUs = startUs;
+            event.m_DurationUs = durationUs;
+            m_WriteIndex.store(index + 1, std::memory_order_release);
+        }
+
+        quint64 getThreadID() const { return m_ThreadID; }
+        void copyEvents(std::vector<TraceEvent> &events) const;
+
+    private:
+        std::vector<TraceEvent> m_Events;
+        std::atomic_size_t m_WriteIndex;
+        quint64 m_ThreadID;
+    };
+
+    class Tracer
+    {
+    public:
+        static Tracer& getInstance()
+        {
+            static Tracer instance;
+            return instance;
+        }
+
+    public:
+        bool isEnabled() const { return m_Enabled.load() != 0; }
+        void setEnabled(bool value) { m_Enabled.store(value ? 1 : 0); }
+        qint64 nowUs() const { return m_Timer.nsecsElapsed() / 1000; }
+
+    public:
+        void addEvent(const char *name, const char *category, qint64 startUs, qint64 durationUs);
+        bool dumpChromeTrace(const QString &filepath);
+
+    private:
+        TraceRingBuffer *getThreadBuffer();
+
+    private:
+        Tracer() {
+            m_Timer.start();
+        }
+
+        Tracer(Tracer const&);
+        void operator=(Tracer const&);
+
+    private:
+        QMutex m_BuffersLock;
+        std::vector<std::shared_ptr<TraceRingBuffer> > m_Buffers;
+        QElapsedTimer m_Timer;
+        QAtomicInt m_Enabled;
+    };
+
+    class TraceScope {
+    public:
+        TraceScope(const char *name, const char *category):
+            m_Name(name),
+            m_Category(category),
+            m_StartUs(-1)
+        {
+            Tracer &tracer = Tracer::getInstance();
+            if (tracer.isEnabled()) {
+                m_StartUs = tracer.nowUs();
+            }
+        }
+
+        ~TraceScope() {
+            if (m_StartUs >= 0) {
+                Tracer &tracer = Tracer::getInstance();
+                tracer.addEvent(m_Name, m_Category, m_StartUs, tracer.nowUs() - m_StartUs);
+            }
+        }
+
+    private:
+        const char *m_Name;
+        const char *m_Category;
+        qint64 m_StartUs;
+    };
+}
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+
+#define TRACE_SPAN_CAT(category, name) Helpers::TraceScope TRACE_CONCAT(traceScope, __LINE__)(name, category)
+#define TRACE_SPAN(name) TRACE_SPAN_CAT("xpiks", name)
+#define TRACE_FUNCTION TRACE_SPAN(Q_FUNC_INFO)
+
+#endif // TRACING_H
@@ -12,6 +12,7 @@
 #include "../Commands/commandmanager.h"
 #include "../Helpers/stringhelper.h"
 #include "presetmodel.h"
+#include <algorithm>
 
 #define MAX_SAVE_PAUSE_RESTARTS 5
 #define PRESET_SAVE_TIMEOUT 3000
@@ -74,7 +75,11 @@ namespace KeywordsPresets {
             return;
         }
 
+        QWriteLocker locker(&m_PresetsLock);
+        Q_UNUSED(locker);
+
         m_PresetsList[presetIndex]->m_PresetName = name;
+        m_NameIndex.rename(presetIndex, name);
     }
     ID_t PresetKeywordsModel::addItem(const QString &presetName, const QStringList &keywords) {
         LOG_DEBUG << "#";
@@ -83,7 +88,11 @@ namespace KeywordsPresets {
 
         beginInsertRows(QModelIndex(), lastIndex, lastIndex);
         {
+            QWriteLocker locker(&m_PresetsLock);
+            Q_UNUSED(locker);
+
             m_PresetsList.push_back(new PresetModel(nextID, presetName, keywords, DEFAULT_GROUP_ID));
+            m_NameIndex.addName(lastIndex, presetName);
         }
         endInsertRows();
 
@@ -236,6 +245,43 @@ namespace KeywordsPresets {
         }
     }
 
+    void PresetKeywordsModel::foreachPresetCandidate(const QString &searchTerm, size_t maxMatches, size_t maxSimilar,
+                                                     const std::function<bool (size_t, PresetModel *, bool)> &action) {
+        QReadLocker locker(&m_PresetsLock);
+        Q_UNUSED(locker);
+
+        const size_t size = m_PresetsList.size();
+
+        if (searchTerm.isEmpty()) {
+            const size_t count = std::min(size, maxMatches);
+            for (size_t i = 0; i < count; i++) {
+                const bool shouldContinue = action(i, m_PresetsList[i], true);
+                if (!shouldContinue) { break; }
+            }
+
+            return;
+        }
+
+        std::vector<size_t> candidates;
+        m_NameIndex.findByPrefix(searchTerm, maxMatches, candidates);
+        m_NameIndex.findContaining(searchTerm, candidates);
+        const size_t matchesCount = candidates.size();
+        m_NameIndex.findFuzzyCandidates(searchTerm, maxSimilar, candidates);
+
+        std::vector<bool> visited(size, false);
+        const size_t candidatesCount = candidates.size();
+
+        for (size_t i = 0; i < candidatesCount; i++) {
+            const size_t index = candidates[i];
+            Q_ASSERT(index < size);
+            if (visited[index]) { continue; }
+            visited[index] = true;
+
+            const bool shouldContinue = action(index, m_PresetsList[index], i < matchesCount);
+            if (!shouldContinue) { break; }
+        }
+    }
+
     bool PresetKeywordsModel::tryGetGroupFromIndexUnsafe(size_t index, int &groupID) {
         Q_ASSERT(index < m_PresetsList.size());
         groupID = m_PresetsList[index]->m_GroupID;
@@ -286,30 +332,24 @@ namespace KeywordsPresets {
     bool PresetKeywordsModel::tryFindSinglePresetByNameUnsafe(const QString &name, bool strictMatch, size_t &index) {
         LOG_INFO << name;
         int foundIndex = -1;
-        size_t size = m_PresetsList.size();
         bool anyError = false;
+        std::vector<size_t> candidates;
+        m_NameIndex.findExact(name, candidates);
 
         if (!strictMatch) {
-            for (size_t i = 0; i < size; ++i) {
-                PresetModel *preset = m_PresetsList[i];
-
-                if (QString::compare(name, preset->m_PresetName, Qt::CaseInsensitive) == 0) {
-                    // full match always overrides
-                    foundIndex = (int)i;
-                    anyError = false;
-                    break;
-                } else if (preset->m_PresetName.contains(name, Qt::CaseInsensitive)) {
-                    if (foundIndex != -1) {
-                        anyError = true;
-                        foundIndex = -1;
-                        break;
-                    } else {
-                        foundIndex = (int)i;
-                    }
+            if (!candidates.empty()) {
+                // full match always overrides
+                foundIndex = (int)candidates.front();
+            } else {
+                m_NameIndex.findContaining(name, candidates);
+                if (candidates.size() == 1) {
+                    foundIndex = (int)candidates.front();
+                } else {
+                    anyError = candidates.size() > 1;
                 }
             }
         } else {
-            for (size_t i = 0; i < size; ++i) {
+            for (size_t i: candidates) {
                 PresetModel *preset = m_PresetsList[i];
                 if (preset->m_PresetName == name) {
                     if (foundIndex != -1) {
@@ -335,14 +375,12 @@ namespace KeywordsPresets {
 
     void PresetKeywordsModel::findPresetsByNameUnsafe(const QString &name, QVector<QPair<int, QString> > &results) {
         LOG_INFO << name;
-        size_t size = m_PresetsList.size();
+        std::vector<size_t> indices;
+        m_NameIndex.findContaining(name, indices);
 
-        for (size_t i = 0; i < size; ++i) {
+        for (size_t i: indices) {
             PresetModel *preset = m_PresetsList[i];
-
-            if (preset->m_PresetName.contains(name, Qt::CaseInsensitive)) {
-                results.push_back(qMakePair((int)i, preset->m_PresetName));
-            }
+            results.push_back(qMakePair((int)i, preset->m_PresetName));
         }
     }
 
@@ -357,6 +395,7 @@ namespace KeywordsPresets {
             beginInsertRows(QModelIndex(), lastIndex, lastIndex);
             {
                 m_PresetsList.push_back(new PresetModel(nextID, name, keywords, -1));
+                m_NameIndex.addName(lastIndex, name);
             }
             endInsertRows();
 
@@ -377,6 +416,7 @@ namespace KeywordsPresets {
             beginInsertRows(QModelIndex(), lastIndex, lastIndex);
             {
                 m_PresetsList.push_back(new PresetModel(nextID, name, keywords, DEFAULT_GROUP_ID));
+                m_NameIndex.addName(lastIndex, name);
             }
             endInsertRows();
 
@@ -398,13 +438,13 @@ namespace KeywordsPresets {
     bool PresetKeywordsModel::tryFindPresetByFullNameUnsafe(const QString &name, bool caseSensitive, size_t &index) {
         LOG_INFO << name;
         int foundIndex = -1;
-        size_t size = m_PresetsList.size();
-        Qt::CaseSensitivity caseSensivity = caseSensitive ? Qt::CaseSensitive : Qt::CaseInsensitive;
+        std::vector<size_t> candidates;
+        m_NameIndex.findExact(name, candidates);
 
-        for (size_t i = 0; i < size; ++i) {
+        for (size_t i: candidates) {
             PresetModel *preset = m_PresetsList[i];
 
-            if (QString::compare(name, preset->m_PresetName, caseSensivity) == 0) {
+            if (!caseSensitive || (name == preset->m_PresetName)) {
                 // full match always overrides
                 foundIndex = (int)i;
                 break;
@@ -463,6 +503,7 @@ namespace KeywordsPresets {
 
             lastIndex = getPresetsCount();
             m_PresetsList.push_back(new PresetModel(nextID));
+            m_NameIndex.addName(lastIndex, m_PresetsList.back()->m_PresetName);
         }
 
         beginInsertRows(QModelIndex(), lastIndex, lastIndex);
@@ -613,6 +654,7 @@ namespace KeywordsPresets {
 
         if (currentName != originalName) {
             m_PresetsList[row]->m_PresetName = currentName;
+            m_NameIndex.rename(row, currentName);
             m_PresetsList[row]->setIsNameDuplicateFlag(false);
             justChanged();
             QModelIndex index = this->index(row);
@@ -660,6 +702,7 @@ namespace KeywordsPresets {
                 int nextID = generateNextID();
                 PresetModel *model = new PresetModel(nextID, name, keywords, item.m_GroupID);
                 m_PresetsList.push_back(model);
+                m_NameIndex.addName(m_PresetsList.size() - 1, name);
                 xpiks()->submitItemForSpellCheck(&model->m_KeywordsModel, Common::SpellCheckFlags::Keywords);
             } else {
                 LOG_WARNING << "Preset" << name << "already exists. Skipping...";
@@ -680,6 +723,7 @@ namespace KeywordsPresets {
         }
 
         m_PresetsList.clear();
+        m_NameIndex.clear();
     }
 
     int PresetKeywordsModel::generateNextID() {
@@ -690,18 +734,11 @@ namespace KeywordsPresets {
     bool PresetKeywordsModel::hasDuplicateNamesUnsafe(const QString &presetName, size_t index) {
         if (presetName.isEmpty()) { return false; }
 
-        bool anyDuplicate = false;
-
-        const size_t size = m_PresetsList.size();
-        for (size_t i = 0; i < size; i++) {
-            if (i == index) { continue; }
-
-            if (QString::compare(m_PresetsList[i]->m_PresetName, presetName, Qt::CaseInsensitive) == 0) {
-                anyDuplicate = true;
-                break;
-            }
-        }
+        std::vector<size_t> indices;
+        m_NameIndex.findExact(presetName, indices);
 
+        const bool anyDuplicate = std::any_of(indices.begin(), indices.end(),
+                                              [index](size_t i) { return i != index; });
         return anyDuplicate;
     }
 
@@ -752,9 +789,15 @@ namespace KeywordsPresets {
 
             if (name != sanitized) {
                 LOG_INFO << "Preset" << row << name << "renamed to" << sanitized;
-                m_PresetsList[row]->m_PresetName = sanitized;
-                bool isDuplicate = hasDuplicateNamesUnsafe(name, row);
-                m_PresetsList[row]->setIsNameDuplicateFlag(isDuplicate);
+                {
+                    QWriteLocker locker(&m_PresetsLock);
+                    Q_UNUSED(locker);
+
+                    m_PresetsList[row]->m_PresetName = sanitized;
+                    m_NameIndex.rename(row, sanitized);
+                    bool isDuplicate = hasDuplicateNamesUnsafe(name, row);
+                    m_PresetsList[row]->setIsNameDuplicateFlag(isDuplicate);
+                }
                 justChanged();
                 emit dataChanged(index, index, QVector<int>() << NameRole << IsNameValidRole);
                 return true;
@@ -806,6 +849,8 @@ namespace KeywordsPresets {
         Q_ASSERT(row >= 0 && row < getPresetsCount());
         PresetModel *item = m_PresetsList[row];
         m_PresetsList.erase(m_PresetsList.begin() + row);
+        // positions of all following presets are shifted
+        m_NameIndex.rebuild(m_PresetsList);
         if (item->release()) {
             delete item;
         } else {
@@ -23,6 +23,7 @@
 #include "ipresetsmanager.h"
 #include "presetkeywordsmodelconfig.h"
 #include "presetgroupsmodel.h"
+#include "presetsnameindex.h"
 
 namespace KeywordsPresets {
     struct PresetModel;
@@ -79,6 +80,10 @@ namespace KeywordsPresets {
     public:
         bool tryFindPresetByFullName(const QString &name, bool caseSensitive, ID_t &id);
         void foreachPreset(const std::function<bool (size_t, PresetModel *)> &action);
+        // names starting with or containing the term go first (isMatch is true)
+        // and then names sharing parts with the term which may be misspelled
+        void foreachPresetCandidate(const QString &searchTerm, size_t maxMatches, size_t maxSimilar,
+                                    const std::function<bool (size_t, PresetModel *, bool isMatch)> &action);
 
         // safe and unsafe versions exist because of plugins which
         // can use presets manager in multithreaded way
@@ -168,6 +173,7 @@ namespace KeywordsPresets {
         QReadWriteLock m_PresetsLock;
         std::vector<PresetModel *> m_PresetsList;
         std::vector<PresetModel *> m_Finalizers;
+        PresetsNameIndex m_NameIndex;
         QAtomicInt m_LastUsedID;
         // timer needs to be here because of the multithreading
         QTimer m_SavingTimer;
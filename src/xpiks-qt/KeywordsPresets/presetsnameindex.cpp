@@ -0,0 +1,224 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "presetsnameindex.h"
+#include <algorithm>
+#include <iterator>
+#include "presetmodel.h"
+
+#define TRIGRAM_LENGTH 3
+
+namespace KeywordsPresets {
+    void extractTrigrams(const QString &foldedText, std::vector<QString> &trigrams) {
+        const int count = foldedText.length() - TRIGRAM_LENGTH + 1;
+        for (int i = 0; i < count; i++) {
+            trigrams.emplace_back(foldedText.mid(i, TRIGRAM_LENGTH));
+        }
+
+        std::sort(trigrams.begin(), trigrams.end());
+        trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+    }
+
+    void insertPosting(std::vector<quint32> &postings, quint32 index) {
+        auto it = std::lower_bound(postings.begin(), postings.end(), index);
+        if ((it == postings.end()) || (*it != index)) {
+            postings.insert(it, index);
+        }
+    }
+
+    template<typename Container>
+    void removePosting(Container &container, const QString &key, quint32 index) {
+        auto it = container.find(key);
+        if (it == container.end()) { return; }
+
+        std::vector<quint32> &postings = it.value();
+        auto postingIt = std::lower_bound(postings.begin(), postings.end(), index);
+        if ((postingIt != postings.end()) && (*postingIt == index)) {
+            postings.erase(postingIt);
+        }
+
+        if (postings.empty()) {
+            container.erase(it);
+        }
+    }
+
+    void PresetsNameIndex::clear() {
+        m_FoldedNames.clear();
+        m_NamesIndex.clear();
+        m_PrefixIndex.clear();
+        m_TrigramsIndex.clear();
+    }
+
+    void PresetsNameIndex::rebuild(const std::vector<PresetModel *> &presets) {
+        clear();
+
+        const size_t size = presets.size();
+        m_FoldedNames.reserve(size);
+
+        for (size_t i = 0; i < size; i++) {
+            addName(i, presets[i]->m_PresetName);
+        }
+    }
+
+    void PresetsNameIndex::addName(size_t index, const QString &name) {
+        Q_ASSERT(index == m_FoldedNames.size());
+        m_FoldedNames.emplace_back(name.toCaseFolded());
+        addToIndices(index, m_FoldedNames.back());
+    }
+
+    void PresetsNameIndex::rename(size_t index, const QString &newName) {
+        Q_ASSERT(index < m_FoldedNames.size());
+        if (index >= m_FoldedNames.size()) { return; }
+
+        QString foldedName = newName.toCaseFolded();
+        if (foldedName == m_FoldedNames[index]) { return; }
+
+        removeFromIndices(index, m_FoldedNames[index]);
+        m_FoldedNames[index] = foldedName;
+        addToIndices(index, foldedName);
+    }
+
+    void PresetsNameIndex::findExact(const QString &name, std::vector<size_t> &indices) const {
+        auto it = m_NamesIndex.constFind(name.toCaseFolded());
+        if (it == m_NamesIndex.constEnd()) { return; }
+
+        const std::vector<quint32> &postings = it.value();
+        indices.insert(indices.end(), postings.begin(), postings.end());
+    }
+
+    void PresetsNameIndex::findByPrefix(const QString &prefix, size_t maxCount, std::vector<size_t> &indices) const {
+        const QString foldedPrefix = prefix.toCaseFolded();
+        size_t count = 0;
+
+        auto it = m_PrefixIndex.lowerBound(foldedPrefix);
+        auto end = m_PrefixIndex.constEnd();
+
+        for (; it != end; ++it) {
+            if (!it.key().startsWith(foldedPrefix)) { break; }
+
+            for (quint32 index: it.value()) {
+                if (count >= maxCount) { return; }
+                indices.push_back(index);
+                count++;
+            }
+        }
+    }
+
+    void PresetsNameIndex::findContaining(const QString &term, std::vector<size_t> &indices) const {
+        const QString foldedTerm = term.toCaseFolded();
+        const size_t size = m_FoldedNames.size();
+
+        if (foldedTerm.length() < TRIGRAM_LENGTH) {
+            for (size_t i = 0; i < size; i++) {
+                if (m_FoldedNames[i].contains(foldedTerm)) {
+                    indices.push_back(i);
+                }
+            }
+
+            return;
+        }
+
+        std::vector<QString> trigrams;
+        extractTrigrams(foldedTerm, trigrams);
+
+        std::vector<const std::vector<quint32> *> postingLists;
+        postingLists.reserve(trigrams.size());
+
+        for (auto &trigram: trigrams) {
+            auto it = m_TrigramsIndex.constFind(trigram);
+            // name containing the term has to contain all its trigrams
+            if (it == m_TrigramsIndex.constEnd()) { return; }
+            postingLists.push_back(&it.value());
+        }
+
+        std::sort(postingLists.begin(), postingLists.end(),
+                  [](const std::vector<quint32> *a, const std::vector<quint32> *b) { return a->size() < b->size(); });
+
+        std::vector<quint32> candidates = *postingLists.front();
+        std::vector<quint32> intersection;
+
+        for (size_t i = 1; i < postingLists.size() && !candidates.empty(); i++) {
+            const std::vector<quint32> &postings = *postingLists[i];
+            intersection.clear();
+            std::set_intersection(candidates.begin(), candidates.end(),
+                                  postings.begin(), postings.end(),
+                                  std::back_inserter(intersection));
+            candidates.swap(intersection);
+        }
+
+        // shared trigrams do not guarantee they are in the same order
+        for (quint32 index: candidates) {
+            if (m_FoldedNames[index].contains(foldedTerm)) {
+                indices.push_back(index);
+            }
+        }
+    }
+
+    void PresetsNameIndex::findFuzzyCandidates(const QString &term, size_t maxCount, std::vector<size_t> &indices) const {
+        const QString foldedTerm = term.toCaseFolded();
+        if (foldedTerm.length() < TRIGRAM_LENGTH) { return; }
+
+        std::vector<QString> trigrams;
+        extractTrigrams(foldedTerm, trigrams);
+
+        QHash<quint32, int> sharedCounts;
+        for (auto &trigram: trigrams) {
+            auto it = m_TrigramsIndex.constFind(trigram);
+            if (it == m_TrigramsIndex.constEnd()) { continue; }
+
+            for (quint32 index: it.value()) {
+                sharedCounts[index]++;
+            }
+        }
+
+        std::vector<std::pair<int, quint32> > candidates;
+        candidates.reserve(sharedCounts.size());
+        for (auto it = sharedCounts.constBegin(), end = sharedCounts.constEnd(); it != end; ++it) {
+            candidates.emplace_back(it.value(), it.key());
+        }
+
+        // more shared trigrams first and otherwise in the order of presets
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const std::pair<int, quint32> &a, const std::pair<int, quint32> &b) {
+            return (a.first > b.first) || ((a.first == b.first) && (a.second < b.second));
+        });
+
+        const size_t count = std::min(maxCount, candidates.size());
+        for (size_t i = 0; i < count; i++) {
+            indices.push_back(candidates[i].second);
+        }
+    }
+
+    void PresetsNameIndex::addToIndices(size_t index, const QString &foldedName) {
+        const quint32 position = (quint32)index;
+
+        insertPosting(m_NamesIndex[foldedName], position);
+        insertPosting(m_PrefixIndex[foldedName], position);
+
+        std::vector<QString> trigrams;
+        extractTrigrams(foldedName, trigrams);
+        for (auto &trigram: trigrams) {
+            insertPosting(m_TrigramsIndex[trigram], position);
+        }
+    }
+
+    void PresetsNameIndex::removeFromIndices(size_t index, const QString &foldedName) {
+        const quint32 position = (quint32)index;
+
+        removePosting(m_NamesIndex, foldedName, position);
+        removePosting(m_PrefixIndex, foldedName, position);
+
+        std::vector<QString> trigrams;
+        extractTrigrams(foldedName, trigrams);
+        for (auto &trigram: trigrams) {
+            removePosting(m_TrigramsIndex, trigram, position);
+        }
+    }
+}
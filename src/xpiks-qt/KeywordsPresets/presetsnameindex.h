@@ -0,0 +1,54 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef PRESETSNAMEINDEX_H
+#define PRESETSNAMEINDEX_H
+
+#include <QString>
+#include <QHash>
+#include <QMap>
+#include <vector>
+
+namespace KeywordsPresets {
+    struct PresetModel;
+
+    // case-folded lookup structures over preset names keyed by position in presets list
+    // not thread-safe: guarded by the lock of the presets model
+    class PresetsNameIndex
+    {
+    public:
+        void clear();
+        void rebuild(const std::vector<PresetModel *> &presets);
+        // index should be the next position in presets list
+        void addName(size_t index, const QString &name);
+        void rename(size_t index, const QString &newName);
+
+    public:
+        size_t size() const { return m_FoldedNames.size(); }
+        // all results are positions in presets list
+        void findExact(const QString &name, std::vector<size_t> &indices) const;
+        void findByPrefix(const QString &prefix, size_t maxCount, std::vector<size_t> &indices) const;
+        void findContaining(const QString &term, std::vector<size_t> &indices) const;
+        void findFuzzyCandidates(const QString &term, size_t maxCount, std::vector<size_t> &indices) const;
+
+    private:
+        void addToIndices(size_t index, const QString &foldedName);
+        void removeFromIndices(size_t index, const QString &foldedName);
+
+    private:
+        std::vector<QString> m_FoldedNames;
+        QHash<QString, std::vector<quint32> > m_NamesIndex;
+        // ordered by name so names with same prefix form a continuous range
+        QMap<QString, std::vector<quint32> > m_PrefixIndex;
+        QHash<QString, std::vector<quint32> > m_TrigramsIndex;
+    };
+}
+
+#endif // PRESETSNAMEINDEX_H
@@ -8,7 +8,6 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
-#include <QThread>
 #include "../Common/defines.h"
 #include "maintenanceservice.h"
 #include "maintenanceworker.h"
@@ -37,22 +36,15 @@ namespace Maintenance {
 
         m_MaintenanceWorker = new MaintenanceWorker();
 
-        QThread *thread = new QThread();
-        m_MaintenanceWorker->moveToThread(thread);
-
-        QObject::connect(thread, &QThread::started, m_MaintenanceWorker, &MaintenanceWorker::process);
-        QObject::connect(m_MaintenanceWorker, &MaintenanceWorker::stopped, thread, &QThread::quit);
-
         QObject::connect(m_MaintenanceWorker, &MaintenanceWorker::stopped, m_MaintenanceWorker, &MaintenanceWorker::deleteLater);
-        QObject::connect(thread, &QThread::finished, thread, &QThread::deleteLater);
 
         QObject::connect(m_MaintenanceWorker, &MaintenanceWorker::stopped,
                          this, &MaintenanceService::workerFinished);
         QObject::connect(m_MaintenanceWorker, &MaintenanceWorker::destroyed,
                          this, &MaintenanceService::workerDestroyed);
 
-        LOG_DEBUG << "starting low priority thread...";
-        thread->start(QThread::LowPriority);
+        LOG_DEBUG << "starting background worker...";
+        m_MaintenanceWorker->doWorkOnExecutor(Common::TaskPriority::Background);
     }
 
     void MaintenanceService::stopService() {
@@ -8,10 +8,8 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
-#include <QThread>
 #include "maintenanceworker.h"
-
-#define MAINTENANCE_SLEEP 1
+#include "../Helpers/tracing.h"
 
 namespace Maintenance {
     bool MaintenanceWorker::initWorker() {
@@ -20,9 +18,7 @@ namespace Maintenance {
     }
 
     void MaintenanceWorker::processOneItem(std::shared_ptr<IMaintenanceItem> &item) {
+        TRACE_SPAN_CAT("maintenance", "Maintenance job");
         item->processJob();
-
-        // make this thread more non-intrusive
-        QThread::sleep(MAINTENANCE_SLEEP);
     }
 }
@@ -23,6 +23,7 @@ namespace Maintenance {
 
     protected:
         virtual bool initWorker() override;
+        virtual const char *getWorkerName() const override { return "MaintenanceWorker"; }
         virtual void processOneItem(std::shared_ptr<IMaintenanceItem> &item) override;
         virtual void onQueueIsEmpty() override { emit queueIsEmpty(); }
         virtual void workerStopped() override { emit stopped(); }
@@ -9,12 +9,52 @@
  */
 
 #include "cachedartwork.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QCryptographicHash>
 #include "../Models/artworkmetadata.h"
 #include "../Models/imageartwork.h"
 #include "../Models/videoartwork.h"
 #include "../Common/version.h"
 
+#define FINGERPRINT_CHUNK_SIZE 4096
+
 namespace MetadataIO {
+    QByteArray computeContentFingerprint(const QString &filepath) {
+        QFileInfo fi(filepath);
+        if (!fi.isFile()) { return QByteArray(); }
+
+        QFile file(filepath);
+        if (!file.open(QIODevice::ReadOnly)) { return QByteArray(); }
+
+        const qint64 size = file.size();
+        QCryptographicHash hash(QCryptographicHash::Md5);
+        hash.addData(file.read(FINGERPRINT_CHUNK_SIZE));
+
+        if (size > FINGERPRINT_CHUNK_SIZE) {
+            const qint64 tailStart = qMax((qint64)FINGERPRINT_CHUNK_SIZE, size - FINGERPRINT_CHUNK_SIZE);
+            if (file.seek(tailStart)) {
+                hash.addData(file.read(FINGERPRINT_CHUNK_SIZE));
+            }
+        }
+
+        QByteArray fingerprint;
+        QDataStream ds(&fingerprint, QIODevice::WriteOnly);
+        ds << (quint64)size;
+        ds << (qint64)fi.lastModified().toMSecsSinceEpoch();
+        ds << hash.result();
+
+        return fingerprint;
+    }
+
+    bool readFileState(const QString &filepath, quint64 &size, qint64 &modifiedTime) {
+        QFileInfo fi(filepath);
+        if (!fi.isFile()) { return false; }
+
+        size = (quint64)fi.size();
+        modifiedTime = fi.lastModified().toMSecsSinceEpoch();
+        return true;
+    }
 
     CachedArtwork::CachedArtwork():
         m_Version(0),
@@ -22,7 +62,9 @@ namespace MetadataIO {
         m_Flags(0),
         m_FilesizeBytes(0),
         m_CategoryID_1(0),
-        m_CategoryID_2(0)
+        m_CategoryID_2(0),
+        m_FingerprintedSize(0),
+        m_FingerprintedTime(0)
     {
         initSerializationVersion();
     }
@@ -31,7 +73,9 @@ namespace MetadataIO {
         m_Version(0),
         m_Flags(0),
         m_CategoryID_1(0),
-        m_CategoryID_2(0)
+        m_CategoryID_2(0),
+        m_FingerprintedSize(0),
+        m_FingerprintedTime(0)
     {
         initSerializationVersion();
 
@@ -73,7 +117,10 @@ namespace MetadataIO {
         m_CreationTime(from.m_CreationTime),
         m_Keywords(from.m_Keywords),
         m_ModelReleaseIDs(from.m_ModelReleaseIDs),
-        m_PropertyReleaseIDs(from.m_PropertyReleaseIDs)
+        m_PropertyReleaseIDs(from.m_PropertyReleaseIDs),
+        m_Fingerprint(from.m_Fingerprint),
+        m_FingerprintedSize(from.m_FingerprintedSize),
+        m_FingerprintedTime(from.m_FingerprintedTime)
     {
     }
 
@@ -94,6 +141,9 @@ namespace MetadataIO {
         m_Keywords = other.m_Keywords;
         m_ModelReleaseIDs = other.m_ModelReleaseIDs;
         m_PropertyReleaseIDs = other.m_PropertyReleaseIDs;
+        m_Fingerprint = other.m_Fingerprint;
+        m_FingerprintedSize = other.m_FingerprintedSize;
+        m_FingerprintedTime = other.m_FingerprintedTime;
 
         return *this;
     }
@@ -101,7 +151,7 @@ namespace MetadataIO {
     void CachedArtwork::initSerializationVersion() {
         if (XPIKS_MAJOR_VERSION_CHECK(1, 5) ||
                 XPIKS_MAJOR_VERSION_CHECK(1, 4)) {
-            m_Version = 1;
+            m_Version = 2;
         } else {
             Q_ASSERT(false);
         }
@@ -141,6 +191,12 @@ namespace MetadataIO {
         out << v.m_ModelReleaseIDs;
         out << v.m_PropertyReleaseIDs;
 
+        if (v.m_Version >= 2) {
+            out << v.m_Fingerprint;
+            out << v.m_FingerprintedSize;
+            out << v.m_FingerprintedTime;
+        }
+
         Q_ASSERT(out.status() == QDataStream::Ok);
 
         return out;
@@ -180,6 +236,12 @@ namespace MetadataIO {
         in >> v.m_ModelReleaseIDs;
         in >> v.m_PropertyReleaseIDs;
 
+        if (v.m_Version >= 2) {
+            in >> v.m_Fingerprint;
+            in >> v.m_FingerprintedSize;
+            in >> v.m_FingerprintedTime;
+        }
+
         Q_ASSERT(in.status() == QDataStream::Ok);
 
         return in;
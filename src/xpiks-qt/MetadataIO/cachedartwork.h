@@ -16,6 +16,7 @@
 #include <QString>
 #include <QDateTime>
 #include <QVector>
+#include <QByteArray>
 #include "../Common/flags.h"
 
 namespace Models {
@@ -57,8 +58,20 @@ namespace MetadataIO {
         QVector<quint16> m_ModelReleaseIDs;
         QVector<quint16> m_PropertyReleaseIDs;
         // END of version 1 data
+        // BEGIN of version 2 data
+        QByteArray m_Fingerprint;
+        // file size and modification time the fingerprint was computed for
+        quint64 m_FingerprintedSize;
+        qint64 m_FingerprintedTime;
+        // END of version 2 data
     };
 
+    // size, modification time and hash of the beginning and the end of the file
+    // empty if the file cannot be read
+    QByteArray computeContentFingerprint(const QString &filepath);
+    // cheap check if the file could have changed since the fingerprint
+    bool readFileState(const QString &filepath, quint64 &size, qint64 &modifiedTime);
+
     QDataStream &operator<<(QDataStream &out, const CachedArtwork &v);
     QDataStream &operator>>(QDataStream &in, CachedArtwork &v);
 }
@@ -11,34 +11,62 @@
 #include "csvexportworker.h"
 #include <QDir>
 #include <QFile>
+#include <QFileInfo>
+#include <QSet>
 #include <QDateTime>
+#include <QThread>
+#include <QtConcurrent>
+#include <array>
 #include "csvexportplansmodel.h"
 #include "../Models/artworkmetadata.h"
 
 #define DOUBLE_QUOTE "\""
+#define EMPTY_CSV_VALUE DOUBLE_QUOTE DOUBLE_QUOTE
+// rfc 4180 - eol should be dos-style
+#define CSV_EOL "\r\n"
+#define CSV_ROWS_CHUNK_SIZE 500
+#define CSV_CHUNKS_PER_THREAD 4
+#define CSV_AVERAGE_ROW_SIZE 512
 
 namespace MetadataIO {
-    void writeColumnNames(QFile &csvFile, const std::shared_ptr<CsvExportPlan> &plan) {
+    typedef std::array<QByteArray, EXPORT_PROPERTIES_NUMBER> CsvArtworkFields;
+
+    struct CsvRowsChunk {
+        size_t m_Begin;
+        size_t m_End;
+        // formatted rows for each of the exported plans
+        std::vector<QByteArray> m_Buffers;
+    };
+
+    QByteArray quoteCsvValue(const QString &value) {
+        QByteArray utf8 = value.toUtf8();
+        // rfc 4180 - double quotes inside the field are escaped with another double quote
+        if (utf8.contains('"')) {
+            utf8.replace(DOUBLE_QUOTE, EMPTY_CSV_VALUE);
+        }
+
+        QByteArray result;
+        result.reserve(utf8.size() + 2);
+        result.append(DOUBLE_QUOTE);
+        result.append(utf8);
+        result.append(DOUBLE_QUOTE);
+        return result;
+    }
+
+    QByteArray formatColumnNames(const std::shared_ptr<CsvExportPlan> &plan) {
         auto &properties = plan->m_PropertiesToExport;
 
         const size_t size = properties.size();
         Q_ASSERT(size != 0);
 
-        QString columnName = properties[0].m_ColumnName;
-        csvFile.write(DOUBLE_QUOTE);
-        csvFile.write(columnName.toUtf8());
-        csvFile.write(DOUBLE_QUOTE);
-
-        for (size_t i = 1; i < size; ++i) {
-            columnName = properties[i].m_ColumnName;
-
-            csvFile.write(", " DOUBLE_QUOTE);
-            csvFile.write(columnName.toUtf8());
-            csvFile.write(DOUBLE_QUOTE);
+        QByteArray header;
+        for (size_t i = 0; i < size; ++i) {
+            if (i > 0) { header.append(','); }
+            header.append(quoteCsvValue(properties[i].m_ColumnName));
         }
 
-        // rfc 4180 - eol should be dos-style
-        csvFile.write("\r\n");
+        header.append(CSV_EOL);
+        return header;
     }
 
     QString retrieveArtworkProperty(Models::ArtworkMetadata *artwork, CsvExportPropertyType property) {
@@ -54,45 +82,122 @@ namespace MetadataIO {
         }
     }
 
-    void writeRows(QFile &csvFile, const std::shared_ptr<CsvExportPlan> &plan, const ArtworksSnapshot::Container &artworks) {
+    void snapshotArtworkFields(Models::ArtworkMetadata *artwork, const std::array<bool, EXPORT_PROPERTIES_NUMBER> &usedProperties,
+                               CsvArtworkFields &fields) {
+        for (int i = 0; i < EXPORT_PROPERTIES_NUMBER; i++) {
+            if (!usedProperties[i]) { continue; }
+
+            const QString value = retrieveArtworkProperty(artwork, (CsvExportPropertyType)i);
+            fields[i] = value.isEmpty() ? QByteArray(EMPTY_CSV_VALUE) : quoteCsvValue(value);
+        }
+    }
+
+    void appendRow(QByteArray &buffer, const std::shared_ptr<CsvExportPlan> &plan, const CsvArtworkFields &fields) {
         auto &properties = plan->m_PropertiesToExport;
         const size_t propertiesSize = properties.size();
         Q_ASSERT(propertiesSize != 0);
 
-        for (auto &locker: artworks) {
-            Models::ArtworkMetadata *artwork = locker->getArtworkMetadata();
+        for (size_t i = 0; i < propertiesSize; ++i) {
+            if (i > 0) { buffer.append(','); }
+            buffer.append(fields[properties[i].m_PropertyType]);
+        }
+
+        buffer.append(CSV_EOL);
+    }
 
-            QString value = retrieveArtworkProperty(artwork, properties[0].m_PropertyType);
-            csvFile.write(DOUBLE_QUOTE);
-            csvFile.write(value.toUtf8());
-            csvFile.write(DOUBLE_QUOTE);
+    void formatRows(CsvRowsChunk &chunk, const std::vector<std::shared_ptr<CsvExportPlan> > &plans,
+                    const std::array<bool, EXPORT_PROPERTIES_NUMBER> &usedProperties,
+                    const ArtworksSnapshot::Container &artworks) {
+        const size_t plansCount = plans.size();
+        chunk.m_Buffers.resize(plansCount);
+        for (auto &buffer: chunk.m_Buffers) {
+            buffer.reserve((int)(chunk.m_End - chunk.m_Begin) * CSV_AVERAGE_ROW_SIZE);
+        }
 
-            for (size_t i = 1; i < propertiesSize; ++i) {
-                value = retrieveArtworkProperty(artwork, properties[i].m_PropertyType);
+        CsvArtworkFields fields;
+        for (size_t i = chunk.m_Begin; i < chunk.m_End; i++) {
+            Models::ArtworkMetadata *artwork = artworks[i]->getArtworkMetadata();
+            // every property is retrieved once for all the plans
+            snapshotArtworkFields(artwork, usedProperties, fields);
 
-                csvFile.write("," DOUBLE_QUOTE);
-                csvFile.write(value.toUtf8());
-                csvFile.write(DOUBLE_QUOTE);
+            for (size_t p = 0; p < plansCount; p++) {
+                appendRow(chunk.m_Buffers[p], plans[p], fields);
             }
+        }
+    }
 
-            // rfc 4180 - eol should be dos-style
-            csvFile.write("\r\n");
+    void writeRows(std::vector<std::unique_ptr<QFile> > &csvFiles, const std::vector<std::shared_ptr<CsvExportPlan> > &plans,
+                   const ArtworksSnapshot::Container &artworks) {
+        std::array<bool, EXPORT_PROPERTIES_NUMBER> usedProperties;
+        usedProperties.fill(false);
+        for (auto &plan: plans) {
+            for (auto &property: plan->m_PropertiesToExport) {
+                usedProperties[property.m_PropertyType] = true;
+            }
+        }
+
+        const size_t size = artworks.size();
+        const size_t chunksPerBatch = (size_t)qMax(1, QThread::idealThreadCount() * CSV_CHUNKS_PER_THREAD);
+        std::vector<CsvRowsChunk> chunks;
+        chunks.reserve(chunksPerBatch);
+
+        size_t batchStart = 0;
+        while (batchStart < size) {
+            chunks.clear();
+
+            size_t chunkStart = batchStart;
+            while ((chunkStart < size) && (chunks.size() < chunksPerBatch)) {
+                const size_t chunkEnd = std::min(size, chunkStart + CSV_ROWS_CHUNK_SIZE);
+                chunks.push_back(CsvRowsChunk{chunkStart, chunkEnd, std::vector<QByteArray>()});
+                chunkStart = chunkEnd;
+            }
+
+            QtConcurrent::blockingMap(chunks, [&plans, &usedProperties, &artworks](CsvRowsChunk &chunk) {
+                formatRows(chunk, plans, usedProperties, artworks);
+            });
+
+            // chunks are written in order so rows are in the order of artworks
+            for (auto &chunk: chunks) {
+                for (size_t p = 0; p < csvFiles.size(); p++) {
+                    csvFiles[p]->write(chunk.m_Buffers[p]);
+                }
+            }
+
+            batchStart = chunkStart;
         }
     }
 
-    void runExportPlan(const std::shared_ptr<CsvExportPlan> &plan, const QString &filepath, const ArtworksSnapshot::Container &artworks) {
-        LOG_DEBUG << "Plan" << plan->m_Name << ": exporting" << artworks.size() << "artwork(s) to" << filepath;
-        Q_ASSERT(plan->m_IsSelected);
+    void runExportPlans(const std::vector<std::shared_ptr<CsvExportPlan> > &plans, const QStringList &filepaths,
+                        const ArtworksSnapshot::Container &artworks) {
+        Q_ASSERT((int)plans.size() == filepaths.size());
+        LOG_DEBUG << "Exporting" << artworks.size() << "artwork(s) with" << plans.size() << "plan(s)";
+
+        std::vector<std::shared_ptr<CsvExportPlan> > openedPlans;
+        std::vector<std::unique_ptr<QFile> > csvFiles;
+
+        for (size_t i = 0; i < plans.size(); i++) {
+            auto &plan = plans[i];
+            const QString &filepath = filepaths[(int)i];
+            Q_ASSERT(plan->m_IsSelected);
+
+            std::unique_ptr<QFile> csvFile(new QFile(filepath));
+            if (csvFile->open(QIODevice::Truncate | QIODevice::WriteOnly)) {
+                LOG_DEBUG << "Plan" << plan->m_Name << ": exporting to" << filepath;
+                csvFile->write(formatColumnNames(plan));
+                openedPlans.push_back(plan);
+                csvFiles.emplace_back(std::move(csvFile));
+            } else {
+                LOG_WARNING << "Failed to open" << filepath;
+            }
+        }
+
+        if (csvFiles.empty()) { return; }
 
-        QFile csvFile(filepath);
-        if (csvFile.open(QIODevice::Truncate | QIODevice::WriteOnly)) {
-            writeColumnNames(csvFile, plan);
-            writeRows(csvFile, plan, artworks);
+        writeRows(csvFiles, openedPlans, artworks);
 
-            csvFile.flush();
-            csvFile.close();
-        } else {
-            LOG_WARNING << "Failed to open" << filepath;
+        for (auto &csvFile: csvFiles) {
+            csvFile->flush();
+            csvFile->close();
         }
     }
 
@@ -107,6 +212,21 @@ namespace MetadataIO {
         return result;
     }
 
+    QString makeUniqueFilename(const QString &filename, QSet<QString> &usedFilenames) {
+        // plans may share a name and file systems may be case insensitive
+        QString result = filename;
+        const QFileInfo fi(filename);
+        int suffix = 2;
+
+        while (usedFilenames.contains(result.toLower())) {
+            result = QString("%1-%2.%3").arg(fi.completeBaseName()).arg(suffix).arg(fi.suffix());
+            suffix++;
+        }
+
+        usedFilenames.insert(result.toLower());
+        return result;
+    }
+
     CsvExportWorker::CsvExportWorker(const std::vector<std::shared_ptr<CsvExportPlan> > &exportPlans,
                                      ArtworksSnapshot &selectedArtworks,
                                      QString exportDirectoryPath,
@@ -132,6 +252,10 @@ namespace MetadataIO {
             return;
         }
 
+        std::vector<std::shared_ptr<CsvExportPlan> > selectedPlans;
+        QStringList filepaths;
+        QSet<QString> usedFilenames;
+
         for (auto &plan: m_ExportPlans) {
             if (plan->m_IsSelected) {
                 Q_ASSERT(!plan->m_PropertiesToExport.empty());
@@ -140,17 +264,19 @@ namespace MetadataIO {
                     continue;
                 }
 
-                const QString filename = filenameForPlan(plan);
-                QString fullFilePath = directory.filePath(filename);
-
-                try {
-                    runExportPlan(plan, fullFilePath, m_ArtworksToExport.getRawData());
-                } catch(...) {
-                    LOG_WARNING << "Exception while exporting" << plan->m_Name << "to CSV";
-                }
+                const QString filename = makeUniqueFilename(filenameForPlan(plan), usedFilenames);
+                selectedPlans.push_back(plan);
+                filepaths.append(directory.filePath(filename));
             }
         }
 
+        // all selected plans are exported in a single pass over artworks
+        try {
+            runExportPlans(selectedPlans, filepaths, m_ArtworksToExport.getRawData());
+        } catch(...) {
+            LOG_WARNING << "Exception while exporting to CSV";
+        }
+
         if ((m_ExportPlans.size() * m_ArtworksToExport.size()) < 1000) {
             // simulate working for the spinner to show up
             QThread::usleep(1000);
@@ -0,0 +1,208 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "keywordscooccurrenceindex.h"
+#include <QSet>
+#include <QDataStream>
+#include <algorithm>
+#include "../Helpers/constants.h"
+#include "../Common/defines.h"
+
+// stock agencies do not accept more than 50 keywords
+#define MAX_ACCOUNTED_KEYWORDS 50
+#define MAX_COOCCURRING_KEYWORDS 100
+
+namespace MetadataIO {
+    typedef QVector<QPair<QString, qint32> > CooccurringKeywords;
+
+    QStringList normalizeKeywords(const QStringList &keywords) {
+        QStringList result;
+        result.reserve(qMin(keywords.size(), MAX_ACCOUNTED_KEYWORDS));
+        QSet<QString> accounted;
+
+        for (auto &keyword: keywords) {
+            const QString normalized = keyword.trimmed().toLower();
+            if (normalized.isEmpty() || accounted.contains(normalized)) { continue; }
+
+            accounted.insert(normalized);
+            result.append(normalized);
+
+            if (result.size() >= MAX_ACCOUNTED_KEYWORDS) { break; }
+        }
+
+        return result;
+    }
+
+    bool deserializeCooccurring(QByteArray &rawValue, CooccurringKeywords &cooccurring) {
+        QDataStream ds(&rawValue, QIODevice::ReadOnly);
+        ds >> cooccurring;
+        return ds.status() == QDataStream::Ok;
+    }
+
+    KeywordsCooccurrenceIndex::KeywordsCooccurrenceIndex()
+    {
+    }
+
+    bool KeywordsCooccurrenceIndex::initialize(std::shared_ptr<Helpers::Database> &database) {
+        LOG_DEBUG << "#";
+        Q_ASSERT(database);
+
+        m_DbIndex = database->getTable(Constants::KEYWORDS_COOCCURRENCE_TABLE);
+        if (!m_DbIndex) {
+            LOG_WARNING << "Failed to get table" << Constants::KEYWORDS_COOCCURRENCE_TABLE;
+            return false;
+        }
+
+        return true;
+    }
+
+    void KeywordsCooccurrenceIndex::accountKeywords(const QStringList &keywords, int sign) {
+        const QStringList normalized = normalizeKeywords(keywords);
+        const int size = normalized.size();
+        if (size < 2) { return; }
+
+        for (int i = 0; i < size; i++) {
+            QHash<QString, int> &changes = m_PendingChanges[normalized[i]];
+
+            for (int j = 0; j < size; j++) {
+                if (i == j) { continue; }
+                changes[normalized[j]] += sign;
+            }
+        }
+    }
+
+    void KeywordsCooccurrenceIndex::flush() {
+        if (m_PendingChanges.isEmpty()) { return; }
+        if (!m_DbIndex) { m_PendingChanges.clear(); return; }
+
+        LOG_DEBUG << m_PendingChanges.size() << "keyword(s) changed";
+
+        QVector<QByteArray> keys;
+        keys.reserve(m_PendingChanges.size());
+        for (auto it = m_PendingChanges.constBegin(); it != m_PendingChanges.constEnd(); ++it) {
+            keys.append(it.key().toUtf8());
+        }
+
+        QMutexLocker locker(&m_DbMutex);
+        Q_UNUSED(locker);
+
+        QVector<QByteArray> rawValues;
+        m_DbIndex->tryGetMany(keys, rawValues);
+        Q_ASSERT(rawValues.size() == keys.size());
+
+        QVector<QPair<QByteArray, QByteArray> > keyValuesList;
+        QVector<QByteArray> keysToDelete;
+        keyValuesList.reserve(keys.size());
+
+        int index = 0;
+        for (auto it = m_PendingChanges.constBegin(); it != m_PendingChanges.constEnd(); ++it, ++index) {
+            QHash<QString, qint32> counts;
+
+            CooccurringKeywords existing;
+            if (!rawValues[index].isEmpty() && deserializeCooccurring(rawValues[index], existing)) {
+                for (auto &item: existing) { counts.insert(item.first, item.second); }
+            }
+
+            const QHash<QString, int> &changes = it.value();
+            for (auto changeIt = changes.constBegin(); changeIt != changes.constEnd(); ++changeIt) {
+                counts[changeIt.key()] += changeIt.value();
+            }
+
+            CooccurringKeywords updated;
+            updated.reserve(counts.size());
+            for (auto countIt = counts.constBegin(); countIt != counts.constEnd(); ++countIt) {
+                if (countIt.value() > 0) {
+                    updated.append(qMakePair(countIt.key(), countIt.value()));
+                }
+            }
+
+            if (updated.isEmpty()) {
+                if (!rawValues[index].isEmpty()) { keysToDelete.append(keys[index]); }
+                continue;
+            }
+
+            // only the most frequent ones are kept so rare pairs are forgotten over time
+            std::sort(updated.begin(), updated.end(),
+                      [](const QPair<QString, qint32> &a, const QPair<QString, qint32> &b) {
+                return (a.second > b.second) || ((a.second == b.second) && (a.first < b.first));
+            });
+            if (updated.size() > MAX_COOCCURRING_KEYWORDS) { updated.resize(MAX_COOCCURRING_KEYWORDS); }
+
+            QByteArray rawValue;
+            QDataStream ds(&rawValue, QIODevice::WriteOnly);
+            ds << updated;
+            keyValuesList.append(qMakePair(keys[index], rawValue));
+        }
+
+        m_PendingChanges.clear();
+
+        QVector<int> failedIndices;
+        if (!m_DbIndex->trySetMany(keyValuesList, failedIndices)) {
+            LOG_WARNING << failedIndices.size() << "keyword(s) failed to update";
+        }
+
+        if (!keysToDelete.isEmpty()) {
+            m_DbIndex->tryDeleteMany(keysToDelete);
+        }
+    }
+
+    int KeywordsCooccurrenceIndex::suggest(const QStringList &keywords, int maxResults, QVector<QPair<QString, int> > &suggestions) {
+        const QStringList normalized = normalizeKeywords(keywords);
+        if (normalized.isEmpty() || !m_DbIndex) { return 0; }
+
+        QVector<QByteArray> keys;
+        keys.reserve(normalized.size());
+        for (auto &keyword: normalized) { keys.append(keyword.toUtf8()); }
+
+        QVector<QByteArray> rawValues;
+        {
+            QMutexLocker locker(&m_DbMutex);
+            Q_UNUSED(locker);
+            m_DbIndex->tryGetMany(keys, rawValues);
+        }
+
+        const QSet<QString> existing = normalized.toSet();
+        // keywords related to more of the given ones go first, then more frequent ones
+        QHash<QString, QPair<int, int> > scores;
+
+        for (auto &rawValue: rawValues) {
+            CooccurringKeywords cooccurring;
+            if (rawValue.isEmpty() || !deserializeCooccurring(rawValue, cooccurring)) { continue; }
+
+            for (auto &item: cooccurring) {
+                if (existing.contains(item.first)) { continue; }
+
+                QPair<int, int> &score = scores[item.first];
+                score.first++;
+                score.second += item.second;
+            }
+        }
+
+        QVector<QPair<QString, QPair<int, int> > > ranked;
+        ranked.reserve(scores.size());
+        for (auto it = scores.constBegin(); it != scores.constEnd(); ++it) {
+            ranked.append(qMakePair(it.key(), it.value()));
+        }
+
+        const int count = qMin(maxResults, ranked.size());
+        std::partial_sort(ranked.begin(), ranked.begin() + count, ranked.end(),
+                          [](const QPair<QString, QPair<int, int> > &a, const QPair<QString, QPair<int, int> > &b) {
+            return (a.second > b.second) || ((a.second == b.second) && (a.first < b.first));
+        });
+
+        suggestions.reserve(suggestions.size() + count);
+        for (int i = 0; i < count; i++) {
+            suggestions.append(qMakePair(ranked[i].first, ranked[i].second.second));
+        }
+
+        LOG_DEBUG << count << "suggestion(s) for" << normalized.size() << "keyword(s)";
+        return count;
+    }
+}
@@ -0,0 +1,48 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef KEYWORDSCOOCCURRENCEINDEX_H
+#define KEYWORDSCOOCCURRENCEINDEX_H
+
+#include <QHash>
+#include <QMutex>
+#include <QPair>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <memory>
+#include "../Helpers/database.h"
+
+namespace MetadataIO {
+    // persistent index: keyword -> most frequent keywords used together with it
+    class KeywordsCooccurrenceIndex
+    {
+    public:
+        KeywordsCooccurrenceIndex();
+
+    public:
+        bool initialize(std::shared_ptr<Helpers::Database> &database);
+        bool isInitialized() const { return m_DbIndex.get() != nullptr; }
+
+    public:
+        // sign is +1 for keywords of the artwork being added and -1 for removed ones
+        void accountKeywords(const QStringList &keywords, int sign);
+        void flush();
+        int suggest(const QStringList &keywords, int maxResults, QVector<QPair<QString, int> > &suggestions);
+
+    private:
+        QMutex m_DbMutex;
+        // keyword -> co-occurring keyword -> delta of the counter
+        QHash<QString, QHash<QString, int> > m_PendingChanges;
+        std::shared_ptr<Helpers::Database::Table> m_DbIndex;
+    };
+}
+
+#endif // KEYWORDSCOOCCURRENCEINDEX_H
@@ -0,0 +1,93 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "librarysearchworker.h"
+#include "../Suggestion/locallibraryquery.h"
+#include "../Suggestion/relatedkeywordsquery.h"
+#include "../Common/defines.h"
+
+namespace MetadataIO {
+    LibrarySearchWorker::LibrarySearchWorker(Helpers::DatabaseManager *dbManager, QObject *parent):
+        QObject(parent),
+        m_MetadataCache(dbManager, true)
+    {
+    }
+
+    bool LibrarySearchWorker::initWorker() {
+        LOG_DEBUG << "#";
+        // database might not exist yet on the first start
+        // so it will be opened again before the first search
+        ensureCacheInitialized();
+        return true;
+    }
+
+    void LibrarySearchWorker::processOneItem(std::shared_ptr<MetadataIOTaskBase> &item) {
+        do {
+            std::shared_ptr<MetadataSearchTask> searchItem = std::dynamic_pointer_cast<MetadataSearchTask>(item);
+            if (searchItem) {
+                processSearchItem(searchItem);
+                break;
+            }
+
+            std::shared_ptr<KeywordsSuggestionTask> suggestionItem = std::dynamic_pointer_cast<KeywordsSuggestionTask>(item);
+            if (suggestionItem) {
+                processSuggestionItem(suggestionItem);
+                break;
+            }
+
+            LOG_WARNING << "Unknown task";
+            Q_ASSERT(false);
+        } while (false);
+    }
+
+    void LibrarySearchWorker::processSearchItem(std::shared_ptr<MetadataSearchTask> &item) {
+        auto *localLibraryQuery = item->getQuery();
+        Q_ASSERT(localLibraryQuery != nullptr);
+
+        if (ensureCacheInitialized()) {
+            m_MetadataCache.search(localLibraryQuery->getSearchQuery(), localLibraryQuery->getResults());
+        } else {
+            LOG_WARNING << "Metadata cache is not available for search";
+        }
+
+        localLibraryQuery->notifyResultsReady();
+    }
+
+    void LibrarySearchWorker::processSuggestionItem(std::shared_ptr<KeywordsSuggestionTask> &item) {
+        auto *relatedKeywordsQuery = item->getQuery();
+        Q_ASSERT(relatedKeywordsQuery != nullptr);
+
+        if (ensureCacheInitialized()) {
+            m_MetadataCache.suggestKeywords(relatedKeywordsQuery->getKeywords(),
+                                            relatedKeywordsQuery->getMaxResults(),
+                                            relatedKeywordsQuery->getResults());
+        } else {
+            LOG_WARNING << "Metadata cache is not available for suggestions";
+        }
+
+        relatedKeywordsQuery->notifyResultsReady();
+    }
+
+    void LibrarySearchWorker::workerStopped() {
+        m_MetadataCache.finalize();
+        emit stopped();
+    }
+
+    bool LibrarySearchWorker::ensureCacheInitialized() {
+        if (m_MetadataCache.isInitialized()) { return true; }
+
+        bool success = m_MetadataCache.initialize();
+        if (!success) {
+            LOG_WARNING << "Failed to initialize read-only metadata cache";
+        }
+
+        return success;
+    }
+}
@@ -0,0 +1,58 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef LIBRARYSEARCHWORKER_H
+#define LIBRARYSEARCHWORKER_H
+
+#include <QObject>
+#include "../Common/itemprocessingworker.h"
+#include "metadataiotask.h"
+#include "metadatacache.h"
+
+namespace Helpers {
+    class DatabaseManager;
+}
+
+namespace MetadataIO {
+    class LibrarySearchWorker : public QObject, public Common::ItemProcessingWorker<MetadataIOTaskBase>
+    {
+        Q_OBJECT
+    public:
+        explicit LibrarySearchWorker(Helpers::DatabaseManager *dbManager, QObject *parent = 0);
+
+    protected:
+        virtual bool initWorker() override;
+        virtual const char *getWorkerName() const override { return "LibrarySearchWorker"; }
+        virtual void processOneItem(std::shared_ptr<MetadataIOTaskBase> &item) override;
+
+    protected:
+        virtual void onQueueIsEmpty() override { emit queueIsEmpty(); }
+        virtual void workerStopped() override;
+
+    public slots:
+        void process() { doWork(); }
+        void cancel() { stopWorking(); }
+
+    signals:
+        void stopped();
+        void queueIsEmpty();
+
+    private:
+        void processSearchItem(std::shared_ptr<MetadataSearchTask> &item);
+        void processSuggestionItem(std::shared_ptr<KeywordsSuggestionTask> &item);
+        bool ensureCacheInitialized();
+
+    private:
+        // read-only connection so that searches do not wait for imports
+        MetadataCache m_MetadataCache;
+    };
+}
+
+#endif // LIBRARYSEARCHWORKER_H
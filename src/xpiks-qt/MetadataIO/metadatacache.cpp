@@ -10,10 +10,13 @@
 
 #include "metadatacache.h"
 #include <QFileInfo>
+#include <QHash>
+#include <QSet>
 #include <functional>
 #include "../Models/artworkmetadata.h"
 #include "../Helpers/constants.h"
 #include "../Common/defines.h"
+#include "../AutoComplete/keywordsfrequencytrie.h"
 
 namespace MetadataIO {
     CachedArtwork::CachedArtworkType queryFlagToCachedType(Common::flag_t queryFlag) {
@@ -30,8 +33,11 @@ namespace MetadataIO {
         return searchType;
     }
 
-    MetadataCache::MetadataCache(Helpers::DatabaseManager *dbManager):
-        m_DatabaseManager(dbManager)
+    MetadataCache::MetadataCache(Helpers::DatabaseManager *dbManager, bool isReadOnly):
+        m_DatabaseManager(dbManager),
+        m_IsReadOnly(isReadOnly),
+        m_KeywordsFrequencies(nullptr),
+        m_KeywordsFrequenciesLoaded(false)
     {
         Q_ASSERT(dbManager != nullptr);
     }
@@ -40,9 +46,13 @@ namespace MetadataIO {
         LOG_DEBUG << "#";
         Q_ASSERT(m_DatabaseManager != nullptr);
 
+        // library search reads the cache through a separate connection
+        Common::flag_t flags = Helpers::Database::FlagAllowReaders;
+        if (m_IsReadOnly) { Common::SetFlag(flags, Helpers::Database::FlagReadOnly); }
+
         bool success = false;
         do {
-            m_Database = m_DatabaseManager->openDatabase(Constants::METADATA_CACHE_DB_NAME);
+            m_Database = m_DatabaseManager->openDatabase(Constants::METADATA_CACHE_DB_NAME, flags);
             if (!m_Database) {
                 LOG_WARNING << "Failed to open database";
                 break;
@@ -59,10 +69,28 @@ namespace MetadataIO {
                 break;
             }
 
+            if (!m_IsReadOnly) {
+                // fingerprints only speed up lookups of moved files so cache works without them
+                m_DbFingerprintsIndex = m_Database->getTable(Constants::METADATA_FINGERPRINTS_TABLE);
+                if (!m_DbFingerprintsIndex) {
+                    LOG_WARNING << "Failed to get table" << Constants::METADATA_FINGERPRINTS_TABLE;
+                }
+            }
+
+            // read-only connection will retry when the table is created
+            if (!m_KeywordsIndex.initialize(m_Database)) {
+                LOG_WARNING << "Keywords co-occurrence index is not available";
+            }
+
             success = true;
-            LOG_INFO << "Metadata cache initialized";
+            LOG_INFO << "Metadata cache initialized" << (m_IsReadOnly ? "(read-only)" : "");
         } while (false);
 
+        if (!success && m_Database) {
+            m_Database->close();
+            m_Database.reset();
+        }
+
         return success;
     }
 
@@ -76,6 +104,7 @@ namespace MetadataIO {
 
     void MetadataCache::sync() {
         LOG_DEBUG << "#";
+        Q_ASSERT(!m_IsReadOnly);
 
         flushWAL();
 
@@ -140,20 +169,67 @@ namespace MetadataIO {
             found = m_DbCacheIndex->tryGetValue(key, rawValue);
         }
 
+        CachedArtwork value;
         if (found) {
-            CachedArtwork value;
             QDataStream ds(&rawValue, QIODevice::ReadOnly);
             ds >> value;
             Q_ASSERT(ds.status() == QDataStream::Ok);
+            found = ds.status() == QDataStream::Ok;
+        }
 
-            if (ds.status() == QDataStream::Ok) {
-                cachedArtwork = value;
-            }
+        found = validateOrFindMoved(filepath, found, value);
+
+        if (found) {
+            cachedArtwork = value;
         }
 
         return found;
     }
 
+    int MetadataCache::readMany(const std::vector<Models::ArtworkMetadata *> &artworks, QVector<CachedArtwork> &cachedArtworks, QVector<int> &foundIndices) {
+        const int size = (int)artworks.size();
+        LOG_DEBUG << size << "artwork(s)";
+
+        QVector<QByteArray> keys;
+        keys.reserve(size);
+        for (auto *artwork: artworks) {
+            Q_ASSERT(artwork != nullptr);
+            keys.append(artwork->getFilepath().toUtf8());
+        }
+
+        QVector<QByteArray> rawValues;
+        {
+            QMutexLocker locker(&m_ReadMutex);
+            Q_UNUSED(locker);
+
+            m_DbCacheIndex->tryGetMany(keys, rawValues);
+        }
+
+        Q_ASSERT(rawValues.size() == size);
+        cachedArtworks.reserve(cachedArtworks.size() + size);
+        foundIndices.reserve(foundIndices.size() + size);
+
+        for (int i = 0; i < size; i++) {
+            QByteArray &rawValue = rawValues[i];
+            CachedArtwork value;
+            bool found = false;
+
+            if (!rawValue.isEmpty()) {
+                QDataStream ds(&rawValue, QIODevice::ReadOnly);
+                ds >> value;
+                Q_ASSERT(ds.status() == QDataStream::Ok);
+                found = ds.status() == QDataStream::Ok;
+            }
+
+            if (validateOrFindMoved(artworks[i]->getFilepath(), found, value)) {
+                cachedArtworks.append(value);
+                foundIndices.append(i);
+            }
+        }
+
+        return foundIndices.size();
+    }
+
     void MetadataCache::save(Models::ArtworkMetadata *metadata, bool overwrite) {
         Q_ASSERT(metadata != nullptr);
         if (metadata == nullptr) { return; }
@@ -161,11 +237,17 @@ namespace MetadataIO {
         CachedArtwork value(metadata);
         const QString &key = metadata->getFilepath();
 
+        const bool fingerprintChanged = updateFingerprint(key, value);
+
         if (overwrite) {
             m_SetWAL.set(key, value);
         } else {
             m_AddWal.set(key, value);
         }
+
+        if (fingerprintChanged) {
+            m_FingerprintsWAL.set(value.m_Fingerprint, key);
+        }
     }
 
     void MetadataCache::search(const Suggestion::SearchQuery &query, QVector<CachedArtwork> &results) {
@@ -219,14 +301,247 @@ namespace MetadataIO {
         LOG_DEBUG << "Found" << results.size() << "matches";
     }
 
+    int MetadataCache::suggestKeywords(const QStringList &keywords, int maxResults, QVector<QPair<QString, int> > &suggestions) {
+        LOG_DEBUG << keywords.size() << "keyword(s)";
+        if (!m_Database) { return 0; }
+
+        if (!m_KeywordsIndex.isInitialized()) {
+            if (!m_KeywordsIndex.initialize(m_Database)) { return 0; }
+        }
+
+        return m_KeywordsIndex.suggest(keywords, maxResults, suggestions);
+    }
+
+    void MetadataCache::loadKeywordsFrequencies() {
+        LOG_DEBUG << "#";
+        if ((m_KeywordsFrequencies == nullptr) || !m_DbCacheIndex) { return; }
+
+        QHash<QString, int> frequencies;
+
+        m_DbCacheIndex->foreachRow([&](QByteArray &, QByteArray &rawValue) {
+            CachedArtwork value;
+            QDataStream ds(&rawValue, QIODevice::ReadOnly);
+            ds >> value;
+            if (ds.status() != QDataStream::Ok) { /*continue;*/ return true; }
+
+            QSet<QString> accounted;
+            for (auto &keyword: value.m_Keywords) {
+                const QString normalized = keyword.trimmed().toLower();
+                if (normalized.isEmpty() || accounted.contains(normalized)) { continue; }
+
+                accounted.insert(normalized);
+                frequencies[normalized]++;
+            }
+
+            return true;
+        });
+
+        // items in WAL will be accounted as changes when flushed
+        m_KeywordsFrequencies->clear();
+        m_KeywordsFrequencies->accountFrequencies(frequencies);
+        m_KeywordsFrequenciesLoaded = true;
+
+        LOG_INFO << "Loaded" << frequencies.size() << "keyword(s) frequencies";
+    }
+
     void MetadataCache::flushWAL() {
         LOG_DEBUG << "#";
         if (!m_DbCacheIndex) { return; }
 
+        updateKeywordsIndex();
+
         LOG_DEBUG << "Add WAL size:" << m_AddWal.size();
         LOG_DEBUG << "Set WAL size:" << m_SetWAL.size();
 
         m_AddWal.flush(m_DbCacheIndex);
         m_SetWAL.flush(m_DbCacheIndex);
+
+        if (m_DbFingerprintsIndex) {
+            LOG_DEBUG << "Fingerprints WAL size:" << m_FingerprintsWAL.size();
+            m_FingerprintsWAL.flush(m_DbFingerprintsIndex);
+        }
+
+        m_KeywordsIndex.flush();
+    }
+
+    void MetadataCache::updateKeywordsIndex() {
+        const bool updateCooccurrence = m_KeywordsIndex.isInitialized();
+        const bool updateFrequencies = (m_KeywordsFrequencies != nullptr) && m_KeywordsFrequenciesLoaded;
+        if (!updateCooccurrence && !updateFrequencies) { return; }
+
+        QHash<QString, QStringList> newKeywords;
+        QSet<QString> addedOnly;
+
+        m_AddWal.forEach([&](const QString &filepath, const CachedArtwork &value) {
+            newKeywords.insert(filepath, value.m_Keywords);
+            addedOnly.insert(filepath);
+        });
+
+        // set WAL is flushed last so it overwrites same items in add WAL
+        m_SetWAL.forEach([&](const QString &filepath, const CachedArtwork &value) {
+            newKeywords.insert(filepath, value.m_Keywords);
+            addedOnly.remove(filepath);
+        });
+
+        if (newKeywords.isEmpty()) { return; }
+
+        QVector<QByteArray> keys;
+        keys.reserve(newKeywords.size());
+        for (auto it = newKeywords.constBegin(); it != newKeywords.constEnd(); ++it) {
+            keys.append(it.key().toUtf8());
+        }
+
+        QVector<QByteArray> rawValues;
+        {
+            QMutexLocker locker(&m_ReadMutex);
+            Q_UNUSED(locker);
+
+            m_DbCacheIndex->tryGetMany(keys, rawValues);
+        }
+
+        Q_ASSERT(rawValues.size() == keys.size());
+
+        int index = 0;
+        for (auto it = newKeywords.constBegin(); it != newKeywords.constEnd(); ++it, ++index) {
+            QByteArray &rawValue = rawValues[index];
+            const bool exists = !rawValue.isEmpty();
+
+            // add WAL does not overwrite existing items
+            if (exists && addedOnly.contains(it.key())) { continue; }
+
+            if (exists) {
+                CachedArtwork previous;
+                QDataStream ds(&rawValue, QIODevice::ReadOnly);
+                ds >> previous;
+
+                if (ds.status() == QDataStream::Ok) {
+                    if (previous.m_Keywords == it.value()) { continue; }
+                    accountKeywords(previous.m_Keywords, -1, updateCooccurrence, updateFrequencies);
+                }
+            }
+
+            accountKeywords(it.value(), +1, updateCooccurrence, updateFrequencies);
+        }
+    }
+
+    void MetadataCache::accountKeywords(const QStringList &keywords, int sign, bool updateCooccurrence, bool updateFrequencies) {
+        if (updateCooccurrence) {
+            m_KeywordsIndex.accountKeywords(keywords, sign);
+        }
+
+        if (updateFrequencies) {
+            m_KeywordsFrequencies->accountKeywords(keywords, sign);
+        }
+    }
+
+    bool MetadataCache::validateOrFindMoved(const QString &filepath, bool foundByPath, CachedArtwork &cachedArtwork) {
+        if (foundByPath) {
+            // entries saved before fingerprints were introduced cannot be validated
+            if (cachedArtwork.m_Fingerprint.isEmpty()) { return true; }
+
+            quint64 size = 0;
+            qint64 modifiedTime = 0;
+            if (!readFileState(filepath, size, modifiedTime)) { return true; }
+
+            // file is read only if it could have changed since it was cached
+            if ((cachedArtwork.m_FingerprintedSize == size) &&
+                    (cachedArtwork.m_FingerprintedTime == modifiedTime)) {
+                return true;
+            }
+        }
+
+        const QByteArray fingerprint = computeContentFingerprint(filepath);
+        if (fingerprint.isEmpty()) { return foundByPath; }
+
+        if (foundByPath) {
+            if (cachedArtwork.m_Fingerprint == fingerprint) { return true; }
+            LOG_INFO << "Cached metadata is outdated for" << filepath;
+        }
+
+        bool found = readByFingerprint(fingerprint, cachedArtwork);
+        if (found) {
+            LOG_DEBUG << filepath << "found in cache as" << cachedArtwork.m_Filepath;
+            cachedArtwork.m_Filepath = filepath;
+        }
+
+        return found;
+    }
+
+    bool MetadataCache::readSaved(const QString &filepath, CachedArtwork &cachedArtwork) {
+        if (m_SetWAL.tryGet(filepath, cachedArtwork)) { return true; }
+        if (m_AddWal.tryGet(filepath, cachedArtwork)) { return true; }
+
+        QByteArray rawValue;
+        bool found = false;
+
+        {
+            QMutexLocker locker(&m_ReadMutex);
+            Q_UNUSED(locker);
+
+            found = m_DbCacheIndex->tryGetValue(filepath.toUtf8(), rawValue);
+        }
+
+        if (!found) { return false; }
+
+        QDataStream ds(&rawValue, QIODevice::ReadOnly);
+        ds >> cachedArtwork;
+        return ds.status() == QDataStream::Ok;
+    }
+
+    bool MetadataCache::updateFingerprint(const QString &filepath, CachedArtwork &cachedArtwork) {
+        quint64 size = 0;
+        qint64 modifiedTime = 0;
+        if (!readFileState(filepath, size, modifiedTime)) { return false; }
+
+        cachedArtwork.m_FingerprintedSize = size;
+        cachedArtwork.m_FingerprintedTime = modifiedTime;
+
+        // most saves are edits of metadata in the same unchanged file
+        CachedArtwork saved;
+        if (readSaved(filepath, saved) &&
+                !saved.m_Fingerprint.isEmpty() &&
+                (saved.m_FingerprintedSize == size) &&
+                (saved.m_FingerprintedTime == modifiedTime)) {
+            cachedArtwork.m_Fingerprint = saved.m_Fingerprint;
+            return false;
+        }
+
+        cachedArtwork.m_Fingerprint = computeContentFingerprint(filepath);
+        return !cachedArtwork.m_Fingerprint.isEmpty();
+    }
+
+    bool MetadataCache::readByFingerprint(const QByteArray &fingerprint, CachedArtwork &cachedArtwork) {
+        if (!m_DbFingerprintsIndex) { return false; }
+
+        QByteArray rawPath, rawValue;
+        bool found = false;
+
+        {
+            QMutexLocker locker(&m_ReadMutex);
+            Q_UNUSED(locker);
+
+            if (m_DbFingerprintsIndex->tryGetValue(fingerprint, rawPath)) {
+                QString previousPath;
+                QDataStream ds(&rawPath, QIODevice::ReadOnly);
+                ds >> previousPath;
+
+                if (ds.status() == QDataStream::Ok) {
+                    found = m_DbCacheIndex->tryGetValue(previousPath.toUtf8(), rawValue);
+                }
+            }
+        }
+
+        if (!found) { return false; }
+
+        CachedArtwork value;
+        QDataStream ds(&rawValue, QIODevice::ReadOnly);
+        ds >> value;
+        if (ds.status() != QDataStream::Ok) { return false; }
+
+        // the file at previous path could have been changed since then
+        if (value.m_Fingerprint != fingerprint) { return false; }
+
+        cachedArtwork = value;
+        return true;
     }
 }
@@ -15,12 +15,17 @@
 #include <QReadWriteLock>
 #include "../Helpers/database.h"
 #include "cachedartwork.h"
+#include "keywordscooccurrenceindex.h"
 #include "../Suggestion/searchquery.h"
 
 namespace Models {
     class ArtworkMetadata;
 }
 
+namespace AutoComplete {
+    class KeywordsFrequencyTrie;
+}
+
 namespace MetadataIO {
     class ArtworkSetWAL: public Helpers::WriteAheadLog<QString, CachedArtwork> {
     protected:
@@ -40,10 +45,18 @@ namespace MetadataIO {
         }
     };
 
+    class FingerprintsWAL: public Helpers::WriteAheadLog<QByteArray, QString> {
+    protected:
+        virtual QByteArray keyToByteArray(const QByteArray &key) const override { return key; }
+        virtual bool doFlush(std::shared_ptr<Helpers::Database::Table> &dbTable, const QVector<QPair<QByteArray, QByteArray> > &keyValuesList, QVector<int> &failedIndices) override {
+            return dbTable->trySetMany(keyValuesList, failedIndices);
+        }
+    };
+
     class MetadataCache
     {
     public:
-        MetadataCache(Helpers::DatabaseManager *dbManager);
+        MetadataCache(Helpers::DatabaseManager *dbManager, bool isReadOnly = false);
 
     public:
         bool initialize();
@@ -59,21 +72,44 @@ namespace MetadataIO {
 
     public:
         bool read(Models::ArtworkMetadata *artwork, CachedArtwork &cachedArtwork);
+        int readMany(const std::vector<Models::ArtworkMetadata *> &artworks, QVector<CachedArtwork> &cachedArtworks, QVector<int> &foundIndices);
         void save(Models::ArtworkMetadata *metadata, bool overwrite = true);
 
     public:
         void search(const Suggestion::SearchQuery &query, QVector<CachedArtwork> &results);
+        int suggestKeywords(const QStringList &keywords, int maxResults, QVector<QPair<QString, int> > &suggestions);
+
+    public:
+        void setKeywordsFrequencies(AutoComplete::KeywordsFrequencyTrie *keywordsFrequencies) { m_KeywordsFrequencies = keywordsFrequencies; }
+        // full scan of the cache, afterwards frequencies are updated with every flush
+        void loadKeywordsFrequencies();
 
     private:
+        bool validateOrFindMoved(const QString &filepath, bool foundByPath, CachedArtwork &cachedArtwork);
+        bool readSaved(const QString &filepath, CachedArtwork &cachedArtwork);
+        bool updateFingerprint(const QString &filepath, CachedArtwork &cachedArtwork);
+        bool readByFingerprint(const QByteArray &fingerprint, CachedArtwork &cachedArtwork);
+        void updateKeywordsIndex();
+        void accountKeywords(const QStringList &keywords, int sign, bool updateCooccurrence, bool updateFrequencies);
         void flushWAL();
 
+    public:
+        bool isInitialized() const { return m_DbCacheIndex.get() != nullptr; }
+
     private:
         QMutex m_ReadMutex;
         Helpers::DatabaseManager *m_DatabaseManager;
+        bool m_IsReadOnly;
         std::shared_ptr<Helpers::Database::Table> m_DbCacheIndex;
+        // content fingerprint -> filepath in the main index
+        std::shared_ptr<Helpers::Database::Table> m_DbFingerprintsIndex;
         std::shared_ptr<Helpers::Database> m_Database;
         ArtworkSetWAL m_SetWAL;
         ArtworkAddWAL m_AddWal;
+        FingerprintsWAL m_FingerprintsWAL;
+        KeywordsCooccurrenceIndex m_KeywordsIndex;
+        AutoComplete::KeywordsFrequencyTrie *m_KeywordsFrequencies;
+        bool m_KeywordsFrequenciesLoaded;
     };
 }
 
@@ -88,8 +88,12 @@ namespace MetadataIO {
     }
 
     int MetadataIOCoordinator::readMetadataExifTool(const ArtworksSnapshot &artworksToRead, quint32 storageReadBatchID) {
+        return readMetadataExifTool(artworksToRead, QVector<quint32>() << storageReadBatchID);
+    }
+
+    int MetadataIOCoordinator::readMetadataExifTool(const ArtworksSnapshot &artworksToRead, const QVector<quint32> &storageReadBatchIDs) {
         int importID = getNextImportID();
-        initializeImport(artworksToRead, importID, storageReadBatchID);
+        initializeImport(artworksToRead, importID, storageReadBatchIDs);
 
         libxpks::io::ReadingOrchestrator readingOrchestrator(&m_ReadingHub,
                                                              m_CommandManager->getSettingsModel());
@@ -103,6 +107,7 @@ namespace MetadataIO {
         m_WritingAsyncCoordinator.reset();
 
         lockForIO(artworksToWrite);
+        m_WrittenArtworks.copy(artworksToWrite);
 
         // this should prevent a race between video thumbnails and exiftool
         // https://github.com/ribtoks/xpiks/issues/477
@@ -133,6 +138,7 @@ namespace MetadataIO {
         m_WritingAsyncCoordinator.reset();
 
         lockForIO(artworksToWipe);
+        m_WrittenArtworks.clear();
 
         // this should prevent a race between video thumbnails and exiftool
         // https://github.com/ribtoks/xpiks/issues/477
@@ -188,6 +194,13 @@ namespace MetadataIO {
         Models::ArtItemsModel *artItemsModel = m_CommandManager->getArtItemsModel();
         artItemsModel->unlockAllForIO();
 
+        // fingerprints of cached artworks changed together with the files
+        if (!m_WrittenArtworks.empty()) {
+            MetadataIOService *metadataIOService = m_CommandManager->getMetadataIOService();
+            metadataIOService->writeArtworks(m_WrittenArtworks.getWeakSnapshot());
+            m_WrittenArtworks.clear();
+        }
+
         emit metadataWritingFinished();
     }
 
@@ -204,8 +217,8 @@ namespace MetadataIO {
         return id;
     }
 
-    void MetadataIOCoordinator::initializeImport(const ArtworksSnapshot &artworksToRead, int importID, quint32 storageReadBatchID) {
-        m_ReadingHub.initializeImport(artworksToRead, importID, storageReadBatchID);
+    void MetadataIOCoordinator::initializeImport(const ArtworksSnapshot &artworksToRead, int importID, const QVector<quint32> &storageReadBatchIDs) {
+        m_ReadingHub.initializeImport(artworksToRead, importID, storageReadBatchIDs);
 
         setHasErrors(false);
         setIsInProgress(false);
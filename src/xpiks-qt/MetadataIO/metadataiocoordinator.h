@@ -89,6 +89,7 @@ namespace MetadataIO {
 
     public:
         int readMetadataExifTool(const ArtworksSnapshot &artworksToRead, quint32 storageReadBatchID);
+        int readMetadataExifTool(const ArtworksSnapshot &artworksToRead, const QVector<quint32> &storageReadBatchIDs);
         void writeMetadataExifTool(const ArtworksSnapshot &artworksToWrite, bool useBackups);
         void wipeAllMetadataExifTool(const ArtworksSnapshot &artworksToWipe, bool useBackups);
         void autoDiscoverExiftool();
@@ -112,13 +113,15 @@ namespace MetadataIO {
 
     private:
         int getNextImportID();
-        void initializeImport(const ArtworksSnapshot &artworksToRead, int importID, quint32 storageReadBatchID);
+        void initializeImport(const ArtworksSnapshot &artworksToRead, int importID, const QVector<quint32> &storageReadBatchIDs);
         void readingFinishedHandler(bool ignoreBackups);
         void afterImportHandler(const QVector<Models::ArtworkMetadata*> &itemsToRead, bool ignoreBackups);
 
     private:
         MetadataReadingHub m_ReadingHub;
         Helpers::AsyncCoordinator m_WritingAsyncCoordinator;
+        // metadata cache is updated again when files are written
+        ArtworksSnapshot m_WrittenArtworks;
         QString m_RecommendedExiftoolPath;
         int m_LastImportID;
         std::set<int> m_PreviousImportIDs;
@@ -9,21 +9,25 @@
  */
 
 #include "metadataioservice.h"
-#include <QThread>
 #include <QTimerEvent>
+#include <algorithm>
 #include "metadataioworker.h"
+#include "librarysearchworker.h"
 #include "metadataiotask.h"
 #include "../Commands/commandmanager.h"
 #include "../Helpers/database.h"
+#include "../AutoComplete/autocompleteservice.h"
 
 #define SAVER_TIMER_TIMEOUT 2000
 #define SAVER_TIMER_MAX_RESTARTS 5
+#define READ_BATCH_SIZE 200
 
 namespace MetadataIO {
     MetadataIOService::MetadataIOService(QObject *parent):
         QObject(parent),
         Common::DelayedActionEntity(SAVER_TIMER_TIMEOUT, SAVER_TIMER_MAX_RESTARTS),
         m_MetadataIOWorker(nullptr),
+        m_LibrarySearchWorker(nullptr),
         m_IsStopped(false)
     {
         // timers could not be started from another thread
@@ -34,17 +38,13 @@ namespace MetadataIO {
         Q_ASSERT(m_MetadataIOWorker == nullptr);
         Helpers::DatabaseManager *dbManager = m_CommandManager->getDatabaseManager();
         QMLExtensions::ArtworksUpdateHub *updateHub = m_CommandManager->getArtworksUpdateHub();
+        AutoComplete::AutoCompleteService *autoCompleteService = m_CommandManager->getAutoCompleteService();
+        AutoComplete::KeywordsFrequencyTrie *keywordsFrequencies = nullptr;
+        if (autoCompleteService != nullptr) { keywordsFrequencies = autoCompleteService->getKeywordsFrequencies(); }
 
-        m_MetadataIOWorker = new MetadataIOWorker(dbManager, updateHub);
-
-        QThread *thread = new QThread();
-        m_MetadataIOWorker->moveToThread(thread);
-
-        QObject::connect(thread, &QThread::started, m_MetadataIOWorker, &MetadataIOWorker::process);
-        QObject::connect(m_MetadataIOWorker, &MetadataIOWorker::stopped, thread, &QThread::quit);
+        m_MetadataIOWorker = new MetadataIOWorker(dbManager, updateHub, keywordsFrequencies);
 
         QObject::connect(m_MetadataIOWorker, &MetadataIOWorker::stopped, m_MetadataIOWorker, &MetadataIOWorker::deleteLater);
-        QObject::connect(thread, &QThread::finished, thread, &QThread::deleteLater);
 
         QObject::connect(m_MetadataIOWorker, &MetadataIOWorker::stopped,
                          this, &MetadataIOService::workerFinished);
@@ -52,7 +52,9 @@ namespace MetadataIO {
         QObject::connect(m_MetadataIOWorker, &MetadataIOWorker::readyToImportFromStorage,
                          this, &MetadataIOService::onReadyToImportFromStorage);
 
-        thread->start();
+        m_MetadataIOWorker->doWorkOnExecutor(Common::TaskPriority::Normal);
+
+        startSearchWorker(dbManager);
 
         m_IsStopped = false;
     }
@@ -61,6 +63,8 @@ namespace MetadataIO {
         LOG_DEBUG << "#";
         Q_ASSERT(m_MetadataIOWorker != nullptr);
         m_MetadataIOWorker->stopWorking();
+        Q_ASSERT(m_LibrarySearchWorker != nullptr);
+        m_LibrarySearchWorker->stopWorking();
         m_IsStopped = true;
     }
 
@@ -82,6 +86,12 @@ namespace MetadataIO {
         m_MetadataIOWorker->waitIdle();
     }
 
+    void MetadataIOService::warmup() {
+        LOG_DEBUG << "#";
+        if (m_IsStopped || (m_MetadataIOWorker == nullptr)) { return; }
+        m_MetadataIOWorker->submitWarmup();
+    }
+
     void MetadataIOService::writeArtwork(Models::ArtworkMetadata *metadata) {
         Q_ASSERT(metadata != nullptr);
         if (m_IsStopped) { return; }
@@ -97,13 +107,16 @@ namespace MetadataIO {
         LOG_INFO << snapshot.size() << "artwork(s)";
         if (m_IsStopped) { return 0; }
         std::vector<std::shared_ptr<MetadataIOTaskBase> > jobs;
-        jobs.reserve(snapshot.size());
+        jobs.reserve(snapshot.size() / READ_BATCH_SIZE + 1);
 
         auto &items = snapshot.getRawData();
+        const size_t size = items.size();
 
-        for (auto &item: items) {
-            Models::ArtworkMetadata *artwork = item->getArtworkMetadata();
-            jobs.emplace_back(new MetadataReadWriteTask(artwork, MetadataReadWriteTask::Read));
+        // each batch is read from the cache with a few statements instead of one per artwork
+        for (size_t start = 0; start < size; start += READ_BATCH_SIZE) {
+            const size_t end = std::min(start + (size_t)READ_BATCH_SIZE, size);
+            ArtworksSnapshot::Container rawSnapshot(items.begin() + start, items.begin() + end);
+            jobs.emplace_back(new MetadataReadBatchTask(rawSnapshot));
         }
 
         MetadataIOWorker::batch_id_t batchID = m_MetadataIOWorker->submitItems(jobs);
@@ -150,7 +163,26 @@ namespace MetadataIO {
         Q_ASSERT(query != nullptr);
         if (m_IsStopped) { return; }
         std::shared_ptr<MetadataSearchTask> jobItem(new MetadataSearchTask(query));
-        m_MetadataIOWorker->submitFirst(jobItem);
+        m_LibrarySearchWorker->submitFirst(jobItem);
+    }
+
+    void MetadataIOService::suggestKeywords(Suggestion::RelatedKeywordsQuery *query) {
+        LOG_DEBUG << "#";
+        Q_ASSERT(query != nullptr);
+        if (m_IsStopped) { return; }
+        std::shared_ptr<MetadataIOTaskBase> jobItem(new KeywordsSuggestionTask(query));
+        m_LibrarySearchWorker->submitFirst(jobItem);
+    }
+
+    void MetadataIOService::startSearchWorker(Helpers::DatabaseManager *dbManager) {
+        Q_ASSERT(m_LibrarySearchWorker == nullptr);
+        // search uses own read-only connection so it is not queued behind reads and writes of the import
+        m_LibrarySearchWorker = new LibrarySearchWorker(dbManager);
+
+        QObject::connect(m_LibrarySearchWorker, &LibrarySearchWorker::stopped, m_LibrarySearchWorker, &LibrarySearchWorker::deleteLater);
+
+        // suggestions are requested from the UI
+        m_LibrarySearchWorker->doWorkOnExecutor(Common::TaskPriority::Interactive);
     }
 
     void MetadataIOService::workerFinished() {
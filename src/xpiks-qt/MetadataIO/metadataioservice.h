@@ -15,14 +15,21 @@
 #include <QVector>
 #include "../Common/baseentity.h"
 #include "../Suggestion/locallibraryquery.h"
+#include "../Suggestion/relatedkeywordsquery.h"
 #include "artworkssnapshot.h"
 #include "../Common/delayedactionentity.h"
 
 namespace Models {
     class ArtworkMetadata;
 }
+
+namespace Helpers {
+    class DatabaseManager;
+}
+
 namespace MetadataIO {
     class MetadataIOWorker;
+    class LibrarySearchWorker;
 
     class MetadataIOService:
             public QObject,
@@ -41,6 +48,7 @@ namespace MetadataIO {
         void cancelBatch(quint32 batchID) const;
         bool isBusy() const;
         void waitWorkerIdle();
+        void warmup();
 
     public:
         void writeArtwork(Models::ArtworkMetadata *metadata);
@@ -50,6 +58,7 @@ namespace MetadataIO {
 
     public:
         void searchArtworks(Suggestion::LocalLibraryQuery *query);
+        void suggestKeywords(Suggestion::RelatedKeywordsQuery *query);
 
     signals:
         void cacheSyncRequest();
@@ -57,6 +66,7 @@ namespace MetadataIO {
 #ifdef INTEGRATION_TESTS
     public:
         MetadataIOWorker *getWorker() { return m_MetadataIOWorker; }
+        LibrarySearchWorker *getSearchWorker() { return m_LibrarySearchWorker; }
 #endif
 
     private slots:
@@ -72,8 +82,12 @@ namespace MetadataIO {
         virtual void timerEvent(QTimerEvent *event) override { onQtTimer(event); }
         virtual void callBaseTimer(QTimerEvent *event) override { QObject::timerEvent(event); }
 
+    private:
+        void startSearchWorker(Helpers::DatabaseManager *dbManager);
+
     private:
         MetadataIOWorker *m_MetadataIOWorker;
+        LibrarySearchWorker *m_LibrarySearchWorker;
         bool m_IsStopped;
     };
 }
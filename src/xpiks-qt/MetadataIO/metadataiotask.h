@@ -13,6 +13,8 @@
 
 #include "../Models/artworkmetadata.h"
 #include "../Suggestion/locallibraryquery.h"
+#include "../Suggestion/relatedkeywordsquery.h"
+#include "artworkssnapshot.h"
 
 namespace MetadataIO {
     class MetadataIOTaskBase: public Models::ArtworkMetadataLocker
@@ -39,6 +41,21 @@ namespace MetadataIO {
         Suggestion::LocalLibraryQuery *m_Query;
     };
 
+    class KeywordsSuggestionTask: public MetadataIOTaskBase {
+    public:
+        KeywordsSuggestionTask(Suggestion::RelatedKeywordsQuery *query):
+            MetadataIOTaskBase(nullptr),
+            m_Query(query)
+        {
+        }
+
+    public:
+        Suggestion::RelatedKeywordsQuery *getQuery() const { return m_Query; }
+
+    private:
+        Suggestion::RelatedKeywordsQuery *m_Query;
+    };
+
     class MetadataReadWriteTask: public MetadataIOTaskBase {
     public:
         enum ReadWriteAction {
@@ -59,6 +76,20 @@ namespace MetadataIO {
     private:
         ReadWriteAction m_ReadWriteAction;
     };
+
+    class MetadataReadBatchTask: public MetadataIOTaskBase {
+    public:
+        MetadataReadBatchTask(ArtworksSnapshot::Container &rawSnapshot):
+            MetadataIOTaskBase(nullptr),
+            m_Snapshot(rawSnapshot)
+        {}
+
+    public:
+        const ArtworksSnapshot &getSnapshot() const { return m_Snapshot; }
+
+    private:
+        ArtworksSnapshot m_Snapshot;
+    };
 }
 
 #endif // METADATAIOTASK_H
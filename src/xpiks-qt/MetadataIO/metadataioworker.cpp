@@ -18,6 +18,7 @@
 namespace MetadataIO {
     MetadataIOWorker::MetadataIOWorker(Helpers::DatabaseManager *dbManager,
                                        QMLExtensions::ArtworksUpdateHub *artworksUpdateHub,
+                                       AutoComplete::KeywordsFrequencyTrie *keywordsFrequencies,
                                        QObject *parent):
         QObject(parent),
         m_ArtworksUpdateHub(artworksUpdateHub),
@@ -25,6 +26,7 @@ namespace MetadataIO {
         m_ProcessedItemsCount(0)
     {
         Q_ASSERT(artworksUpdateHub != nullptr);
+        m_MetadataCache.setKeywordsFrequencies(keywordsFrequencies);
     }
 
     bool MetadataIOWorker::initWorker() {
@@ -37,6 +39,12 @@ namespace MetadataIO {
         return true;
     }
 
+    void MetadataIOWorker::warmupWorker() {
+        LOG_DEBUG << "#";
+        // scanned on this thread so that no flush happens in between
+        m_MetadataCache.loadKeywordsFrequencies();
+    }
+
     void MetadataIOWorker::processOneItemEx(std::shared_ptr<MetadataIOTaskBase> &item, batch_id_t batchID, Common::flag_t flags) {
         Q_UNUSED(batchID);
 
@@ -57,9 +65,9 @@ namespace MetadataIO {
                 break;
             }
 
-            std::shared_ptr<MetadataSearchTask> searchTask = std::dynamic_pointer_cast<MetadataSearchTask>(item);
-            if (searchTask) {
-                processSearchItem(searchTask);
+            std::shared_ptr<MetadataReadBatchTask> readBatchItem = std::dynamic_pointer_cast<MetadataReadBatchTask>(item);
+            if (readBatchItem) {
+                processReadBatchItem(readBatchItem);
                 break;
             }
 
@@ -97,10 +105,26 @@ namespace MetadataIO {
         }
     }
 
-    void MetadataIOWorker::processSearchItem(std::shared_ptr<MetadataSearchTask> &item) {
-        auto *localLibraryQuery = item->getQuery();
-        m_MetadataCache.search(localLibraryQuery->getSearchQuery(), localLibraryQuery->getResults());
-        localLibraryQuery->notifyResultsReady();
+    void MetadataIOWorker::processReadBatchItem(std::shared_ptr<MetadataReadBatchTask> &item) {
+        const WeakArtworksSnapshot &artworks = item->getSnapshot().getWeakSnapshot();
+        QVector<CachedArtwork> cachedArtworks;
+        QVector<int> foundIndices;
+
+        m_MetadataCache.readMany(artworks, cachedArtworks, foundIndices);
+
+        const int foundCount = foundIndices.size();
+        for (int i = 0; i < foundCount; i++) {
+            std::shared_ptr<StorageReadRequest> readRequest(new StorageReadRequest());
+            readRequest->m_Artwork = artworks.at(foundIndices[i]);
+            readRequest->m_CachedArtwork = cachedArtworks[i];
+            m_StorageReadQueue.push(readRequest);
+        }
+
+        m_ProcessedItemsCount += (int)artworks.size();
+
+        if (m_StorageReadQueue.size() > STORAGE_IMPORT_INTERVAL) {
+            emit readyToImportFromStorage();
+        }
     }
 
     void MetadataIOWorker::importArtworksFromStorage() {
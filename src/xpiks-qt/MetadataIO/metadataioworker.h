@@ -38,6 +38,7 @@ namespace MetadataIO {
     public:
         explicit MetadataIOWorker(Helpers::DatabaseManager *dbManager,
                                   QMLExtensions::ArtworksUpdateHub *artworksUpdateHub,
+                                  AutoComplete::KeywordsFrequencyTrie *keywordsFrequencies,
                                   QObject *parent = 0);
 
 #ifdef INTEGRATION_TESTS
@@ -47,12 +48,14 @@ namespace MetadataIO {
 
     protected:
         virtual bool initWorker() override;
+        virtual const char *getWorkerName() const override { return "MetadataIOWorker"; }
+        virtual void warmupWorker() override;
         virtual void processOneItemEx(std::shared_ptr<MetadataIOTaskBase> &item, batch_id_t batchID, Common::flag_t flags) override;
         virtual void processOneItem(std::shared_ptr<MetadataIOTaskBase> &item) override;
 
     private:
         void processReadWriteItem(std::shared_ptr<MetadataReadWriteTask> &item);
-        void processSearchItem(std::shared_ptr<MetadataSearchTask> &item);
+        void processReadBatchItem(std::shared_ptr<MetadataReadBatchTask> &item);
 
     public:
         void importArtworksFromStorage();
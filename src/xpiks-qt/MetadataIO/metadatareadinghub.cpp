@@ -17,7 +17,6 @@
 namespace MetadataIO {
     MetadataReadingHub::MetadataReadingHub():
         m_ImportID(0),
-        m_StorageReadBatchID(0),
         m_IgnoreBackupsAtImport(false),
         m_IsCancelled(false)
     {
@@ -25,15 +24,15 @@ namespace MetadataIO {
                          this, &MetadataReadingHub::onCanInitialize);
     }
 
-    void MetadataReadingHub::initializeImport(const ArtworksSnapshot &artworksToRead, int importID, quint32 storageReadBatchID) {
+    void MetadataReadingHub::initializeImport(const ArtworksSnapshot &artworksToRead, int importID, const QVector<quint32> &storageReadBatchIDs) {
         m_ArtworksToRead = artworksToRead;
         m_ImportQueue.reservePush(artworksToRead.size());
         m_ImportID = importID;
-        m_StorageReadBatchID = storageReadBatchID;
+        m_StorageReadBatchIDs = storageReadBatchIDs;
         m_IgnoreBackupsAtImport = false;
         m_IsCancelled = false;
         m_AsyncCoordinator.reset();
-        LOG_DEBUG << "ReadingHub bound to batch ID" << m_StorageReadBatchID;
+        LOG_DEBUG << "ReadingHub bound to batch IDs" << m_StorageReadBatchIDs;
         // add 1 for the user to click a button
         m_AsyncCoordinator.aboutToBegin();
     }
@@ -76,7 +75,9 @@ namespace MetadataIO {
 
         if (ignoreBackups) {
             MetadataIOService *metadataIOService = m_CommandManager->getMetadataIOService();
-            metadataIOService->cancelBatch(m_StorageReadBatchID);
+            for (quint32 batchID: m_StorageReadBatchIDs) {
+                metadataIOService->cancelBatch(batchID);
+            }
         }
 
         initializeArtworks(ignoreBackups, isCancelled);
@@ -13,6 +13,7 @@
 
 #include <QObject>
 #include <QAtomicInt>
+#include <QVector>
 #include "../Common/readerwriterqueue.h"
 #include "artworkssnapshot.h"
 #include "originalmetadata.h"
@@ -27,7 +28,7 @@ namespace MetadataIO {
         MetadataReadingHub();
 
     public:
-        void initializeImport(const ArtworksSnapshot &artworksToRead, int importID, quint32 storageReadBatchID);
+        void initializeImport(const ArtworksSnapshot &artworksToRead, int importID, const QVector<quint32> &storageReadBatchIDs);
         void finalizeImport();
 
     public:
@@ -56,7 +57,8 @@ namespace MetadataIO {
         Helpers::AsyncCoordinator m_AsyncCoordinator;
         Common::ReaderWriterQueue<OriginalMetadata> m_ImportQueue;
         int m_ImportID;
-        quint32 m_StorageReadBatchID;
+        // artworks added in batches are read from storage with several batches
+        QVector<quint32> m_StorageReadBatchIDs;
         volatile bool m_IgnoreBackupsAtImport;
         volatile bool m_IsCancelled;
     };
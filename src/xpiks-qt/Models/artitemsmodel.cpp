@@ -45,11 +45,17 @@
 #include "../AutoComplete/completionitem.h"
 #include "../Models/switchermodel.h"
 #include "../Models/recentfilesmodel.h"
+#include "../MetadataIO/metadataiocoordinator.h"
+
+#define LISTED_FILES_BATCH_SIZE 500
 
 namespace Models {
     ArtItemsModel::ArtItemsModel(QObject *parent):
         AbstractListModel(parent),
         Common::BaseEntity(),
+        m_DirectoriesWatcher(nullptr),
+        m_ListedFilesCount(0),
+        m_DirectoriesImportID(0),
         // all items before 1024 are reserved for internal models
         m_LastID(1024)
     {}
@@ -87,6 +93,18 @@ namespace Models {
         // will not cause sync issues on shutdown if no items
         decltype(m_ArtworkList) artworksToDestroy;
 
+        if (m_DirectoriesWatcher != nullptr) {
+            // watcher is deleted when it reports the cancellation
+            m_DirectoriesWatcher->cancel();
+            m_DirectoriesWatcher = nullptr;
+        }
+
+        m_AddedBatches.reset();
+        m_ListedDirectories.clear();
+        m_QueuedDirectories.clear();
+        m_ListedFilesCount = 0;
+        m_DirectoriesImportID = 0;
+
         beginResetModel();
         {
             artworksToDestroy.swap(m_ArtworkList);
@@ -499,10 +517,9 @@ namespace Models {
         }
     }
 
-    int ArtItemsModel::addRecentDirectory(const QString &directory) {
+    void ArtItemsModel::addRecentDirectory(const QString &directory) {
         LOG_INFO << directory;
-        int filesAdded = doAddDirectories(QStringList() << directory);
-        return filesAdded;
+        doAddDirectories(QStringList() << directory);
     }
 
     int ArtItemsModel::addRecentFile(const QString &file) {
@@ -718,7 +735,7 @@ namespace Models {
         return filesAddedCount;
     }
 
-    int ArtItemsModel::addLocalDirectories(const QList<QUrl> &directories) {
+    void ArtItemsModel::addLocalDirectories(const QList<QUrl> &directories) {
         LOG_DEBUG << directories;
         QStringList directoriesList;
         directoriesList.reserve(directories.length());
@@ -731,8 +748,7 @@ namespace Models {
             }
         }
 
-        int addedFilesCount = doAddDirectories(directoriesList);
-        return addedFilesCount;
+        doAddDirectories(directoriesList);
     }
 
     bool ArtItemsModel::hasModifiedArtworks() const {
@@ -997,12 +1013,59 @@ namespace Models {
         for (size_t i = 0; i < size; i++) {
             ArtworkMetadata *metadata = accessArtwork(i);
             auto *keywordsModel = metadata->getBasicModel();
+            keywordsModel->getSpellCheckInfo()->resetWordsAnalysis();
             itemsToCheck.push_back(keywordsModel);
         }
 
         xpiks()->submitForSpellCheck(itemsToCheck);
     }
 
+    void ArtItemsModel::onMetadataReadingFinished() {
+        LOG_DEBUG << "#";
+        // reading hub serves one import at a time so it is free now
+        m_DirectoriesImportID = 0;
+        addQueuedDirectories();
+    }
+
+    void ArtItemsModel::onDirectoryListed(int index) {
+        auto *watcher = dynamic_cast<QFutureWatcher<Helpers::DirectoryMediaFiles> *>(sender());
+        Q_ASSERT(watcher != nullptr);
+        // results of the cancelled listing are ignored
+        if ((watcher == nullptr) || (watcher != m_DirectoriesWatcher)) { return; }
+
+        Helpers::DirectoryMediaFiles listing = watcher->resultAt(index);
+        if (listing.first.isEmpty() && listing.second.isEmpty()) { return; }
+
+        m_ListedFilesCount += listing.first.size();
+        m_ListedDirectories.push_back(listing);
+
+        // first files are shown right away and the rest is added in full batches
+        if (m_AddedBatches->m_AddedRanges.empty()) {
+            addListedFiles(LISTED_FILES_BATCH_SIZE, false);
+        }
+
+        while (m_ListedFilesCount >= LISTED_FILES_BATCH_SIZE) {
+            addListedFiles(LISTED_FILES_BATCH_SIZE, false);
+        }
+    }
+
+    void ArtItemsModel::onDirectoriesListed() {
+        auto *watcher = dynamic_cast<QFutureWatcher<Helpers::DirectoryMediaFiles> *>(sender());
+        Q_ASSERT(watcher != nullptr);
+        if (watcher == nullptr) { return; }
+
+        watcher->deleteLater();
+        if (watcher != m_DirectoriesWatcher) { return; }
+        m_DirectoriesWatcher = nullptr;
+
+        // last batch imports everything added from the directories
+        addListedFiles(m_ListedFilesCount, true);
+        m_DirectoriesImportID = m_AddedBatches->m_ImportID;
+        m_AddedBatches.reset();
+
+        addQueuedDirectories();
+    }
+
     void ArtItemsModel::removeItemsFromRanges(const QVector<QPair<int, int> > &ranges) {
         AbstractListModel::removeItemsFromRanges(ranges);
         syncArtworksIndices();
@@ -1264,33 +1327,98 @@ namespace Models {
         emit dataChanged(topLeft, bottomRight, roles);
     }
 
-    int ArtItemsModel::doAddDirectories(const QStringList &directories) {
+    void ArtItemsModel::doAddDirectories(const QStringList &directories) {
         LOG_INFO << directories;
-        int filesCount = 0;
-        QStringList files;
+        if (directories.isEmpty()) { return; }
 
-        foreach(const QString &directory, directories) {
-            Helpers::extractFilesFromDirectory(directory, files);
+        m_QueuedDirectories.push_back(directories);
+        addQueuedDirectories();
+    }
+
+    void ArtItemsModel::addQueuedDirectories() {
+        if (m_QueuedDirectories.empty()) { return; }
+
+        if (m_DirectoriesWatcher != nullptr) {
+            LOG_DEBUG << "Waiting for directories being listed";
+            return;
         }
 
-        if (files.count() > 0) {
-            const bool isFullDirectory = true;
-            filesCount = doAddFiles(files, isFullDirectory);
+#ifndef CORE_TESTS
+        if (m_DirectoriesImportID != 0) {
+            // reading hub serves one import at a time
+            MetadataIO::MetadataIOCoordinator *ioCoordinator = m_CommandManager->getMetadataIOCoordinator();
+            if (!ioCoordinator->hasImportFinished(m_DirectoriesImportID)) {
+                LOG_DEBUG << "Waiting for import #" << m_DirectoriesImportID;
+                return;
+            }
+        }
+#endif
+
+        QStringList directories = m_QueuedDirectories.front();
+        m_QueuedDirectories.pop_front();
+
+        m_AddedBatches = std::make_shared<Commands::AddedArtworksBatches>();
+        m_ListedFilesCount = 0;
+        m_DirectoriesImportID = 0;
+
+        // listing runs in the global pool and every directory is
+        // reported back to this thread with a queued signal
+        m_DirectoriesWatcher = new QFutureWatcher<Helpers::DirectoryMediaFiles>(this);
+        QObject::connect(m_DirectoriesWatcher, &QFutureWatcher<Helpers::DirectoryMediaFiles>::resultReadyAt,
+                         this, &ArtItemsModel::onDirectoryListed);
+        QObject::connect(m_DirectoriesWatcher, &QFutureWatcher<Helpers::DirectoryMediaFiles>::finished,
+                         this, &ArtItemsModel::onDirectoriesListed);
+        m_DirectoriesWatcher->setFuture(Helpers::discoverMediaFiles(directories));
+    }
+
+    void ArtItemsModel::addListedFiles(int maxCount, bool isLastBatch) {
+        Q_ASSERT(m_AddedBatches);
+        QStringList filenames, vectors;
+        filenames.reserve(maxCount);
+
+        while (!m_ListedDirectories.empty() && (isLastBatch || (filenames.size() < maxCount))) {
+            Helpers::DirectoryMediaFiles &listing = m_ListedDirectories.front();
+            QStringList &listedFiles = listing.first;
+            const int count = isLastBatch ? listedFiles.size() : qMin(maxCount - filenames.size(), listedFiles.size());
+
+            filenames.append(listedFiles.mid(0, count));
+            // vectors are matched only against files of the batch
+            // so every part of a split directory needs all of them
+            vectors.append(listing.second);
+
+            if (count == listedFiles.size()) {
+                m_ListedDirectories.pop_front();
+            } else {
+                listedFiles.erase(listedFiles.begin(), listedFiles.begin() + count);
+            }
         }
 
-        return filesCount;
+        m_ListedFilesCount -= filenames.size();
+        LOG_DEBUG << filenames.size() << "listed files," << vectors.size() << "vectors, last:" << isLastBatch;
+
+        Common::flag_t flags = 0;
+        Common::SetFlag(flags, Commands::AddArtworksCommand::FlagIsFullDirectory);
+        // files were just found in the listing so no need to check them again
+        Common::SetFlag(flags, Commands::AddArtworksCommand::FlagFilesAreListed);
+        Common::ApplyFlag(flags, isLastBatch, Commands::AddArtworksCommand::FlagIsLastBatch);
+        doAddMediaFiles(filenames, vectors, flags, m_AddedBatches);
     }
 
     int ArtItemsModel::doAddFiles(const QStringList &rawFilenames, bool isFullDirectory) {
         QStringList filenames, vectors;
         Helpers::splitMediaFiles(rawFilenames, filenames, vectors);
 
+        Common::flag_t flags = 0;
+        Common::ApplyFlag(flags, isFullDirectory, Commands::AddArtworksCommand::FlagIsFullDirectory);
+
+        return doAddMediaFiles(filenames, vectors, flags);
+    }
+
+    int ArtItemsModel::doAddMediaFiles(const QStringList &filenames, const QStringList &vectors, Common::flag_t flags,
+                                       const std::shared_ptr<Commands::AddedArtworksBatches> &batches) {
         Models::SettingsModel *settingsModel = m_CommandManager->getSettingsModel();
         bool autoFindVectors = settingsModel->getAutoFindVectors();
-
-        Common::flag_t flags = 0;
         Common::ApplyFlag(flags, autoFindVectors, Commands::AddArtworksCommand::FlagAutoFindVectors);
-        Common::ApplyFlag(flags, isFullDirectory, Commands::AddArtworksCommand::FlagIsFullDirectory);
 
         bool autoImportEnabled = settingsModel->getUseAutoImport();
 #if !defined(CORE_TESTS)
@@ -1299,7 +1427,13 @@ namespace Models {
 #endif
         Common::ApplyFlag(flags, autoImportEnabled, Commands::AddArtworksCommand::FlagAutoImport);
 
-        std::shared_ptr<Commands::AddArtworksCommand> addArtworksCommand(new Commands::AddArtworksCommand(filenames, vectors, flags));
+        std::shared_ptr<Commands::AddArtworksCommand> addArtworksCommand;
+        if (batches) {
+            addArtworksCommand.reset(new Commands::AddArtworksCommand(filenames, vectors, flags, batches));
+        } else {
+            addArtworksCommand.reset(new Commands::AddArtworksCommand(filenames, vectors, flags));
+        }
+
         std::shared_ptr<Commands::ICommandResult> result = m_CommandManager->processCommand(addArtworksCommand);
         std::shared_ptr<Commands::AddArtworksCommandResult> addArtworksResult = std::dynamic_pointer_cast<Commands::AddArtworksCommandResult>(result);
 
@@ -19,6 +19,7 @@
 #include <QSize>
 #include <QHash>
 #include <QQuickTextDocument>
+#include <QFutureWatcher>
 #include <deque>
 #include <vector>
 #include <memory>
@@ -26,8 +27,10 @@
 #include "../Common/baseentity.h"
 #include "../Common/ibasicartwork.h"
 #include "../Common/iartworkssource.h"
+#include "../Common/flags.h"
 #include "../KeywordsPresets/ipresetsmanager.h"
 #include "../Helpers/ifilenotavailablemodel.h"
+#include "../Helpers/filehelpers.h"
 
 namespace Common {
     class BasicMetadataModel;
@@ -37,6 +40,10 @@ namespace QMLExtensions {
     class ArtworkUpdateRequest;
 }
 
+namespace Commands {
+    struct AddedArtworksBatches;
+}
+
 namespace Models {
     class ArtworkMetadata;
     class ArtworkElement;
@@ -129,7 +136,7 @@ namespace Models {
         Q_INVOKABLE QString getAttachedVectorPath(int metadataIndex) const;
         Q_INVOKABLE QString getArtworkDateTaken(int metadataIndex) const;
 
-        Q_INVOKABLE int addRecentDirectory(const QString &directory);
+        Q_INVOKABLE void addRecentDirectory(const QString &directory);
         Q_INVOKABLE int addRecentFile(const QString &file);
         Q_INVOKABLE int addAllRecentFiles();
         Q_INVOKABLE void initDescriptionHighlighting(int metadataIndex, QQuickTextDocument *document);
@@ -147,7 +154,7 @@ namespace Models {
         Q_INVOKABLE void initSuggestion(int metadataIndex);
         Q_INVOKABLE void setupDuplicatesModel(int metadataIndex);
         Q_INVOKABLE int addLocalArtworks(const QList<QUrl> &artworksPaths);
-        Q_INVOKABLE int addLocalDirectories(const QList<QUrl> &directories);
+        Q_INVOKABLE void addLocalDirectories(const QList<QUrl> &directories);
         Q_INVOKABLE bool hasModifiedArtworks() const;
 
     public:
@@ -168,6 +175,11 @@ namespace Models {
         void onUndoStackEmpty();
         void userDictUpdateHandler(const QStringList &keywords, bool overwritten);
         void userDictClearedHandler();
+        void onMetadataReadingFinished();
+
+    private slots:
+        void onDirectoryListed(int index);
+        void onDirectoriesListed();
 
     public:
         virtual void removeItemsFromRanges(const QVector<QPair<int, int> > &ranges) override;
@@ -208,8 +220,12 @@ namespace Models {
 
     private:
         void updateItemAtIndex(int metadataIndex);
-        int doAddDirectories(const QStringList &directories);
+        void doAddDirectories(const QStringList &directories);
+        void addQueuedDirectories();
+        void addListedFiles(int maxCount, bool isLastBatch);
         int doAddFiles(const QStringList &filepath, bool isFullDirectory = false);
+        int doAddMediaFiles(const QStringList &filenames, const QStringList &vectors, Common::flag_t flags,
+                            const std::shared_ptr<Commands::AddedArtworksBatches> &batches = std::shared_ptr<Commands::AddedArtworksBatches>());
 
     private:
         void doCombineArtwork(int index);
@@ -265,6 +281,14 @@ namespace Models {
 #ifdef QT_DEBUG
         ArtworksContainer m_DestroyedList;
 #endif
+        // files of directories being listed are added in batches of one add
+        // and directories added meanwhile wait until its import is finished
+        QFutureWatcher<Helpers::DirectoryMediaFiles> *m_DirectoriesWatcher;
+        std::shared_ptr<Commands::AddedArtworksBatches> m_AddedBatches;
+        std::deque<Helpers::DirectoryMediaFiles> m_ListedDirectories;
+        std::deque<QStringList> m_QueuedDirectories;
+        int m_ListedFilesCount;
+        int m_DirectoriesImportID;
         qint64 m_LastID;
     };
 }
@@ -396,6 +396,7 @@ namespace Models {
     void ArtworkProxyBase::doHandleUserDictCleared() {
         LOG_DEBUG << "#";
         auto *metadataModel = getBasicMetadataModel();
+        metadataModel->getSpellCheckInfo()->resetWordsAnalysis();
         xpiks()->submitItemForSpellCheck(metadataModel);
     }
 
@@ -19,13 +19,20 @@
 #include "../Models/filteredartitemsproxymodel.h"
 
 namespace Models {
+    QString normalizeDirectoryPath(const QString &path) {
+        // directories were always compared case insensitively
+        return path.toCaseFolded();
+    }
+
     ArtworksRepository::ArtworksRepository(QObject *parent) :
         AbstractListModel(parent),
         m_LastUnavailableFilesCount(0),
         m_LastID(0)
     {
-        QObject::connect(&m_FilesWatcher, &QFileSystemWatcher::fileChanged,
-                     this, &ArtworksRepository::checkFileUnavailable);
+        QObject::connect(&m_FilesWatcher, &Helpers::DirectoryWatcher::filesUnavailable,
+                         this, &ArtworksRepository::checkFilesUnavailable);
+        QObject::connect(&m_FilesWatcher, &Helpers::DirectoryWatcher::filesChanged,
+                         this, &ArtworksRepository::onFilesChanged);
 
         m_Timer.setInterval(4000); //4 sec
         m_Timer.setSingleShot(true); //single shot
@@ -49,20 +56,11 @@ namespace Models {
 
     void ArtworksRepository::stopListeningToUnavailableFiles() {
         LOG_DEBUG << "#";
-
-        QStringList files = m_FilesWatcher.files();
-        if (!files.isEmpty()) {
-            m_FilesWatcher.removePaths(files);
-        }
-
-        QStringList directories = m_FilesWatcher.directories();
-        if (!directories.isEmpty()) {
-            m_FilesWatcher.removePaths(directories);
-        }
+        m_FilesWatcher.clear();
     }
 
-    bool ArtworksRepository::beginAccountingFiles(const QStringList &items) {
-        int count = getNewDirectoriesCount(items);
+    bool ArtworksRepository::beginAccountingFiles(const QStringList &items, bool filesAreListed) {
+        int count = getNewDirectoriesCount(items, filesAreListed);
         bool shouldAccountFiles = count > 0;
         if (shouldAccountFiles) {
             beginInsertRows(QModelIndex(), rowCount(), rowCount() + count - 1);
@@ -80,7 +78,7 @@ namespace Models {
     }
 
     /*virtual */
-    int ArtworksRepository::getNewDirectoriesCount(const QStringList &items) const {
+    int ArtworksRepository::getNewDirectoriesCount(const QStringList &items, bool filesAreListed) const {
         QSet<QString> filteredFiles;
 
         foreach (const QString &filepath, items) {
@@ -93,7 +91,7 @@ namespace Models {
 
         foreach (const QString &filepath, filteredFiles) {
             QString directory;
-            if (checkFileExists(filepath, directory)) {
+            if (resolveDirectory(filepath, filesAreListed, directory)) {
                 filteredDirectories.insert(directory);
             }
         }
@@ -139,11 +137,11 @@ namespace Models {
         emit artworksSourcesCountChanged();
     }
 
-    bool ArtworksRepository::accountFile(const QString &filepath, qint64 &directoryID, Common::flag_t directoryFlags) {
+    bool ArtworksRepository::accountFile(const QString &filepath, qint64 &directoryID, Common::flag_t directoryFlags, bool fileIsListed) {
         bool wasModified = false, wasAdded = false;
         QString absolutePath;
 
-        if (this->checkFileExists(filepath, absolutePath) &&
+        if (resolveDirectory(filepath, fileIsListed, absolutePath) &&
                 !m_FilesSet.contains(filepath)) {
             int occurances = 0;
             size_t index = 0;
@@ -155,6 +153,7 @@ namespace Models {
                 auto &item = m_DirectoriesList.back();
                 item.setIsSelectedFlag(true);
                 index = m_DirectoriesList.size() - 1;
+                indexDirectory(index);
                 directoryID = id;
                 wasAdded = true;
             } else {
@@ -201,7 +200,7 @@ namespace Models {
                 Q_ASSERT(item.m_FilesCount >= 0);
                 if (item.m_FilesCount == 0) { item.setIsRemovedFlag(true); }
 
-                m_FilesWatcher.removePath(filepath);
+                m_FilesWatcher.removeFile(filepath);
                 m_FilesSet.remove(filepath);
 
                 result = true;
@@ -214,7 +213,7 @@ namespace Models {
     }
 
     void ArtworksRepository::removeVector(const QString &vectorPath) {
-        m_FilesWatcher.removePath(vectorPath);
+        m_FilesWatcher.removeFile(vectorPath);
     }
 
     void ArtworksRepository::cleanupEmptyDirectories() {
@@ -250,7 +249,8 @@ namespace Models {
     void ArtworksRepository::watchFilePaths(const QStringList &filePaths) {
 #ifndef CORE_TESTS
         if (!filePaths.empty()) {
-            m_FilesWatcher.addPaths(filePaths);
+            m_FilesWatcher.addFiles(filePaths);
+            LOG_INFO << "Watching" << m_FilesWatcher.getTrackedFilesCount() << "file(s) in" << m_FilesWatcher.getWatchedDirectoriesCount() << "directory(ies)";
         }
 #else
         Q_UNUSED(filePaths);
@@ -260,7 +260,7 @@ namespace Models {
     void ArtworksRepository::unwatchFilePaths(const QStringList &filePaths) {
 #ifndef CORE_TESTS
         if (!filePaths.empty()) {
-            m_FilesWatcher.removePaths(filePaths);
+            m_FilesWatcher.removeFiles(filePaths);
         }
 #else
         Q_UNUSED(filePaths);
@@ -287,7 +287,7 @@ namespace Models {
 
     void ArtworksRepository::watchFilePath(const QString &filepath) {
 #ifndef CORE_TESTS
-        m_FilesWatcher.addPath(filepath);
+        m_FilesWatcher.addFile(filepath);
 #else
         Q_UNUSED(filepath);
 #endif
@@ -363,6 +363,8 @@ namespace Models {
 #ifdef INTEGRATION_TESTS
     void ArtworksRepository::resetEverything() {
         m_DirectoriesList.clear();
+        m_DirectoriesIndicesByID.clear();
+        m_DirectoriesIndicesByPath.clear();
         m_FilesSet.clear();
     }
 #endif
@@ -560,15 +562,12 @@ namespace Models {
 
     bool ArtworksRepository::tryFindDirectory(const QString &directoryPath, size_t &index) const {
         bool found = false;
-        const size_t size = m_DirectoriesList.size();
 
-        for (size_t i = 0; i < size; ++i) {
-            auto &item = m_DirectoriesList[i];
-            if (QString::compare(item.m_AbsolutePath, directoryPath, Qt::CaseInsensitive) == 0) {
-                found = true;
-                index = i;
-                break;
-            }
+        auto it = m_DirectoriesIndicesByPath.constFind(normalizeDirectoryPath(directoryPath));
+        if (it != m_DirectoriesIndicesByPath.constEnd()) {
+            index = it.value();
+            Q_ASSERT(index < m_DirectoriesList.size());
+            found = true;
         }
 
         return found;
@@ -576,20 +575,51 @@ namespace Models {
 
     bool ArtworksRepository::tryFindDirectoryByID(qint64 id, size_t &index) const {
         bool found = false;
-        const size_t size = m_DirectoriesList.size();
 
-        for (size_t i = 0; i < size; ++i) {
-            auto &item = m_DirectoriesList[i];
-            if (item.m_ID == id) {
+        if ((0 <= id) && (id < (qint64)m_DirectoriesIndicesByID.size())) {
+            const int directoryIndex = m_DirectoriesIndicesByID[(size_t)id];
+            if (directoryIndex >= 0) {
+                index = (size_t)directoryIndex;
+                Q_ASSERT(m_DirectoriesList[index].m_ID == id);
                 found = true;
-                index = i;
-                break;
             }
         }
 
         return found;
     }
 
+    void ArtworksRepository::indexDirectory(size_t index) {
+        Q_ASSERT(index < m_DirectoriesList.size());
+        auto &directory = m_DirectoriesList[index];
+        const size_t id = (size_t)directory.m_ID;
+
+        if (id >= m_DirectoriesIndicesByID.size()) {
+            m_DirectoriesIndicesByID.resize(id + 1, -1);
+        }
+
+        m_DirectoriesIndicesByID[id] = (int)index;
+        m_DirectoriesIndicesByPath.insert(normalizeDirectoryPath(directory.m_AbsolutePath), index);
+    }
+
+    void ArtworksRepository::unindexDirectory(size_t index) {
+        Q_ASSERT(index < m_DirectoriesList.size());
+        auto &directory = m_DirectoriesList[index];
+        const size_t id = (size_t)directory.m_ID;
+
+        if (id < m_DirectoriesIndicesByID.size()) {
+            m_DirectoriesIndicesByID[id] = -1;
+        }
+
+        m_DirectoriesIndicesByPath.remove(normalizeDirectoryPath(directory.m_AbsolutePath));
+    }
+
+    void ArtworksRepository::reindexDirectories(size_t startIndex) {
+        const size_t size = m_DirectoriesList.size();
+        for (size_t i = startIndex; i < size; ++i) {
+            indexDirectory(i);
+        }
+    }
+
     QHash<int, QByteArray> ArtworksRepository::roleNames() const {
         QHash<int, QByteArray> roles;
         roles[PathRole] = "path";
@@ -607,7 +637,11 @@ namespace Models {
             const bool newIsSelected = false; // unselect folder to be deleted
             changeSelectedState(index, newIsSelected, oldIsSelected);
         }
+
+        unindexDirectory(index);
         m_DirectoriesList.erase(m_DirectoriesList.begin() + index);
+        // only directories after the removed one are shifted
+        reindexDirectories(index);
     }
 
     /*virtual */
@@ -628,18 +662,38 @@ namespace Models {
         return exists;
     }
 
-    void ArtworksRepository::checkFileUnavailable(const QString &path) {
-        LOG_INFO << "File changed:" << path;
+    bool ArtworksRepository::resolveDirectory(const QString &filename, bool fileIsListed, QString &directory) const {
+        if (!fileIsListed) {
+            return checkFileExists(filename, directory);
+        }
+
+        // file was just found in the directory listing
+        directory = QFileInfo(filename).absolutePath();
+        return true;
+    }
+
+    void ArtworksRepository::checkFilesUnavailable(const QStringList &paths) {
+        LOG_INFO << paths.size() << "file(s) became unavailable";
+
+        for (auto &path: paths) {
+            LOG_DEBUG << "File become unavailable:" << path;
+            m_UnavailableFiles.insert(QFileInfo(path).absoluteFilePath());
+        }
 
-        QFileInfo fi(path);
-        if (!fi.exists()) {
-            LOG_INFO << "File become unavailable:" << path;
-            m_UnavailableFiles.insert(fi.absoluteFilePath());
+        if (!paths.isEmpty()) {
             LOG_DEBUG << "Starting availability timer...";
             m_Timer.start();
         }
     }
 
+    void ArtworksRepository::onFilesChanged(const QStringList &paths) {
+        LOG_INFO << paths.size() << "file(s) became available again";
+
+        for (auto &path: paths) {
+            emit fileChanged(path);
+        }
+    }
+
     void ArtworksRepository::onAvailabilityTimer() {
         int currentUnavailableSize = m_UnavailableFiles.size();
         LOG_INFO << "Current:" << currentUnavailableSize << "Last:" << m_LastUnavailableFilesCount;
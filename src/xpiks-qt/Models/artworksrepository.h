@@ -16,12 +16,13 @@
 #include <QList>
 #include <QPair>
 #include <QSet>
+#include <QHash>
 #include <QTimer>
-#include <QFileSystemWatcher>
 #include <QSortFilterProxyModel>
 #include <vector>
 
 #include "../Common/abstractlistmodel.h"
+#include "../Helpers/directorywatcher.h"
 #include "../Common/baseentity.h"
 #include "../Common/flags.h"
 
@@ -71,11 +72,11 @@ namespace Models {
         void stopListeningToUnavailableFiles();
 
     public:
-        bool beginAccountingFiles(const QStringList &items);
+        bool beginAccountingFiles(const QStringList &items, bool filesAreListed = false);
         void endAccountingFiles(bool filesWereAccounted);
 
     public:
-        virtual int getNewDirectoriesCount(const QStringList &items) const;
+        virtual int getNewDirectoriesCount(const QStringList &items, bool filesAreListed = false) const;
         int getNewFilesCount(const QStringList &items) const;
         bool canPurgeUnavailableFiles() const { return m_UnavailableFiles.size() == m_LastUnavailableFilesCount; }
         bool isDirectorySelected(qint64 directoryID) const;
@@ -105,11 +106,12 @@ namespace Models {
         void onUndoStackEmpty();
 
     private slots:
-        void checkFileUnavailable(const QString &path);
+        void checkFilesUnavailable(const QStringList &paths);
+        void onFilesChanged(const QStringList &paths);
         void onAvailabilityTimer();
 
     public:
-        bool accountFile(const QString &filepath, qint64 &directoryID, Common::flag_t directoryFlags = 0);
+        bool accountFile(const QString &filepath, qint64 &directoryID, Common::flag_t directoryFlags = 0, bool fileIsListed = false);
         void accountVector(const QString &vectorPath);
         bool removeFile(const QString &filepath, qint64 directoryID);
         void removeVector(const QString &vectorPath);
@@ -151,6 +153,7 @@ namespace Models {
     protected:
         virtual void removeInnerItem(int index) override;
         virtual bool checkFileExists(const QString &filename, QString &directory) const;
+        bool resolveDirectory(const QString &filename, bool fileIsListed, QString &directory) const;
 
     public:
         bool unselectAllDirectories() { return setAllSelected(false); }
@@ -164,11 +167,17 @@ namespace Models {
         bool setAllSelected(bool value);
         bool tryFindDirectory(const QString &directoryPath, size_t &index) const;
         bool tryFindDirectoryByID(qint64 id, size_t &index) const;
+        void indexDirectory(size_t index);
+        void unindexDirectory(size_t index);
+        void reindexDirectories(size_t startIndex);
 
     private:
         std::vector<RepoDir> m_DirectoriesList;
+        // IDs are sequential and never reused so index by ID is dense
+        std::vector<int> m_DirectoriesIndicesByID;
+        QHash<QString, size_t> m_DirectoriesIndicesByPath;
         QSet<QString> m_FilesSet;
-        QFileSystemWatcher m_FilesWatcher;
+        Helpers::DirectoryWatcher m_FilesWatcher;
         QTimer m_Timer;
         QSet<QString> m_UnavailableFiles;
         int m_LastUnavailableFilesCount;
@@ -10,6 +10,7 @@
 
 #include "filteredartitemsproxymodel.h"
 #include <QDir>
+#include <QtConcurrent>
 #include "artitemsmodel.h"
 #include "artworkmetadata.h"
 #include "artworksrepository.h"
@@ -810,11 +811,26 @@ namespace Models {
 
     MetadataIO::ArtworksSnapshot::Container FilteredArtItemsProxyModel::getSearchablePreviewOriginalItems(const QString &searchTerm,
                                                                                                           Common::SearchFlags flags) const {
-        return getFilteredOriginalItems<std::shared_ptr<ArtworkMetadataLocker> >(
-            [&searchTerm, flags](ArtworkMetadata *artwork) {
-            return Helpers::hasSearchMatch(searchTerm, artwork, flags);
-        },
+        auto previews = getFilteredOriginalItems<std::shared_ptr<PreviewArtworkElement> >(
+            [](ArtworkMetadata *) { return true; },
             [] (ArtworkMetadata *artwork, int, int) {
-            return std::shared_ptr<ArtworkMetadataLocker>(new PreviewArtworkElement(artwork)); });
+            return std::shared_ptr<PreviewArtworkElement>(new PreviewArtworkElement(artwork)); });
+
+        // every artwork is scanned once for all fields and hits are kept in the preview
+        QtConcurrent::blockingMap(previews, [&searchTerm, flags](std::shared_ptr<PreviewArtworkElement> &preview) {
+            preview->findSearchHits(searchTerm, flags);
+        });
+
+        MetadataIO::ArtworksSnapshot::Container searchable;
+        searchable.reserve(previews.size());
+
+        for (auto &preview: previews) {
+            if (preview->hasAnyMatch()) {
+                searchable.emplace_back(preview);
+            }
+        }
+
+        LOG_INFO << "Found" << searchable.size() << "match(es)";
+        return searchable;
     }
 }
@@ -14,7 +14,6 @@
 #include "../Models/artitemsmodel.h"
 #include "../Models/settingsmodel.h"
 #include "../Commands/commandmanager.h"
-#include "../Helpers/filterhelpers.h"
 #include "../Models/filteredartitemsproxymodel.h"
 #include "../Models/previewartworkelement.h"
 #include "../Helpers/metadatahighlighter.h"
@@ -78,45 +77,11 @@ namespace Models {
         normalizeSearchCriteria();
 
         Models::FilteredArtItemsProxyModel *filteredItemsModel = m_CommandManager->getFilteredArtItemsModel();
+        // previews come with hits in every field already found
         auto rawSnapshot = filteredItemsModel->getSearchablePreviewOriginalItems(m_ReplaceFrom, m_Flags);
         m_ArtworksSnapshot.set(rawSnapshot);
 
         LOG_INFO << "Found" << m_ArtworksSnapshot.size() << "item(s)";
-
-        for (auto &locker: m_ArtworksSnapshot.getRawData()) {
-            std::shared_ptr<PreviewArtworkElement> preview = std::dynamic_pointer_cast<PreviewArtworkElement>(locker);
-            Q_ASSERT(preview);
-            Models::ArtworkMetadata *artwork = locker->getArtworkMetadata();
-            bool hasMatch = false;
-            Common::SearchFlags flags = Common::SearchFlags::None;
-
-            if (getSearchInTitle()) {
-                flags = m_Flags;
-                Common::UnsetFlag(flags, Common::SearchFlags::Description);
-                Common::UnsetFlag(flags, Common::SearchFlags::Keywords);
-
-                hasMatch = Helpers::hasSearchMatch(m_ReplaceFrom, artwork, flags);
-                preview->setHasTitleMatch(hasMatch);
-            }
-
-            if (getSearchInDescription()) {
-                flags = m_Flags;
-                Common::UnsetFlag(flags, Common::SearchFlags::Title);
-                Common::UnsetFlag(flags, Common::SearchFlags::Keywords);
-
-                hasMatch = Helpers::hasSearchMatch(m_ReplaceFrom, artwork, flags);
-                preview->setHasDescriptionMatch(hasMatch);
-            }
-
-            if (getSearchInKeywords()) {
-                flags = m_Flags;
-                Common::UnsetFlag(flags, Common::SearchFlags::Description);
-                Common::UnsetFlag(flags, Common::SearchFlags::Title);
-
-                hasMatch = Helpers::hasSearchMatch(m_ReplaceFrom, artwork, flags);
-                preview->setHasKeywordsMatch(hasMatch);
-            }
-        }
     }
 
     int FindAndReplaceModel::rowCount(const QModelIndex &parent) const {
@@ -216,7 +181,7 @@ namespace Models {
         Models::ArtworkMetadata *artwork = item->getArtworkMetadata();
 
         if (item->hasTitleMatch()) {
-            text = filterText(artwork->getTitle());
+            text = filterText(artwork->getTitle(), item->getTitleHits());
         } else {
             auto title = artwork->getTitle();
             if (title.size() > PREVIEWOFFSET*2) {
@@ -240,7 +205,7 @@ namespace Models {
         Models::ArtworkMetadata *artwork = item->getArtworkMetadata();
 
         if (item->hasDescriptionMatch()) {
-            text = filterText(artwork->getDescription());
+            text = filterText(artwork->getDescription(), item->getDescriptionHits());
         } else {
             auto description = artwork->getDescription();
             if (description.size() > PREVIEWOFFSET*2) {
@@ -265,17 +230,13 @@ namespace Models {
         QStringList list = artwork->getKeywords();
 
         if (item->hasKeywordsMatch()) {
-            Qt::CaseSensitivity caseSensitivity = getCaseSensitive() ? Qt::CaseSensitive : Qt::CaseInsensitive;
-            const bool wholeWords = getSearchWholeWords();
-
+            const int size = list.size();
             QStringList listNew;
-            for (auto &el: list) {
-                if (!wholeWords) {
-                    if (el.contains(m_ReplaceFrom, caseSensitivity)) {
-                        listNew.append(el);
-                    }
-                } else if (QString::compare(m_ReplaceFrom, el, caseSensitivity) == 0) {
-                    listNew.append(el);
+
+            for (int keywordIndex: item->getKeywordsHits()) {
+                // keywords could have been edited after search
+                if (keywordIndex < size) {
+                    listNew.append(list.at(keywordIndex));
                 }
             }
 
@@ -331,9 +292,7 @@ namespace Models {
         endResetModel();
     }
 
-    QString FindAndReplaceModel::filterText(const QString &text) {
-        int size = m_ReplaceFrom.size();
-
+    QString FindAndReplaceModel::filterText(const QString &text, const std::vector<int> &searchHits) {
 #ifndef QT_DEBUG
         if (text.size() <= 2*PREVIEWOFFSET) {
             return text;
@@ -341,16 +300,13 @@ namespace Models {
 #endif
 
         QString result;
-        Qt::CaseSensitivity caseSensitivity = getCaseSensitive() ? Qt::CaseSensitive : Qt::CaseInsensitive;
-        int pos = 0;
+        const int size = text.size();
         std::vector<int> hits;
+        hits.reserve(searchHits.size());
 
-        while (pos != -1) {
-            pos = text.indexOf(m_ReplaceFrom, pos, caseSensitivity);
-            if (pos >= 0) {
-                hits.push_back(pos);
-                pos += size;
-            }
+        // text could have been edited after search
+        for (int hit: searchHits) {
+            if (hit < size) { hits.push_back(hit); }
         }
 
         if (!hits.empty()) {
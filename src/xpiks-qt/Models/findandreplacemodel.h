@@ -171,7 +171,7 @@ namespace Models {
         void replaceSucceeded();
 
     private:
-        QString filterText(const QString &text);
+        QString filterText(const QString &text, const std::vector<int> &searchHits);
         void setAllSelected(bool isSelected);
         void initDefaultFlags();
         void normalizeSearchCriteria();
@@ -0,0 +1,100 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "metricsmodel.h"
+#include <algorithm>
+#include "../Common/defines.h"
+
+#define METRICS_LOG_INTERVAL (5*60*1000)
+
+namespace Models {
+    MetricsModel::MetricsModel(QObject *parent):
+        QAbstractListModel(parent)
+    {
+        QObject::connect(&m_LogTimer, &QTimer::timeout, this, &MetricsModel::onLogTimer);
+    }
+
+    void MetricsModel::startLogging() {
+        LOG_DEBUG << "#";
+        m_LogTimer.start(METRICS_LOG_INTERVAL);
+    }
+
+    void MetricsModel::stopLogging() {
+        LOG_DEBUG << "#";
+        m_LogTimer.stop();
+    }
+
+    void MetricsModel::logSnapshot() {
+        std::vector<Helpers::MetricValue> metrics;
+        Helpers::MetricsRegistry::getInstance().snapshot(metrics);
+
+        for (auto &metric: metrics) {
+            // idle workers only add noise to the log
+            if (metric.m_MaxValue == 0) { continue; }
+            LOG_INFO << metric.toString();
+        }
+    }
+
+    void MetricsModel::refresh() {
+        std::vector<Helpers::MetricValue> metrics;
+        Helpers::MetricsRegistry::getInstance().snapshot(metrics);
+
+        const bool sameRows = (metrics.size() == m_Metrics.size()) &&
+                std::equal(metrics.begin(), metrics.end(), m_Metrics.begin(),
+                           [](const Helpers::MetricValue &a, const Helpers::MetricValue &b) {
+            return a.m_Name == b.m_Name;
+        });
+
+        if (sameRows) {
+            m_Metrics.swap(metrics);
+            if (!m_Metrics.empty()) {
+                emit dataChanged(index(0), index((int)m_Metrics.size() - 1), QVector<int>() << ValueRole);
+            }
+        } else {
+            beginResetModel();
+            {
+                m_Metrics.swap(metrics);
+            }
+            endResetModel();
+        }
+    }
+
+    QVariant MetricsModel::data(const QModelIndex &index, int role) const {
+        int row = index.row();
+        if (row < 0 || row >= (int)m_Metrics.size()) { return QVariant(); }
+
+        auto &metric = m_Metrics.at(row);
+
+        switch (role) {
+        case NameRole: return metric.m_Name;
+        case KindRole:
+            switch (metric.m_Kind) {
+            case Helpers::MetricKind::Counter: return QString("counter");
+            case Helpers::MetricKind::Gauge: return QString("gauge");
+            case Helpers::MetricKind::Histogram: return QString("histogram");
+            }
+            return QVariant();
+        case ValueRole: return metric.formatValue();
+        default: return QVariant();
+        }
+    }
+
+    QHash<int, QByteArray> MetricsModel::roleNames() const {
+        QHash<int, QByteArray> roles;
+        roles[NameRole] = "name";
+        roles[KindRole] = "kind";
+        roles[ValueRole] = "value";
+        return roles;
+    }
+
+    void MetricsModel::onLogTimer() {
+        logSnapshot();
+    }
+}
@@ -0,0 +1,59 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef METRICSMODEL_H
+#define METRICSMODEL_H
+
+#include <QAbstractListModel>
+#include <QTimer>
+#include <vector>
+#include "../Helpers/metrics.h"
+
+namespace Models {
+    // rows of MetricsRegistry for the diagnostics dialog
+    class MetricsModel: public QAbstractListModel
+    {
+        Q_OBJECT
+    public:
+        MetricsModel(QObject *parent=0);
+
+    public:
+        enum MetricsModel_Roles {
+            NameRole = Qt::UserRole + 1,
+            KindRole,
+            ValueRole
+        };
+
+    public:
+        // periodically writes all metrics to the log
+        void startLogging();
+        void stopLogging();
+
+    public:
+        Q_INVOKABLE void refresh();
+        Q_INVOKABLE void logSnapshot();
+
+    public:
+        virtual int rowCount(const QModelIndex &parent = QModelIndex()) const override { Q_UNUSED(parent); return (int)m_Metrics.size(); }
+        virtual QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    protected:
+        virtual QHash<int, QByteArray> roleNames() const override;
+
+    private slots:
+        void onLogTimer();
+
+    private:
+        std::vector<Helpers::MetricValue> m_Metrics;
+        QTimer m_LogTimer;
+    };
+}
+
+#endif // METRICSMODEL_H
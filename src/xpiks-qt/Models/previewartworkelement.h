@@ -12,6 +12,7 @@
 #define PREVIEWMETADATAELEMENT_H
 
 #include "artworkelement.h"
+#include "../Helpers/filterhelpers.h"
 
 namespace Models {
     class PreviewArtworkElement: public ArtworkElement
@@ -47,6 +48,27 @@ namespace Models {
         void setHasTitleMatch(bool value) { setHasTitleMatchFlag(value); }
         void setHasDescriptionMatch(bool value) { setHasDescriptionMatchFlag(value); }
         void setHasKeywordsMatch(bool value) { setHasKeywordsMatchFlag(value); }
+
+    public:
+        const std::vector<int> &getTitleHits() const { return m_SearchHits.m_TitleHits; }
+        const std::vector<int> &getDescriptionHits() const { return m_SearchHits.m_DescriptionHits; }
+        const std::vector<int> &getKeywordsHits() const { return m_SearchHits.m_KeywordsHits; }
+        bool hasAnyMatch() const { return m_SearchHits.anyHit(); }
+
+        bool findSearchHits(const QString &searchTerm, Common::SearchFlags flags) {
+            m_SearchHits = Helpers::SearchHits();
+            Helpers::findSearchHits(searchTerm, getArtworkMetadata(), flags, m_SearchHits);
+
+            setHasTitleMatch(m_SearchHits.hasTitleHits());
+            setHasDescriptionMatch(m_SearchHits.hasDescriptionHits());
+            setHasKeywordsMatch(m_SearchHits.hasKeywordsHits());
+
+            return m_SearchHits.anyHit();
+        }
+
+    private:
+        // positions are reused by previews and by the replace itself
+        Helpers::SearchHits m_SearchHits;
     };
 }
 
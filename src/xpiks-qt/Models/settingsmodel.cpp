@@ -47,6 +47,7 @@
 #define DEFAULT_KEYWORD_SIZE_SCALE 1.0
 #define DEFAULT_DISMISS_DURATION 10
 #define DEFAULT_MAX_PARALLEL_UPLOADS 2
+#define DEFAULT_MAX_PARALLEL_VIDEO_THUMBNAILS 2
 #define DEFAULT_FIT_SMALL_PREVIEW false
 #define DEFAULT_SEARCH_USING_AND true
 #define DEFAULT_SEARCH_BY_FILEPATH true
@@ -143,6 +144,7 @@ namespace Models {
         m_UploadTimeout(DEFAULT_UPLOAD_TIMEOUT),
         m_DismissDuration(DEFAULT_DISMISS_DURATION),
         m_MaxParallelUploads(DEFAULT_MAX_PARALLEL_UPLOADS),
+        m_MaxParallelVideoThumbnails(DEFAULT_MAX_PARALLEL_VIDEO_THUMBNAILS),
         m_SelectedThemeIndex(DEFAULT_SELECTED_THEME_INDEX),
         m_MustUseMasterPassword(DEFAULT_USE_MASTERPASSWORD),
         m_MustUseConfirmations(DEFAULT_USE_CONFIRMATIONS),
@@ -444,6 +446,7 @@ namespace Models {
         setKeywordSizeScale(doubleValue(keywordSizeScale, DEFAULT_KEYWORD_SIZE_SCALE));
         setDismissDuration(intValue(dismissDuration, DEFAULT_DISMISS_DURATION));
         setMaxParallelUploads(intValue(maxParallelUploads, DEFAULT_MAX_PARALLEL_UPLOADS));
+        setMaxParallelVideoThumbnails(intValue(maxParallelVideoThumbnails, DEFAULT_MAX_PARALLEL_VIDEO_THUMBNAILS));
         setFitSmallPreview(boolValue(fitSmallPreview, DEFAULT_FIT_SMALL_PREVIEW));
         setSearchUsingAnd(boolValue(searchUsingAnd, DEFAULT_SEARCH_USING_AND));
         setSearchByFilepath(boolValue(searchByFilepath, DEFAULT_SEARCH_BY_FILEPATH));
@@ -546,6 +549,7 @@ namespace Models {
         setKeywordSizeScale(DEFAULT_KEYWORD_SIZE_SCALE);
         setDismissDuration(DEFAULT_DISMISS_DURATION);
         setMaxParallelUploads(DEFAULT_MAX_PARALLEL_UPLOADS);
+        setMaxParallelVideoThumbnails(DEFAULT_MAX_PARALLEL_VIDEO_THUMBNAILS);
         setFitSmallPreview(DEFAULT_FIT_SMALL_PREVIEW);
         setSearchUsingAnd(DEFAULT_SEARCH_USING_AND);
         setSearchByFilepath(DEFAULT_SEARCH_BY_FILEPATH);
@@ -589,6 +593,7 @@ namespace Models {
         setValue(keywordSizeScale, m_KeywordSizeScale);
         setValue(dismissDuration, m_DismissDuration);
         setValue(maxParallelUploads, m_MaxParallelUploads);
+        setValue(maxParallelVideoThumbnails, m_MaxParallelVideoThumbnails);
         setValue(fitSmallPreview, m_FitSmallPreview);
         setValue(searchUsingAnd, m_SearchUsingAnd);
         setValue(searchByFilepath, m_SearchByFilepath);
@@ -853,6 +858,15 @@ namespace Models {
         justChanged();
     }
 
+    void SettingsModel::setMaxParallelVideoThumbnails(int value) {
+        if (m_MaxParallelVideoThumbnails == value)
+            return;
+
+        m_MaxParallelVideoThumbnails = ensureInBounds(value, 1, 8);
+        emit maxParallelVideoThumbnailsChanged(m_MaxParallelVideoThumbnails);
+        justChanged();
+    }
+
     void SettingsModel::setFitSmallPreview(bool value) {
         if (m_FitSmallPreview == value)
             return;
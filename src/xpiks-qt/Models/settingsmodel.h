@@ -52,6 +52,7 @@ namespace Models {
         Q_PROPERTY(double keywordSizeScale READ getKeywordSizeScale WRITE setKeywordSizeScale NOTIFY keywordSizeScaleChanged)
         Q_PROPERTY(int dismissDuration READ getDismissDuration WRITE setDismissDuration NOTIFY dismissDurationChanged)
         Q_PROPERTY(int maxParallelUploads READ getMaxParallelUploads WRITE setMaxParallelUploads NOTIFY maxParallelUploadsChanged)
+        Q_PROPERTY(int maxParallelVideoThumbnails READ getMaxParallelVideoThumbnails WRITE setMaxParallelVideoThumbnails NOTIFY maxParallelVideoThumbnailsChanged)
         Q_PROPERTY(bool fitSmallPreview READ getFitSmallPreview WRITE setFitSmallPreview NOTIFY fitSmallPreviewChanged)
         Q_PROPERTY(bool searchUsingAnd READ getSearchUsingAnd WRITE setSearchUsingAnd NOTIFY searchUsingAndChanged)
         Q_PROPERTY(bool searchByFilepath READ getSearchByFilepath WRITE setSearchByFilepath NOTIFY searchByFilepathChanged)
@@ -249,6 +250,7 @@ namespace Models {
         double getKeywordSizeScale() const { return m_KeywordSizeScale; }
         int getDismissDuration() const { return m_DismissDuration; }
         int getMaxParallelUploads() const { return m_MaxParallelUploads; }
+        int getMaxParallelVideoThumbnails() const { return m_MaxParallelVideoThumbnails; }
         bool getFitSmallPreview() const { return m_FitSmallPreview; }
         bool getSearchUsingAnd() const { return m_SearchUsingAnd; }
         bool getSearchByFilepath() const { return m_SearchByFilepath; }
@@ -289,6 +291,7 @@ namespace Models {
         void keywordSizeScaleChanged(double value);
         void dismissDurationChanged(int value);
         void maxParallelUploadsChanged(int value);
+        void maxParallelVideoThumbnailsChanged(int value);
         void fitSmallPreviewChanged(bool value);
         void searchUsingAndChanged(bool value);
         void searchByFilepathChanged(bool value);
@@ -325,6 +328,7 @@ namespace Models {
         void setKeywordSizeScale(double value);
         void setDismissDuration(int value);
         void setMaxParallelUploads(int value);
+        void setMaxParallelVideoThumbnails(int value);
         void setFitSmallPreview(bool value);
         void setSearchUsingAnd(bool value);
         void setSearchByFilepath(bool value);
@@ -387,6 +391,7 @@ namespace Models {
         int m_UploadTimeout; // in seconds
         int m_DismissDuration;
         int m_MaxParallelUploads;
+        int m_MaxParallelVideoThumbnails;
         int m_SelectedThemeIndex;
         bool m_MustUseMasterPassword;
         bool m_MustUseConfirmations;
@@ -0,0 +1,58 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "cachedimageresponse.h"
+#include "cachingimageprovider.h"
+#include "../Common/defines.h"
+
+namespace QMLExtensions {
+    CachedImageResponse::CachedImageResponse(CachingImageProvider *provider, const QString &id, const QSize &requestedSize):
+        m_Provider(provider),
+        m_ID(id),
+        m_RequestedSize(requestedSize),
+        m_IsCancelled(0)
+    {
+        Q_ASSERT(provider != nullptr);
+        // response is deleted by the engine after finished()
+        setAutoDelete(false);
+    }
+
+    CachedImageResponse::CachedImageResponse(const QImage &image):
+        m_Provider(nullptr),
+        m_Image(image),
+        m_IsCancelled(0)
+    {
+        setAutoDelete(false);
+        // engine connects to the signal only after the response is returned
+        QMetaObject::invokeMethod(this, "finished", Qt::QueuedConnection);
+    }
+
+    QQuickTextureFactory *CachedImageResponse::textureFactory() const {
+        return QQuickTextureFactory::textureFactoryForImage(m_Image);
+    }
+
+    void CachedImageResponse::cancel() {
+        m_IsCancelled.storeRelease(1);
+    }
+
+    void CachedImageResponse::run() {
+        Q_ASSERT(m_Provider != nullptr);
+
+        // delegate was destroyed while the request was waiting in the queue
+        if (!getIsCancelled()) {
+            m_Image = m_Provider->loadImage(m_ID, m_RequestedSize);
+        } else {
+            LOG_DEBUG << "Skipping cancelled request:" << m_ID;
+        }
+
+        // nothing can be touched after this point since engine deletes the response
+        emit finished();
+    }
+}
@@ -0,0 +1,49 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef CACHEDIMAGERESPONSE_H
+#define CACHEDIMAGERESPONSE_H
+
+#include <QQuickImageResponse>
+#include <QRunnable>
+#include <QAtomicInt>
+#include <QString>
+#include <QImage>
+#include <QSize>
+
+namespace QMLExtensions {
+    class CachingImageProvider;
+
+    class CachedImageResponse : public QQuickImageResponse, public QRunnable
+    {
+        Q_OBJECT
+    public:
+        CachedImageResponse(CachingImageProvider *provider, const QString &id, const QSize &requestedSize);
+        // response for already decoded image
+        CachedImageResponse(const QImage &image);
+
+    public:
+        virtual QQuickTextureFactory *textureFactory() const override;
+        virtual void cancel() override;
+        virtual void run() override;
+
+    public:
+        bool getIsCancelled() const { return m_IsCancelled.loadAcquire() != 0; }
+
+    private:
+        CachingImageProvider *m_Provider;
+        QString m_ID;
+        QSize m_RequestedSize;
+        QImage m_Image;
+        QAtomicInt m_IsCancelled;
+    };
+}
+
+#endif // CACHEDIMAGERESPONSE_H
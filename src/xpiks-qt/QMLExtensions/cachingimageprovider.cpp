@@ -9,11 +9,18 @@
  */
 
 #include "cachingimageprovider.h"
+#include <QImageReader>
+#include <QFileInfo>
+#include <QThread>
+#include "cachedimageresponse.h"
 #include "../Common/defines.h"
 #include "../QMLExtensions/imagecachingservice.h"
 #include "../Helpers/stringhelper.h"
 
 #define RECACHE true
+#define MAX_DECODING_THREADS 4
+// in kilobytes
+#define DECODED_IMAGES_CACHE_SIZE (64*1024)
 
 namespace QMLExtensions {
     QString prepareUrl(const QString &url) {
@@ -28,13 +35,60 @@ namespace QMLExtensions {
         return id;
     }
 
-    QImage CachingImageProvider::requestImage(const QString &url, QSize *size, const QSize &requestedSize) {
+    QString getDecodedImageKey(const QString &id, const QSize &targetSize) {
+        return QString("%1x%2:%3").arg(targetSize.width()).arg(targetSize.height()).arg(id);
+    }
+
+    QDateTime getLastModified(const QString &id) {
+        const bool isInResources = id.startsWith(":/");
+        return isInResources ? QDateTime() : QFileInfo(id).lastModified();
+    }
+
+    CachingImageProvider::CachingImageProvider():
+        QQuickAsyncImageProvider(),
+        m_DecodedImages(DECODED_IMAGES_CACHE_SIZE),
+        m_RequestsCounter(0),
+        m_ImageCachingService(NULL)
+    {
+        // leave at least one core for the UI and the caching worker
+        const int threadsCount = qBound(1, QThread::idealThreadCount() - 1, MAX_DECODING_THREADS);
+        m_DecodingPool.setMaxThreadCount(threadsCount);
+        LOG_INFO << "Decoding images with" << threadsCount << "threads";
+    }
+
+    CachingImageProvider::~CachingImageProvider() {
+        m_DecodingPool.clear();
+        m_DecodingPool.waitForDone();
+    }
+
+    QQuickImageResponse *CachingImageProvider::requestImageResponse(const QString &url, const QSize &requestedSize) {
         Q_ASSERT(!url.isEmpty());
-        if (url.isEmpty()) { return QImage(); }
 
         const QString id = prepareUrl(url);
         LOG_DEBUG << "Requesting file:" << id;
 
+        QImage decodedImage;
+        if (!id.isEmpty() && tryGetDecodedImage(id, getTargetSize(requestedSize), decodedImage)) {
+            return new CachedImageResponse(decodedImage);
+        }
+
+        CachedImageResponse *response = new CachedImageResponse(this, id, requestedSize);
+        // the latest requests are for the rows which are visible right now
+        const int priority = m_RequestsCounter.fetchAndAddRelaxed(1) & 0x7FFFFFFF;
+        m_DecodingPool.start(response, priority);
+
+        return response;
+    }
+
+    QImage CachingImageProvider::loadImage(const QString &id, const QSize &requestedSize) {
+        if (id.isEmpty()) { return QImage(); }
+
+        const QSize targetSize = getTargetSize(requestedSize);
+
+        QImage result;
+        // could have been decoded while the request was in the queue
+        if (tryGetDecodedImage(id, targetSize, result)) { return result; }
+
         QString cachedPath;
         bool needsUpdate = false;
 
@@ -46,26 +100,86 @@ namespace QMLExtensions {
             QImage cachedImage;
             bool loaded = cachedImage.load(cachedPath);
             if (loaded && !cachedImage.isNull()) {
-                *size = cachedImage.size();
-                return cachedImage;
+                result = cachedImage;
             }
         }
 
-        LOG_DEBUG << "Not found properly cached:" << id;
+        if (result.isNull()) {
+            LOG_DEBUG << "Not found properly cached:" << id;
+
+            if (requestedSize.isValid()) {
+                m_ImageCachingService->cacheImage(id, requestedSize);
+            } else {
+                LOG_WARNING << "Size is invalid:" << requestedSize.width() << "x" << requestedSize.height();
+                m_ImageCachingService->cacheImage(id);
+            }
+
+            result = decodeOriginal(id, targetSize);
+        }
+
+        if (!result.isNull()) {
+            storeDecodedImage(id, targetSize, result);
+        }
+
+        return result;
+    }
+
+    QSize CachingImageProvider::getTargetSize(const QSize &requestedSize) const {
+        if (requestedSize.isValid()) { return requestedSize; }
+        return m_ImageCachingService->getDefaultSize();
+    }
+
+    QImage CachingImageProvider::decodeOriginal(const QString &id, const QSize &targetSize) {
+        QImageReader reader(id);
+        const QSize originalSize = reader.size();
 
-        QImage originalImage(id);
         QImage result;
 
-        if (requestedSize.isValid()) {
-            m_ImageCachingService->cacheImage(id, requestedSize);
-            result = originalImage.scaled(requestedSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+        if (originalSize.isValid()) {
+            // allows decoders like jpeg to skip most of the full resolution work
+            reader.setScaledSize(originalSize.scaled(targetSize, Qt::KeepAspectRatio));
+            result = reader.read();
         } else {
-            LOG_WARNING << "Size is invalid:" << requestedSize.width() << "x" << requestedSize.height();
-            m_ImageCachingService->cacheImage(id);
-            result = originalImage.scaled(m_ImageCachingService->getDefaultSize(), Qt::KeepAspectRatio, Qt::SmoothTransformation);
+            QImage originalImage = reader.read();
+            if (!originalImage.isNull()) {
+                result = originalImage.scaled(targetSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+            }
+        }
+
+        if (result.isNull()) {
+            LOG_WARNING << "Failed to decode" << id << reader.errorString();
         }
 
-        *size = result.size();
         return result;
     }
+
+    bool CachingImageProvider::tryGetDecodedImage(const QString &id, const QSize &targetSize, QImage &image) {
+        const QString key = getDecodedImageKey(id, targetSize);
+        const QDateTime lastModified = getLastModified(id);
+
+        QMutexLocker locker(&m_DecodedImagesLock);
+
+        DecodedImage *decodedImage = m_DecodedImages.object(key);
+        if (decodedImage == nullptr) { return false; }
+
+        if (decodedImage->m_LastModified != lastModified) {
+            m_DecodedImages.remove(key);
+            return false;
+        }
+
+        image = decodedImage->m_Image;
+        return true;
+    }
+
+    void CachingImageProvider::storeDecodedImage(const QString &id, const QSize &targetSize, const QImage &image) {
+        DecodedImage *decodedImage = new DecodedImage();
+        decodedImage->m_Image = image;
+        decodedImage->m_LastModified = getLastModified(id);
+
+        const int cost = qMax(1, image.byteCount() / 1024);
+        const QString key = getDecodedImageKey(id, targetSize);
+
+        QMutexLocker locker(&m_DecodedImagesLock);
+        m_DecodedImages.insert(key, decodedImage, cost);
+    }
 }
@@ -11,31 +11,51 @@
 #ifndef CACHINGIMAGEPROVIDER_H
 #define CACHINGIMAGEPROVIDER_H
 
-#include <QQuickImageProvider>
-#include <QHash>
+#include <QQuickAsyncImageProvider>
+#include <QThreadPool>
+#include <QAtomicInt>
+#include <QDateTime>
+#include <QCache>
+#include <QMutex>
+#include <QImage>
 
 namespace QMLExtensions {
     class ImageCachingService;
 
-    class CachingImageProvider : public QObject, public QQuickImageProvider
+    class CachingImageProvider : public QQuickAsyncImageProvider
     {
-        Q_OBJECT
     public:
-        CachingImageProvider(ImageType type, Flags flags = 0) :
-            QQuickImageProvider(type, flags),
-            m_ImageCachingService(NULL)
-        {}
+        CachingImageProvider();
+        virtual ~CachingImageProvider();
 
-        virtual ~CachingImageProvider() {}
-
-        virtual QImage requestImage(const QString &url, QSize *size, const QSize& requestedSize) override;
+        virtual QQuickImageResponse *requestImageResponse(const QString &url, const QSize &requestedSize) override;
 
     public:
         void setImageCachingService(QMLExtensions::ImageCachingService *cachingService) {
             m_ImageCachingService = cachingService;
         }
 
+    public:
+        // called from the decoding pool
+        QImage loadImage(const QString &id, const QSize &requestedSize);
+
+    private:
+        QSize getTargetSize(const QSize &requestedSize) const;
+        QImage decodeOriginal(const QString &id, const QSize &targetSize);
+        bool tryGetDecodedImage(const QString &id, const QSize &targetSize, QImage &image);
+        void storeDecodedImage(const QString &id, const QSize &targetSize, const QImage &image);
+
+    private:
+        struct DecodedImage {
+            QImage m_Image;
+            QDateTime m_LastModified;
+        };
+
     private:
+        QMutex m_DecodedImagesLock;
+        QCache<QString, DecodedImage> m_DecodedImages;
+        QThreadPool m_DecodingPool;
+        QAtomicInt m_RequestsCounter;
         QMLExtensions::ImageCachingService *m_ImageCachingService;
     };
 }
@@ -47,6 +47,12 @@ namespace QMLExtensions {
         return success;
     }
 
+    void DbVideoCacheIndex::sync() {
+        QMutexLocker locker(&m_SyncMutex);
+        Q_UNUSED(locker);
+        DbCacheIndex::sync();
+    }
+
     void DbVideoCacheIndex::update(const QString &originalPath, CachedVideo &cachedImage) {
         LOG_DEBUG << originalPath;
         CachedVideo previous;
@@ -13,6 +13,7 @@
 
 #include <QString>
 #include <QHash>
+#include <QMutex>
 #include "cachedvideo.h"
 #include "../Helpers/database.h"
 #include "dbcacheindex.h"
@@ -25,12 +26,17 @@ namespace QMLExtensions {
 
     public:
         virtual bool initialize() override;
+        // index is shared by all video caching workers
+        virtual void sync() override;
 
     public:
         virtual void update(const QString &originalPath, CachedVideo &cachedImage) override;
 
     protected:
         virtual int getMaxCacheMemorySize() const override;
+
+    private:
+        QMutex m_SyncMutex;
     };
 }
 
@@ -9,7 +9,6 @@
  */
 
 #include "imagecachingservice.h"
-#include <QThread>
 #include <QScreen>
 #include "imagecachingworker.h"
 #include "imagecacherequest.h"
@@ -42,17 +41,10 @@ namespace QMLExtensions {
         auto *dbManager = m_CommandManager->getDatabaseManager();
         m_CachingWorker = new ImageCachingWorker(coordinator, dbManager);
 
-        QThread *thread = new QThread();
-        m_CachingWorker->moveToThread(thread);
-
-        QObject::connect(thread, &QThread::started, m_CachingWorker, &ImageCachingWorker::process);
-        QObject::connect(m_CachingWorker, &ImageCachingWorker::stopped, thread, &QThread::quit);
-
         QObject::connect(m_CachingWorker, &ImageCachingWorker::stopped, m_CachingWorker, &ImageCachingWorker::deleteLater);
-        QObject::connect(thread, &QThread::finished, thread, &QThread::deleteLater);
 
-        LOG_DEBUG << "starting low priority thread...";
-        thread->start(QThread::LowPriority);
+        LOG_DEBUG << "starting background worker...";
+        m_CachingWorker->doWorkOnExecutor(Common::TaskPriority::Background);
     }
 
     void ImageCachingService::stopService() {
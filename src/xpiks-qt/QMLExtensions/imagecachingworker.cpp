@@ -25,7 +25,6 @@
 #include "../Helpers/asynccoordinator.h"
 #include "dbimagecacheindex.h"
 
-#define IMAGE_CACHING_WORKER_SLEEP_DELAY 500
 #define IMAGES_INDEX_BACKUP_STEP 50
 #define PREVIEW_JPG_QUALITY 70
 
@@ -79,11 +78,6 @@ namespace QMLExtensions {
             saveIndex();
         } else {
             ItemProcessingWorker::processOneItemEx(item, batchID, flags);
-
-            if (getWithDelayFlag(flags)) {
-                // force context switch for more imporant tasks
-                QThread::msleep(IMAGE_CACHING_WORKER_SLEEP_DELAY);
-            }
         }
     }
 
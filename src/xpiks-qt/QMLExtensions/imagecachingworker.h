@@ -31,6 +31,7 @@ namespace QMLExtensions {
 
     protected:
         virtual bool initWorker() override;
+        virtual const char *getWorkerName() const override { return "ImageCachingWorker"; }
         virtual void processOneItemEx(std::shared_ptr<ImageCacheRequest> &item, batch_id_t batchID, Common::flag_t flags) override;
         virtual void processOneItem(std::shared_ptr<ImageCacheRequest> &item) override;
 
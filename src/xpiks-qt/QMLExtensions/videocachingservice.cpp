@@ -11,18 +11,20 @@
 #include "videocachingservice.h"
 #include <vector>
 #include <memory>
+#include <QThread>
 #include "videocachingworker.h"
+#include "dbvideocacheindex.h"
 #include "../Models/videoartwork.h"
 #include "../QMLExtensions/videocacherequest.h"
 #include "../Commands/commandmanager.h"
 #include "../Models/switchermodel.h"
+#include "../Models/settingsmodel.h"
 #include "../Common/defines.h"
 
 namespace QMLExtensions {
     VideoCachingService::VideoCachingService(QObject *parent) :
         QObject(parent),
         Common::BaseEntity(),
-        m_CachingWorker(nullptr),
         m_IsCancelled(false)
     {
     }
@@ -30,63 +32,77 @@ namespace QMLExtensions {
     void VideoCachingService::startService() {
         Helpers::DatabaseManager *dbManager = m_CommandManager->getDatabaseManager();
 
-        m_CachingWorker = new VideoCachingWorker(dbManager);
-        m_CachingWorker->setCommandManager(m_CommandManager);
+        // index is finalized by the last worker which releases it
+        std::shared_ptr<DbVideoCacheIndex> cache(new DbVideoCacheIndex(dbManager),
+                                                 [](DbVideoCacheIndex *index) {
+            index->finalize();
+            delete index;
+        });
+        cache->initialize();
 
-        QThread *thread = new QThread();
-        m_CachingWorker->moveToThread(thread);
+        const int workersCount = getWorkersCount();
+        LOG_INFO << "Starting" << workersCount << "video caching worker(s)";
 
-        QObject::connect(thread, SIGNAL(started()), m_CachingWorker, SLOT(process()));
-        QObject::connect(m_CachingWorker, SIGNAL(stopped()), thread, SLOT(quit()));
+        for (int i = 0; i < workersCount; i++) {
+            VideoCachingWorker *cachingWorker = new VideoCachingWorker(i, cache);
+            cachingWorker->setCommandManager(m_CommandManager);
 
-        QObject::connect(m_CachingWorker, SIGNAL(stopped()), m_CachingWorker, SLOT(deleteLater()));
-        QObject::connect(thread, SIGNAL(finished()), thread, SLOT(deleteLater()));
+            QObject::connect(cachingWorker, SIGNAL(stopped()), cachingWorker, SLOT(deleteLater()));
 
-        LOG_DEBUG << "starting low priority thread...";
-        thread->start(QThread::LowPriority);
+            m_CachingWorkers.push_back(cachingWorker);
+
+            LOG_DEBUG << "starting background worker...";
+            cachingWorker->doWorkOnExecutor(Common::TaskPriority::Background);
+        }
     }
 
     void VideoCachingService::stopService() {
         LOG_DEBUG << "#";
 
-        if (m_CachingWorker != NULL) {
+        if (!m_CachingWorkers.empty()) {
             m_IsCancelled = true;
-            m_CachingWorker->stopWorking();
+            for (auto *cachingWorker: m_CachingWorkers) {
+                cachingWorker->stopWorking();
+            }
         } else {
-            LOG_WARNING << "Caching Worker was NULL";
+            LOG_WARNING << "Caching Workers were not started";
         }
     }
 
     void VideoCachingService::generateThumbnails(const MetadataIO::ArtworksSnapshot &snapshot) {
-        Q_ASSERT(m_CachingWorker != nullptr);
+        Q_ASSERT(!m_CachingWorkers.empty());
         LOG_INFO << snapshot.size() << "artworks";
 
-#ifndef INTEGRATION_TESTS
-        Models::SwitcherModel *switcher = m_CommandManager->getSwitcherModel();
-        const bool goodQualityAllowed = switcher->getGoodQualityVideoPreviews();
-#else
-        const bool goodQualityAllowed = false;
-#endif
+        const bool goodQualityAllowed = getGoodQualityAllowed();
         LOG_DEBUG << (goodQualityAllowed ? "Good" : "Quick") << "quality allowed";
 
+        const size_t workersCount = m_CachingWorkers.size();
         const size_t size = snapshot.size();
-        std::vector<std::shared_ptr<VideoCacheRequest> > requests;
-        requests.reserve(size);
+        std::vector<std::vector<std::shared_ptr<VideoCacheRequest> > > requests(workersCount);
+        for (auto &workerRequests: requests) {
+            workerRequests.reserve(size / workersCount + 1);
+        }
 
         for (size_t i = 0; i < size; i++) {
             auto *artwork = snapshot.get(i);
             Models::VideoArtwork *videoArtwork = dynamic_cast<Models::VideoArtwork *>(artwork);
             if (videoArtwork != nullptr) {
-                const bool quickThumbnail = true, dontRecache = false;
-                requests.emplace_back(new VideoCacheRequest(videoArtwork,
-                                                            dontRecache,
-                                                            quickThumbnail,
-                                                            goodQualityAllowed));
+                const bool quickThumbnail = true, dontRecache = false, withoutDelay = false;
+                const size_t workerIndex = (size_t)videoArtwork->getItemID() % workersCount;
+                requests[workerIndex].emplace_back(new VideoCacheRequest(videoArtwork,
+                                                                         dontRecache,
+                                                                         quickThumbnail,
+                                                                         withoutDelay,
+                                                                         goodQualityAllowed));
             }
         }
 
-        m_CachingWorker->submitItems(requests);
-        m_CachingWorker->submitSeparator();
+        for (size_t i = 0; i < workersCount; i++) {
+            if (requests[i].empty()) { continue; }
+
+            m_CachingWorkers[i]->submitItems(requests[i]);
+            m_CachingWorkers[i]->submitSeparator();
+        }
     }
 
     void VideoCachingService::generateThumbnail(Models::VideoArtwork *videoArtwork) {
@@ -94,24 +110,51 @@ namespace QMLExtensions {
         if (videoArtwork == nullptr) { return; }
         LOG_DEBUG << "#" << videoArtwork->getItemID();
 
-#ifndef INTEGRATION_TESTS
-        Models::SwitcherModel *switcher = m_CommandManager->getSwitcherModel();
-        const bool goodQualityAllowed = switcher->getGoodQualityVideoPreviews();
-#else
-        const bool goodQualityAllowed = false;
-#endif
-        const bool quickThumbnail = true, dontRecache = false;
+        const bool goodQualityAllowed = getGoodQualityAllowed();
+        const bool quickThumbnail = true, dontRecache = false, withoutDelay = false;
 
         std::shared_ptr<VideoCacheRequest> request(new VideoCacheRequest(videoArtwork,
                                                                          dontRecache,
                                                                          quickThumbnail,
+                                                                         withoutDelay,
                                                                          goodQualityAllowed));
-        m_CachingWorker->submitItem(request);
+        getWorkerFor(videoArtwork)->submitItem(request);
     }
 
     void VideoCachingService::waitWorkerIdle() {
         LOG_DEBUG << "#";
-        Q_ASSERT(m_CachingWorker != nullptr);
-        m_CachingWorker->waitIdle();
+        Q_ASSERT(!m_CachingWorkers.empty());
+        for (auto *cachingWorker: m_CachingWorkers) {
+            cachingWorker->waitIdle();
+        }
+    }
+
+    int VideoCachingService::getWorkersCount() const {
+#ifndef INTEGRATION_TESTS
+        Models::SettingsModel *settingsModel = m_CommandManager->getSettingsModel();
+        int workersCount = settingsModel->getMaxParallelVideoThumbnails();
+        // leave cores for UI and other services
+        const int idealCount = qMax(1, QThread::idealThreadCount() / 2);
+        workersCount = qMax(1, qMin(workersCount, idealCount));
+#else
+        const int workersCount = 1;
+#endif
+        return workersCount;
+    }
+
+    bool VideoCachingService::getGoodQualityAllowed() const {
+#ifndef INTEGRATION_TESTS
+        Models::SwitcherModel *switcher = m_CommandManager->getSwitcherModel();
+        const bool goodQualityAllowed = switcher->getGoodQualityVideoPreviews();
+#else
+        const bool goodQualityAllowed = false;
+#endif
+        return goodQualityAllowed;
+    }
+
+    VideoCachingWorker *VideoCachingService::getWorkerFor(Models::VideoArtwork *videoArtwork) const {
+        Q_ASSERT(!m_CachingWorkers.empty());
+        const size_t workerIndex = (size_t)videoArtwork->getItemID() % m_CachingWorkers.size();
+        return m_CachingWorkers[workerIndex];
     }
 }
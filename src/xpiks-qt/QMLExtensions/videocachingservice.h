@@ -46,7 +46,13 @@ namespace QMLExtensions {
         void waitWorkerIdle();
 
     private:
-        VideoCachingWorker *m_CachingWorker;
+        int getWorkersCount() const;
+        bool getGoodQualityAllowed() const;
+        VideoCachingWorker *getWorkerFor(Models::VideoArtwork *videoArtwork) const;
+
+    private:
+        // requests for the same artwork always go to the same worker
+        std::vector<VideoCachingWorker *> m_CachingWorkers;
         volatile bool m_IsCancelled;
     };
 }
@@ -22,7 +22,6 @@
 #include "../Commands/commandmanager.h"
 #include <thumbnailcreator.h>
 
-#define VIDEO_WORKER_SLEEP_DELAY 500
 #define VIDEO_INDEX_BACKUP_STEP 50
 #define THUMBNAIL_JPG_QUALITY 80
 
@@ -34,12 +33,13 @@ namespace QMLExtensions {
         return hash;
     }
 
-    VideoCachingWorker::VideoCachingWorker(Helpers::DatabaseManager *dbManager, QObject *parent) :
+    VideoCachingWorker::VideoCachingWorker(int workerIndex, const std::shared_ptr<DbVideoCacheIndex> &cache, QObject *parent) :
         QObject(parent),
-        ItemProcessingWorker(2),
+        m_WorkerIndex(workerIndex),
         m_ProcessedItemsCount(0),
-        m_Cache(dbManager)
+        m_Cache(cache)
     {
+        Q_ASSERT(m_Cache);
         m_RolesToUpdate << Models::ArtItemsModel::ArtworkThumbnailRole;
     }
 
@@ -63,8 +63,6 @@ namespace QMLExtensions {
 
         LOG_INFO << "Using" << m_VideosCacheDir << "for videos cache";
 
-        m_Cache.initialize();
-
         return true;
     }
 
@@ -73,11 +71,6 @@ namespace QMLExtensions {
             saveIndex();
         } else {
             ItemProcessingWorker::processOneItemEx(item, batchID, flags);
-
-            if (getWithDelayFlag(flags)) {
-                // force context switch for more imporant tasks
-                QThread::msleep(VIDEO_WORKER_SLEEP_DELAY);
-            }
         }
     }
 
@@ -157,7 +150,8 @@ namespace QMLExtensions {
 
     void VideoCachingWorker::workerStopped() {
         LOG_DEBUG << "#";
-        m_Cache.finalize();
+        // last worker to release the shared index finalizes it
+        m_Cache.reset();
         emit stopped();
     }
 
@@ -165,7 +159,7 @@ namespace QMLExtensions {
         bool found = false;
         CachedVideo cachedVideo;
 
-        if (m_Cache.tryGet(key, cachedVideo)) {
+        if (m_Cache->tryGet(key, cachedVideo)) {
             QString cachedValue = QDir::cleanPath(m_VideosCacheDir + QDir::separator() + cachedVideo.m_Filename);
 
             QFileInfo fi(cachedValue);
@@ -195,7 +189,7 @@ namespace QMLExtensions {
             cachedVideo.m_LastModified = fi.lastModified();
             cachedVideo.m_IsQuickThumbnail = isQuickThumbnail;
 
-            m_Cache.update(originalPath, cachedVideo);
+            m_Cache->update(originalPath, cachedVideo);
 
             m_ProcessedItemsCount++;
             thumbnailPath = cachedFilepath;
@@ -228,7 +222,9 @@ namespace QMLExtensions {
 
     void VideoCachingWorker::saveIndex() {
         LOG_DEBUG << "#";
-        m_Cache.sync();
+        if (m_Cache) {
+            m_Cache->sync();
+        }
     }
 
     bool VideoCachingWorker::checkLockedIO(std::shared_ptr<VideoCacheRequest> &item) {
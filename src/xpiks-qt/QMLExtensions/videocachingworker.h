@@ -16,6 +16,7 @@
 #include <QImage>
 #include <QSet>
 #include <vector>
+#include <memory>
 #include "../Common/itemprocessingworker.h"
 #include "../Common/baseentity.h"
 #include "videocacherequest.h"
@@ -27,10 +28,12 @@ namespace QMLExtensions {
     {
         Q_OBJECT
     public:
-        explicit VideoCachingWorker(Helpers::DatabaseManager *dbManager, QObject *parent = 0);
+        VideoCachingWorker(int workerIndex, const std::shared_ptr<DbVideoCacheIndex> &cache, QObject *parent = 0);
 
     protected:
         virtual bool initWorker() override;
+        virtual const char *getWorkerName() const override { return "VideoCachingWorker"; }
+        virtual QString getMetricsName() const override { return QString("VideoCachingWorker#%1").arg(m_WorkerIndex + 1); }
         virtual void processOneItemEx(std::shared_ptr<VideoCacheRequest> &item, batch_id_t batchID, Common::flag_t flags) override;
         virtual void processOneItem(std::shared_ptr<VideoCacheRequest> &item) override;
 
@@ -61,10 +64,11 @@ namespace QMLExtensions {
         bool checkProcessed(std::shared_ptr<VideoCacheRequest> &item);
 
     private:
+        const int m_WorkerIndex;
         volatile int m_ProcessedItemsCount;
         qreal m_Scale;
         QString m_VideosCacheDir;
-        DbVideoCacheIndex m_Cache;
+        std::shared_ptr<DbVideoCacheIndex> m_Cache;
         QSet<int> m_RolesToUpdate;
     };
 }
@@ -41,14 +41,7 @@ namespace SpellCheck {
         Helpers::AsyncCoordinatorLocker locker(coordinator);
         Q_UNUSED(locker);
 
-        QThread *thread = new QThread();
-        m_SpellCheckWorker->moveToThread(thread);
-
-        QObject::connect(thread, &QThread::started, m_SpellCheckWorker, &SpellCheckWorker::process);
-        QObject::connect(m_SpellCheckWorker, &SpellCheckWorker::stopped, thread, &QThread::quit);
-
         QObject::connect(m_SpellCheckWorker, &SpellCheckWorker::stopped, m_SpellCheckWorker, &SpellCheckWorker::deleteLater);
-        QObject::connect(thread, &QThread::finished, thread, &QThread::deleteLater);
 
         QObject::connect(this, &SpellCheckerService::cancelSpellChecking,
                          m_SpellCheckWorker, &SpellCheckWorker::cancel);
@@ -69,8 +62,9 @@ namespace SpellCheck {
         QObject::connect(m_SpellCheckWorker, &SpellCheckWorker::userDictCleared,
                          this, &SpellCheckerService::userDictCleared);
 
-        LOG_DEBUG << "starting thread...";
-        thread->start();
+        LOG_DEBUG << "starting worker...";
+        // spellchecking results are shown while user types
+        m_SpellCheckWorker->doWorkOnExecutor(Common::TaskPriority::Interactive);
 
         m_IsStopped = false;
 
@@ -88,6 +82,14 @@ namespace SpellCheck {
         m_IsStopped = true;
     }
 
+    void SpellCheckerService::warmup() {
+        LOG_DEBUG << "#";
+        if (m_SpellCheckWorker == NULL) { return; }
+        if (m_IsStopped) { return; }
+
+        m_SpellCheckWorker->submitWarmup();
+    }
+
     bool SpellCheckerService::isBusy() const {
         bool isBusy = (m_SpellCheckWorker != NULL) && (m_SpellCheckWorker->hasPendingJobs());
         return isBusy;
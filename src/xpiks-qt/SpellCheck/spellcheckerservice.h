@@ -52,6 +52,7 @@ namespace SpellCheck {
         void submitKeyword(Common::BasicKeywordsModel *itemToCheck, int keywordIndex);
         virtual QStringList suggestCorrections(const QString &word) const;
         void restartWorker();
+        void warmup();
         int getUserDictWordsNumber();
 
 #ifdef INTEGRATION_TESTS
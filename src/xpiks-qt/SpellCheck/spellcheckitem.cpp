@@ -16,6 +16,7 @@
 #include "../Common/defines.h"
 #include "../Common/basicmetadatamodel.h"
 #include "../Helpers/stringhelper.h"
+#include "spellcheckiteminfo.h"
 
 #define IMPOSSIBLE_TITLE_INDEX 100000
 #define IMPOSSIBLE_DESCRIPTION_INDEX 200000
@@ -37,25 +38,32 @@ namespace SpellCheck {
     SpellCheckItem::SpellCheckItem(Common::BasicKeywordsModel *spellCheckable, Common::SpellCheckFlags spellCheckFlags, Common::WordAnalysisFlags wordAnalysisFlag, int keywordIndex):
         SpellCheckItemBase(wordAnalysisFlag),
         m_SpellCheckable(spellCheckable),
+        m_SpellCheckInfo(nullptr),
+        m_AnalysisGeneration(0),
         m_SpellCheckFlags(spellCheckFlags),
-        m_OnlyOneKeyword(true)
+        m_KeywordIndex(keywordIndex),
+        m_OnlyOneKeyword(true),
+        m_IsCoalescable(true)
     {
         Q_ASSERT(Common::HasFlag(spellCheckFlags, Common::SpellCheckFlags::Keywords));
         Q_ASSERT(spellCheckable != NULL);
 
         spellCheckable->acquire();
 
+        Common::BasicMetadataModel *metadataModel = dynamic_cast<Common::BasicMetadataModel*>(spellCheckable);
+        if (metadataModel != nullptr) {
+            m_SpellCheckInfo = metadataModel->getSpellCheckInfo();
+            m_AnalysisGeneration = m_SpellCheckInfo->getAnalysisGeneration();
+        }
+
         QString keyword = m_SpellCheckable->retrieveKeyword(keywordIndex);
         if (!keyword.contains(QChar::Space)) {
-            std::shared_ptr<SpellCheckQueryItem> queryItem(new SpellCheckQueryItem(keywordIndex, keyword));
-            appendItem(queryItem);
+            addWord(keywordIndex, keyword);
         } else {
             QStringList parts = keyword.split(QChar::Space, QString::SkipEmptyParts);
             foreach(const QString &part, parts) {
                 QString item = part.trimmed();
-                std::shared_ptr<SpellCheckQueryItem> queryItem(new SpellCheckQueryItem(keywordIndex, item));
-
-                appendItem(queryItem);
+                addWord(keywordIndex, item);
             }
         }
     }
@@ -63,12 +71,22 @@ namespace SpellCheck {
     SpellCheckItem::SpellCheckItem(Common::BasicKeywordsModel *spellCheckable, Common::SpellCheckFlags spellCheckFlags, Common::WordAnalysisFlags wordAnalysisFlags):
         SpellCheckItemBase(wordAnalysisFlags),
         m_SpellCheckable(spellCheckable),
+        m_SpellCheckInfo(nullptr),
+        m_AnalysisGeneration(0),
         m_SpellCheckFlags(spellCheckFlags),
-        m_OnlyOneKeyword(false)
+        m_KeywordIndex(-1),
+        m_OnlyOneKeyword(false),
+        m_IsCoalescable(true)
     {
         Q_ASSERT(spellCheckable != NULL);
         spellCheckable->acquire();
 
+        Common::BasicMetadataModel *metadataModel = dynamic_cast<Common::BasicMetadataModel*>(spellCheckable);
+        if (metadataModel != nullptr) {
+            m_SpellCheckInfo = metadataModel->getSpellCheckInfo();
+            m_AnalysisGeneration = m_SpellCheckInfo->getAnalysisGeneration();
+        }
+
         std::function<bool (const QString &word)> alwaysTrue = [](const QString &) {return true; };
 
         if (Common::HasFlag(spellCheckFlags, Common::SpellCheckFlags::Keywords)) {
@@ -78,7 +96,6 @@ namespace SpellCheck {
         }
 
         if (Common::HasFlag(spellCheckFlags, Common::SpellCheckFlags::Description)) {
-            Common::BasicMetadataModel *metadataModel = dynamic_cast<Common::BasicMetadataModel*>(spellCheckable);
             if (metadataModel != nullptr) {
                 QStringList descriptionWords = metadataModel->getDescriptionWords();
                 reserve(descriptionWords.length());
@@ -87,7 +104,6 @@ namespace SpellCheck {
         }
 
         if (Common::HasFlag(spellCheckFlags, Common::SpellCheckFlags::Title)) {
-            Common::BasicMetadataModel *metadataModel = dynamic_cast<Common::BasicMetadataModel*>(spellCheckable);
             if (metadataModel != nullptr) {
                 QStringList titleWords = metadataModel->getTitleWords();
                 reserve(titleWords.length());
@@ -99,8 +115,14 @@ namespace SpellCheck {
     SpellCheckItem::SpellCheckItem(Common::BasicKeywordsModel *spellCheckable, const QStringList &keywordsToCheck, Common::WordAnalysisFlags wordAnalysisFlags):
         SpellCheckItemBase(wordAnalysisFlags),
         m_SpellCheckable(spellCheckable),
+        // words affected by user dictionary change have to be checked again
+        m_SpellCheckInfo(nullptr),
+        m_AnalysisGeneration(0),
         m_SpellCheckFlags(Common::SpellCheckFlags::All),
-        m_OnlyOneKeyword(false)
+        m_KeywordIndex(-1),
+        m_OnlyOneKeyword(false),
+        // only checks subset of words so it cannot replace other requests
+        m_IsCoalescable(false)
     {
         Q_ASSERT(spellCheckable != NULL);
         spellCheckable->acquire();
@@ -162,8 +184,7 @@ namespace SpellCheck {
         foreach(const QString &word, words) {
             if (!word.contains(QChar::Space)) {
                 if (pred(word)) {
-                    std::shared_ptr<SpellCheckQueryItem> queryItem(new SpellCheckQueryItem(index, word));
-                    appendItem(queryItem);
+                    addWord(index, word);
                 }
             } else {
                 QStringList parts = word.split(QChar::Space, QString::SkipEmptyParts);
@@ -172,8 +193,7 @@ namespace SpellCheck {
 
                     if (item.length() >= 2) {
                         if (pred(item)) {
-                            std::shared_ptr<SpellCheckQueryItem> queryItem(new SpellCheckQueryItem(index, item));
-                            appendItem(queryItem);
+                            addWord(index, item);
                         }
                     }
                 }
@@ -183,10 +203,31 @@ namespace SpellCheck {
         }
     }
 
+    void SpellCheckItem::addWord(size_t index, const QString &word) {
+        std::shared_ptr<SpellCheckQueryItem> queryItem(new SpellCheckQueryItem(index, word));
+
+        if (m_SpellCheckInfo != nullptr) {
+            Common::WordAnalysisResult analysis;
+            if (m_SpellCheckInfo->tryGetWordAnalysis(word, getWordAnalysisFlags(), analysis)) {
+                queryItem->m_Stem = analysis.m_Stem;
+                queryItem->m_IsCorrect = analysis.m_IsCorrect;
+                queryItem->m_IsAnalyzed = true;
+            }
+        }
+
+        appendItem(queryItem);
+    }
+
     /*virtual */
     void SpellCheckItem::submitSpellCheckResult() {
         const std::vector<std::shared_ptr<SpellCheckQueryItem> > &items = getQueries();
 
+        if (m_SpellCheckInfo != nullptr) {
+            // full check has all current words so it also drops the removed ones
+            const bool replace = m_SpellCheckFlags == Common::SpellCheckFlags::All;
+            m_SpellCheckInfo->updateWordsAnalysis(getHash(), getWordAnalysisFlags(), replace, m_AnalysisGeneration);
+        }
+
         // can be empty in case of clear command
         if (Common::HasFlag(m_SpellCheckFlags, Common::SpellCheckFlags::Keywords) && !items.empty()) {
             m_SpellCheckable->setKeywordsSpellCheckResults(items);
@@ -25,6 +25,8 @@ namespace Common {
 }
 
 namespace SpellCheck {
+    class SpellCheckItemInfo;
+
     class SpellCheckQueryItem
     {
     public:
@@ -32,7 +34,8 @@ namespace SpellCheck {
             m_Word(word),
             m_Index(index),
             m_IsCorrect(true),
-            m_IsDuplicate(false)
+            m_IsDuplicate(false),
+            m_IsAnalyzed(false)
         { }
 
         SpellCheckQueryItem(const SpellCheckQueryItem &copy):
@@ -41,7 +44,8 @@ namespace SpellCheck {
             m_Suggestions(copy.m_Suggestions),
             m_Stem(copy.m_Stem),
             m_IsCorrect(copy.m_IsCorrect),
-            m_IsDuplicate(copy.m_IsDuplicate)
+            m_IsDuplicate(copy.m_IsDuplicate),
+            m_IsAnalyzed(copy.m_IsAnalyzed)
         { }
 
         QString m_Word;
@@ -50,6 +54,8 @@ namespace SpellCheck {
         QString m_Stem;
         volatile bool m_IsCorrect;
         volatile bool m_IsDuplicate;
+        // spelling and stem are known from the previous check
+        volatile bool m_IsAnalyzed;
     };
 
     class ISpellCheckItem
@@ -110,6 +116,7 @@ namespace SpellCheck {
 
     private:
         void addWords(const QStringList &words, int startingIndex, const std::function<bool (const QString &word)> &pred);
+        void addWord(size_t index, const QString &word);
 
     signals:
         void resultsReady(Common::SpellCheckFlags flags, int index);
@@ -118,11 +125,20 @@ namespace SpellCheck {
         virtual void submitSpellCheckResult();
 
         bool getIsOnlyOneKeyword() const { return m_OnlyOneKeyword; }
+        // newer request with the same target, flags and index supersedes pending one
+        bool getIsCoalescable() const { return m_IsCoalescable; }
+        Common::BasicKeywordsModel *getSpellCheckable() const { return m_SpellCheckable; }
+        Common::SpellCheckFlags getSpellCheckFlags() const { return m_SpellCheckFlags; }
+        int getKeywordIndex() const { return m_KeywordIndex; }
 
     private:
         Common::BasicKeywordsModel *m_SpellCheckable;
+        SpellCheckItemInfo *m_SpellCheckInfo;
+        quint32 m_AnalysisGeneration;
         Common::SpellCheckFlags m_SpellCheckFlags;
+        int m_KeywordIndex;
         volatile bool m_OnlyOneKeyword;
+        bool m_IsCoalescable;
     };
 
     class ModifyUserDictItem:
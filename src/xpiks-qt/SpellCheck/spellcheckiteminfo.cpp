@@ -108,6 +108,12 @@ namespace SpellCheck {
         return QStringList::fromSet(m_WordsWithErrors);
     }
 
+    SpellCheckItemInfo::SpellCheckItemInfo():
+        m_AnalysisFlags(Common::WordAnalysisFlags::None),
+        m_AnalysisGeneration(0)
+    {
+    }
+
     void SpellCheckItemInfo::setDescriptionErrors(const QSet<QString> &errors) {
         m_DescriptionErrors.setErrorWords(errors);
     }
@@ -131,6 +137,70 @@ namespace SpellCheck {
             m_TitleErrors.removeWordFromErrors(word.toLower());
             m_DescriptionErrors.removeWordFromErrors(word.toLower());
         }
+
+        // analysis of any word could have been affected by user dictionary
+        resetWordsAnalysis();
+    }
+
+    bool SpellCheckItemInfo::tryGetWordAnalysis(const QString &word, Common::WordAnalysisFlags flags, Common::WordAnalysisResult &result) {
+        QReadLocker readLocker(&m_AnalyzedWordsLock);
+        Q_UNUSED(readLocker);
+
+        if (m_AnalysisFlags != flags) { return false; }
+
+        auto it = m_AnalyzedWords.constFind(word);
+        if (it == m_AnalyzedWords.constEnd()) { return false; }
+
+        result.m_Stem = it->m_Stem;
+        result.m_IsCorrect = it->m_IsCorrect;
+        result.m_HasDuplicates = false;
+        return true;
+    }
+
+    void SpellCheckItemInfo::updateWordsAnalysis(const QHash<QString, Common::WordAnalysisResult> &results, Common::WordAnalysisFlags flags, bool replace, quint32 generation) {
+        QWriteLocker writeLocker(&m_AnalyzedWordsLock);
+        Q_UNUSED(writeLocker);
+
+        if (generation != m_AnalysisGeneration) {
+            LOG_DEBUG << "Skipping stale analysis of generation" << generation;
+            return;
+        }
+
+        // full check contains every current word so words
+        // removed from the item are dropped from the cache
+        if (replace || (m_AnalysisFlags != flags)) {
+            m_AnalyzedWords.clear();
+            m_AnalysisFlags = flags;
+        }
+
+        auto itEnd = results.constEnd();
+        for (auto it = results.constBegin(); it != itEnd; ++it) {
+            // duplicates depend on other words and are always recalculated
+            m_AnalyzedWords.insert(it.key(), Common::WordAnalysisResult(it->m_Stem, it->m_IsCorrect));
+        }
+    }
+
+    void SpellCheckItemInfo::resetWordsAnalysis() {
+        QWriteLocker writeLocker(&m_AnalyzedWordsLock);
+        Q_UNUSED(writeLocker);
+
+        m_AnalyzedWords.clear();
+        m_AnalysisFlags = Common::WordAnalysisFlags::None;
+        m_AnalysisGeneration++;
+    }
+
+    quint32 SpellCheckItemInfo::getAnalysisGeneration() {
+        QReadLocker readLocker(&m_AnalyzedWordsLock);
+        Q_UNUSED(readLocker);
+
+        return m_AnalysisGeneration;
+    }
+
+    int SpellCheckItemInfo::getAnalyzedWordsCount() {
+        QReadLocker readLocker(&m_AnalyzedWordsLock);
+        Q_UNUSED(readLocker);
+
+        return m_AnalyzedWords.size();
     }
 
     QSyntaxHighlighter *SpellCheckItemInfo::createHighlighterForDescription(QTextDocument *document,
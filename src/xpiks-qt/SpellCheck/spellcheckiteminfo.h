@@ -12,11 +12,14 @@
 #define SPELLCHECKITEMINFO_H
 
 #include <QSet>
+#include <QHash>
 #include <QString>
 #include <QObject>
 #include <QStringList>
 #include <QTextDocument>
 #include <QReadWriteLock>
+#include "../Common/flags.h"
+#include "../Common/wordanalysisresult.h"
 
 namespace Common {
     class BasicMetadataModel;
@@ -54,6 +57,9 @@ namespace SpellCheck {
 
     class SpellCheckItemInfo
     {
+    public:
+        SpellCheckItemInfo();
+
     public:
         void setDescriptionErrors(const QSet<QString> &errors);
         void setTitleErrors(const QSet<QString> &errors);
@@ -72,7 +78,7 @@ namespace SpellCheck {
         bool hasTitleError(const QString &word) { return m_TitleErrors.hasWrongSpelling(word); }
         bool hasTitleDuplicate(const QString &word) { return m_TitleErrors.hasDuplicates(word); }
         bool hasDescriptionDuplicate(const QString &word) { return m_DescriptionErrors.hasDuplicates(word); }
-        void clear() { m_DescriptionErrors.clear(); m_TitleErrors.clear(); }
+        void clear() { m_DescriptionErrors.clear(); m_TitleErrors.clear(); resetWordsAnalysis(); }
         void clearDuplicates() { m_DescriptionErrors.clearDuplicates(); m_TitleErrors.clearDuplicates(); }
         bool anyTitleDuplicates() { return m_TitleErrors.anyDuplicate(); }
         bool anyDescriptionDuplicates() { return m_DescriptionErrors.anyDuplicate(); }
@@ -80,9 +86,23 @@ namespace SpellCheck {
         SpellCheckErrorsInfo *getTitleErrors() { return &m_TitleErrors; }
         SpellCheckErrorsInfo *getDescriptionErrors() { return &m_DescriptionErrors; }
 
+    public:
+        bool tryGetWordAnalysis(const QString &word, Common::WordAnalysisFlags flags, Common::WordAnalysisResult &result);
+        void updateWordsAnalysis(const QHash<QString, Common::WordAnalysisResult> &results, Common::WordAnalysisFlags flags, bool replace, quint32 generation);
+        void resetWordsAnalysis();
+        quint32 getAnalysisGeneration();
+        int getAnalyzedWordsCount();
+
     private:
         SpellCheckErrorsInfo m_DescriptionErrors;
         SpellCheckErrorsInfo m_TitleErrors;
+        // spelling and stems of words from the last check so that
+        // an edit only sends added or changed words to Hunspell
+        QHash<QString, Common::WordAnalysisResult> m_AnalyzedWords;
+        QReadWriteLock m_AnalyzedWordsLock;
+        Common::WordAnalysisFlags m_AnalysisFlags;
+        // bumped on reset so that checks started before it cannot bring old results back
+        quint32 m_AnalysisGeneration;
     };
 }
 
@@ -17,18 +17,17 @@
 #include <QUrl>
 #include <QCoreApplication>
 #include <QStandardPaths>
-#include <QThread>
 #include "spellcheckitem.h"
 #include "../Common/defines.h"
 #include "../Common/flags.h"
 #include "../Helpers/stringhelper.h"
+#include "../Helpers/startuptimeline.h"
 #include <hunspell/hunspell.hxx>
 
 #define EN_HUNSPELL_DIC "en_US.dic"
 #define EN_HUNSPELL_AFF "en_US.aff"
 
 #define MINIMUM_LENGTH_FOR_STEMMING 3
-#define SPELLCHECK_WORKER_SLEEP_DELAY 500
 #define SPELLCHECK_DELAY_PERIOD 50
 
 namespace SpellCheck {
@@ -39,7 +38,8 @@ namespace SpellCheck {
         m_SettingsModel(settingsModel),
         m_Hunspell(NULL),
         m_Codec(NULL),
-        m_UserDictionaryPath("")
+        m_UserDictionaryPath(""),
+        m_HunspellLoadAttempted(false)
     {
         Q_ASSERT(settingsModel);
     }
@@ -58,6 +58,24 @@ namespace SpellCheck {
         Helpers::AsyncCoordinatorUnlocker unlocker(m_InitCoordinator);
         Q_UNUSED(unlocker);
 
+        // Hunspell dictionaries are loaded on first use or on idle
+        initUserDictionary();
+
+        return true;
+    }
+
+    void SpellCheckWorker::warmupWorker() {
+        LOG_DEBUG << "#";
+        ensureHunspellLoaded();
+    }
+
+    bool SpellCheckWorker::ensureHunspellLoaded() {
+        if (m_HunspellLoadAttempted) { return m_Hunspell != NULL; }
+        m_HunspellLoadAttempted = true;
+
+        Helpers::StartupStageTimer stageTimer("Hunspell dictionaries");
+        Q_UNUSED(stageTimer);
+
         QString resourcesPath;
         QString affPath;
         QString dicPath;
@@ -99,8 +117,6 @@ namespace SpellCheck {
             LOG_WARNING << "DIC or AFF file not found." << dicPath << "||" << affPath;
         }
 
-        initUserDictionary();
-
         return initResult;
     }
 
@@ -109,20 +125,36 @@ namespace SpellCheck {
             emit queueIsEmpty();
         } else {
             ItemProcessingWorker::processOneItemEx(item, batchID, flags);
-
-            if (getWithDelayFlag(flags)) {
-                QThread::msleep(SPELLCHECK_WORKER_SLEEP_DELAY);
-            }
         }
     }
 
+    bool SpellCheckWorker::tryGetCoalescingKey(const std::shared_ptr<ISpellCheckItem> &item, coalescing_key_t &key) const {
+        auto queryItem = std::dynamic_pointer_cast<SpellCheckItem>(item);
+        if (!queryItem || !queryItem->getIsCoalescable()) { return false; }
+
+        const quint64 kind = ((quint64)queryItem->getWordAnalysisFlags() << 48) |
+                ((quint64)queryItem->getSpellCheckFlags() << 32) |
+                (quint32)(queryItem->getKeywordIndex() + 1);
+        key = coalescing_key_t((quintptr)queryItem->getSpellCheckable(), kind);
+        return true;
+    }
+
     void SpellCheckWorker::processOneItem(std::shared_ptr<ISpellCheckItem> &item) {
         auto queryItem = std::dynamic_pointer_cast<SpellCheckItem>(item);
         auto addWordItem = std::dynamic_pointer_cast<ModifyUserDictItem>(item);
 
         if (queryItem) {
+            if (!ensureHunspellLoaded()) {
+                LOG_WARNING << "Hunspell is not available. Skipping item";
+                return;
+            }
+
             processQueryItem(queryItem);
         } else if (addWordItem) {
+            if (!ensureHunspellLoaded()) {
+                LOG_WARNING << "Hunspell is not available. User dictionary words will not be filtered";
+            }
+
             processChangeUserDict(addWordItem);
         }
     }
@@ -141,12 +173,17 @@ namespace SpellCheck {
                 auto &queryItem = queryItems.at(i);
                 bool isOk = true;
 
-                if (shouldCheckSpelling) {
-                    isOk = checkWordSpelling(queryItem);
-                }
+                if (queryItem->m_IsAnalyzed) {
+                    // unchanged word: only semantic duplicates are recalculated
+                    isOk = queryItem->m_IsCorrect;
+                } else {
+                    if (shouldCheckSpelling) {
+                        isOk = checkWordSpelling(queryItem);
+                    }
 
-                if (shouldStemWord) {
-                    stemWord(queryItem);
+                    if (shouldStemWord) {
+                        stemWord(queryItem);
+                    }
                 }
 
                 anyWrong = anyWrong || !isOk;
@@ -194,8 +231,10 @@ namespace SpellCheck {
     }
 
     QStringList SpellCheckWorker::retrieveCorrections(const QString &word) {
-        QReadLocker locker(&m_SuggestionsLock);
         QStringList result;
+        if (m_Hunspell == NULL) { return result; }
+
+        QReadLocker locker(&m_SuggestionsLock);
 
         auto it = m_Suggestions.find(word);
         if (it != m_Suggestions.end()) {
@@ -207,6 +246,8 @@ namespace SpellCheck {
 
     QStringList SpellCheckWorker::suggestCorrections(const QString &word) {
         QStringList suggestions;
+        if (m_Hunspell == NULL) { return suggestions; }
+
         std::vector<std::string> suggestWordList;
 
         try {
@@ -269,7 +310,7 @@ namespace SpellCheck {
     QString SpellCheckWorker::getWordStem(const QString &word) {
         QString result;
 
-        if (word.isEmpty()) { return result; }
+        if (word.isEmpty() || (m_Hunspell == NULL)) { return result; }
 
         std::string encodedWord = m_Codec->fromUnicode(word).toStdString();
         std::vector<std::string> stems;
@@ -309,6 +350,8 @@ namespace SpellCheck {
     }
 
     void SpellCheckWorker::stemWord(const std::shared_ptr<SpellCheckQueryItem> &queryItem) {
+        if (m_Hunspell == NULL) { return; }
+
         QString word = queryItem->m_Word;
         if (word.length() >= MINIMUM_LENGTH_FOR_STEMMING) {
             queryItem->m_Stem = getWordStem(word.toLower());
@@ -317,6 +360,7 @@ namespace SpellCheck {
 
     bool SpellCheckWorker::isHunspellSpellingCorrect(const QString &word) const {
         bool isOk = false;
+        if (m_Hunspell == NULL) { return isOk; }
 
         try {
             std::string encodedWord = m_Codec->fromUnicode(word).toStdString();
@@ -443,10 +487,15 @@ namespace SpellCheck {
 
         QStringList wordsToAdd;
 
-        for (auto &word: words) {
-            const bool isOk = checkWordSpelling(word);
-            if (overwrite || !isOk) {
-                wordsToAdd.append(word);
+        if (overwrite || (m_Hunspell == NULL)) {
+            // without dictionaries there is nothing to filter against
+            wordsToAdd = words;
+        } else {
+            for (auto &word: words) {
+                const bool isOk = checkWordSpelling(word);
+                if (!isOk) {
+                    wordsToAdd.append(word);
+                }
             }
         }
 
@@ -74,8 +74,11 @@ namespace SpellCheck {
 
     protected:
         virtual bool initWorker() override;
+        virtual const char *getWorkerName() const override { return "SpellCheckWorker"; }
+        virtual void warmupWorker() override;
         virtual void processOneItemEx(std::shared_ptr<ISpellCheckItem> &item, batch_id_t batchID, Common::flag_t flags) override;
         virtual void processOneItem(std::shared_ptr<ISpellCheckItem> &item) override;
+        virtual bool tryGetCoalescingKey(const std::shared_ptr<ISpellCheckItem> &item, coalescing_key_t &key) const override;
 
     private:
         void processQueryItem(std::shared_ptr<SpellCheckItem> &item);
@@ -105,6 +108,7 @@ namespace SpellCheck {
 #endif
 
     private:
+        bool ensureHunspellLoaded();
         void detectAffEncoding();
         QStringList suggestCorrections(const QString &word);
         bool checkWordSpelling(const std::shared_ptr<SpellCheckQueryItem> &queryItem);
@@ -131,6 +135,7 @@ namespace SpellCheck {
         // Coded does not need destruction
         QTextCodec *m_Codec;
         QString m_UserDictionaryPath;
+        bool m_HunspellLoadAttempted;
     };
 }
 
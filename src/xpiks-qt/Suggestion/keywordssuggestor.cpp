@@ -10,7 +10,6 @@
 
 #include <QHash>
 #include <QString>
-#include <QMultiMap>
 #include "keywordssuggestor.h"
 #include "suggestionartwork.h"
 #include "../Commands/commandmanager.h"
@@ -19,6 +18,7 @@
 #include "suggestionqueryenginebase.h"
 #include "shutterstockqueryengine.h"
 #include "locallibraryqueryengine.h"
+#include "relatedkeywordsqueryengine.h"
 #include "fotoliaqueryengine.h"
 #include "gettyqueryengine.h"
 #include "../Models/switchermodel.h"
@@ -28,6 +28,7 @@
 
 #define LINEAR_TIMER_INTERVAL 1000
 #define DEFAULT_SEARCH_TYPE_INDEX 0
+#define MAX_RELATED_SUGGESTED_KEYWORDS 40
 
 namespace Suggestion {
     KeywordsSuggestor::KeywordsSuggestor(QObject *parent):
@@ -55,6 +56,7 @@ namespace Suggestion {
     void KeywordsSuggestor::setExistingKeywords(const QSet<QString> &keywords) {
         LOG_DEBUG << "#";
         m_ExistingKeywords.clear(); m_ExistingKeywords.unite(keywords);
+        rebuildFrequencyBuckets();
     }
 
     void KeywordsSuggestor::initSuggestionEngines() {
@@ -72,6 +74,7 @@ namespace Suggestion {
             LOG_DEBUG << "Getty query engine is disabled";
         }
         m_QueryEngines.append(new FotoliaQueryEngine(id++, settingsModel));
+        m_QueryEngines.append(new RelatedKeywordsQueryEngine(id++, metadataIOService));
         m_QueryEngines.append(new LocalLibraryQueryEngine(id++, metadataIOService));
         m_LocalSearchIndex = m_QueryEngines.length() - 1;
 
@@ -94,7 +97,7 @@ namespace Suggestion {
         LOG_INFO << suggestedArtworks.size() << "item(s)";
 
         m_SelectedArtworksCount = 0;
-        m_KeywordsHash.clear();
+        clearKeywordsFrequencies();
         m_SuggestedKeywords.clearKeywords();
         m_AllOtherKeywords.clearKeywords();
 
@@ -135,11 +138,36 @@ namespace Suggestion {
         emit selectedArtworksCountChanged();
     }
 
+    void KeywordsSuggestor::setRelatedKeywords(const QStringList &keywords) {
+        LOG_INFO << keywords.size() << "keyword(s)";
+
+        m_SelectedArtworksCount = 0;
+        clearKeywordsFrequencies();
+
+        beginResetModel();
+        {
+            m_Suggestions.clear();
+        }
+        endResetModel();
+
+        // keywords are already ranked by the engine
+        QStringList suggestedKeywords = keywords.mid(0, MAX_RELATED_SUGGESTED_KEYWORDS);
+        QStringList otherKeywords = keywords.mid(MAX_RELATED_SUGGESTED_KEYWORDS);
+        m_SuggestedKeywords.setKeywords(suggestedKeywords);
+        m_AllOtherKeywords.setKeywords(otherKeywords);
+
+        unsetInProgress();
+        emit suggestionArrived();
+        emit suggestedKeywordsCountChanged();
+        emit otherKeywordsCountChanged();
+        emit selectedArtworksCountChanged();
+    }
+
     void KeywordsSuggestor::clear() {
         LOG_DEBUG << "#";
 
         m_SelectedArtworksCount = 0;
-        m_KeywordsHash.clear();
+        clearKeywordsFrequencies();
         m_SuggestedKeywords.clearKeywords();
         m_AllOtherKeywords.clearKeywords();
         m_ExistingKeywords.clear();
@@ -199,8 +227,12 @@ namespace Suggestion {
         }
 
         unsetInProgress();
-        auto &results = currentEngine->getLastResults();
-        setSuggestedArtworks(results);
+        if (currentEngine->getIsKeywordsOnly()) {
+            setRelatedKeywords(currentEngine->getLastKeywords());
+        } else {
+            auto &results = currentEngine->getLastResults();
+            setSuggestedArtworks(results);
+        }
     }
 
     void KeywordsSuggestor::errorsReceivedHandler(const QString &error) {
@@ -305,14 +337,23 @@ namespace Suggestion {
     void KeywordsSuggestor::searchArtworks(const QString &searchTerm, int resultsType) {
         LOG_INFO << "[" << searchTerm << "], search type:" << resultsType;
 
-        if (!m_IsInProgress && !searchTerm.trimmed().isEmpty()) {
+        SuggestionQueryEngineBase *engine = m_QueryEngines.at(m_SelectedSourceIndex);
+        const bool isKeywordsOnly = engine->getIsKeywordsOnly();
+        // related keywords can be suggested just for keywords of the artwork
+        const bool canSearch = !searchTerm.trimmed().isEmpty() ||
+                (isKeywordsOnly && !m_ExistingKeywords.isEmpty());
+
+        if (!m_IsInProgress && canSearch) {
             setInProgress();
 
-            SuggestionQueryEngineBase *engine = m_QueryEngines.at(m_SelectedSourceIndex);
             SearchQuery query(searchTerm, resultsType, engine->getMaxResults());
+            if (isKeywordsOnly) {
+                query.m_SearchTerms.append(m_ExistingKeywords.toList());
+            }
+
             engine->submitQuery(query);
 
-            if (dynamic_cast<LocalLibraryQueryEngine*>(engine) == NULL) {
+            if ((dynamic_cast<LocalLibraryQueryEngine*>(engine) == NULL) && !isKeywordsOnly) {
                 xpiks()->reportUserAction(Connectivity::UserAction::SuggestionRemote);
             } else {
                 xpiks()->reportUserAction(Connectivity::UserAction::SuggestionLocal);
@@ -338,7 +379,7 @@ namespace Suggestion {
     void KeywordsSuggestor::resetSelection() {
         LOG_DEBUG << "#";
         m_SelectedArtworksCount = 0;
-        m_KeywordsHash.clear();
+        clearKeywordsFrequencies();
         m_SuggestedKeywords.clearKeywords();
         m_AllOtherKeywords.clearKeywords();
         m_ExistingKeywords.clear();
@@ -399,14 +440,54 @@ namespace Suggestion {
 
     void KeywordsSuggestor::accountKeywords(const QSet<QString> &keywords, int sign) {
         foreach(const QString &keyword, keywords) {
-            if (m_KeywordsHash.contains(keyword)) {
-                m_KeywordsHash[keyword] += sign;
+            int previousFrequency = 0;
+            int frequency = 1;
+
+            auto it = m_KeywordsHash.find(keyword);
+            if (it != m_KeywordsHash.end()) {
+                previousFrequency = it.value();
+                frequency = previousFrequency + sign;
+                it.value() = frequency;
             } else {
-                m_KeywordsHash.insert(keyword, 1);
+                m_KeywordsHash.insert(keyword, frequency);
             }
+
+            if (isExistingKeyword(keyword)) { continue; }
+
+            moveToFrequencyBucket(keyword, previousFrequency, frequency);
         }
     }
 
+    void KeywordsSuggestor::moveToFrequencyBucket(const QString &keyword, int previousFrequency, int frequency) {
+        if ((0 < previousFrequency) && (previousFrequency < (int)m_FrequencyBuckets.size())) {
+            m_FrequencyBuckets[previousFrequency].remove(keyword);
+        }
+
+        if (frequency > 0) {
+            if (frequency >= (int)m_FrequencyBuckets.size()) {
+                m_FrequencyBuckets.resize(frequency + 1);
+            }
+
+            m_FrequencyBuckets[frequency].insert(keyword);
+        }
+    }
+
+    void KeywordsSuggestor::rebuildFrequencyBuckets() {
+        m_FrequencyBuckets.clear();
+
+        auto it = m_KeywordsHash.constBegin();
+        auto itEnd = m_KeywordsHash.constEnd();
+        for (; it != itEnd; ++it) {
+            if (isExistingKeyword(it.key())) { continue; }
+            moveToFrequencyBucket(it.key(), 0, it.value());
+        }
+    }
+
+    void KeywordsSuggestor::clearKeywordsFrequencies() {
+        m_KeywordsHash.clear();
+        m_FrequencyBuckets.clear();
+    }
+
     QSet<QString> KeywordsSuggestor::getSelectedArtworksKeywords() const {
         QSet<QString> allKeywords;
         size_t size = m_Suggestions.size();
@@ -425,20 +506,9 @@ namespace Suggestion {
 
     void KeywordsSuggestor::updateSuggestedKeywords() {
         QStringList suggestedKeywords, otherKeywords;
-        QMultiMap<int, QString> selectedKeywords;
         int lowerThreshold, upperThreshold;
         calculateBounds(lowerThreshold, upperThreshold);
 
-        QHash<QString, int>::const_iterator hashIt = m_KeywordsHash.constBegin();
-        QHash<QString, int>::const_iterator hashItEnd = m_KeywordsHash.constEnd();
-
-        for (; hashIt != hashItEnd; ++hashIt) {
-            selectedKeywords.insert(hashIt.value(), hashIt.key());
-        }
-
-        QMultiMap<int, QString>::const_iterator it = selectedKeywords.constEnd();
-        QMultiMap<int, QString>::const_iterator itBegin = selectedKeywords.constBegin();
-
         int maxSuggested = 35 + (qrand() % 10);
         int maxUpperBound = 40 + (qrand() % 5);
         int maxOthers = 35 + (qrand() % 10);
@@ -449,31 +519,26 @@ namespace Suggestion {
         bool canAddToSuggested, canAddToOthers;
         const bool isOnlyOneArtwork = (m_SelectedArtworksCount == 1);
 
-        while (it != itBegin) {
-            --it;
-
-            int frequency = it.key();
-            const QString &frequentKeyword = it.value();
-
-            if (frequency == 0) { continue; }
-            if (m_ExistingKeywords.contains(frequentKeyword.toLower())) {
-                LOG_DEBUG << "Skipping existing keyword" << frequentKeyword;
-                continue;
-            }
+        bool canContinue = true;
 
-            int suggestedCount = suggestedKeywords.length();
+        // buckets exclude existing keywords and keywords of deselected artworks
+        for (int frequency = (int)m_FrequencyBuckets.size() - 1; canContinue && (frequency > 0); frequency--) {
+            for (const QString &frequentKeyword: m_FrequencyBuckets[frequency]) {
+                int suggestedCount = suggestedKeywords.length();
 
-            canAddToSuggested = (frequency >= upperThreshold) && (suggestedCount <= maxUpperBound);
-            canAddToOthers = frequency >= lowerThreshold;
+                canAddToSuggested = (frequency >= upperThreshold) && (suggestedCount <= maxUpperBound);
+                canAddToOthers = frequency >= lowerThreshold;
 
-            if (isOnlyOneArtwork || canAddToSuggested ||
-                    (canAddToOthers && (suggestedCount <= maxSuggested))) {
-                suggestedKeywords.append(frequentKeyword);
-            } else if (canAddToOthers || (otherKeywords.length() <= maxOthers)) {
-                otherKeywords.append(frequentKeyword);
+                if (isOnlyOneArtwork || canAddToSuggested ||
+                        (canAddToOthers && (suggestedCount <= maxSuggested))) {
+                    suggestedKeywords.append(frequentKeyword);
+                } else if (canAddToOthers || (otherKeywords.length() <= maxOthers)) {
+                    otherKeywords.append(frequentKeyword);
 
-                if (otherKeywords.length() > maxOthers) {
-                    break;
+                    if (otherKeywords.length() > maxOthers) {
+                        canContinue = false;
+                        break;
+                    }
                 }
             }
         }
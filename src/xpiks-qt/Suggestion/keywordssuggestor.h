@@ -18,6 +18,7 @@
 #include <QHash>
 #include <QSet>
 #include <QTimer>
+#include <vector>
 #include "../Common/baseentity.h"
 #include "../Common/basickeywordsmodel.h"
 #include "suggestionartwork.h"
@@ -49,6 +50,7 @@ namespace Suggestion {
         void setExistingKeywords(const QSet<QString> &keywords);
         void initSuggestionEngines();
         void setSuggestedArtworks(std::vector<std::shared_ptr<SuggestionArtwork> > &suggestedArtworks);
+        void setRelatedKeywords(const QStringList &keywords);
         void clear();
 
         int getSelectedSourceIndex() const { return m_SelectedSourceIndex; }
@@ -139,6 +141,10 @@ namespace Suggestion {
 
     private:
         void accountKeywords(const QSet<QString> &keywords, int sign);
+        void moveToFrequencyBucket(const QString &keyword, int previousFrequency, int frequency);
+        void rebuildFrequencyBuckets();
+        void clearKeywordsFrequencies();
+        bool isExistingKeyword(const QString &keyword) const { return m_ExistingKeywords.contains(keyword.toLower()); }
         QSet<QString> getSelectedArtworksKeywords() const;
         void updateSuggestedKeywords();
         void calculateBounds(int &lowerBound, int &upperBound) const;
@@ -146,6 +152,8 @@ namespace Suggestion {
     private:
         Common::StatefulEntity m_State;
         QHash<QString, int> m_KeywordsHash;
+        // keywords of selected artworks grouped by frequency
+        std::vector<QSet<QString> > m_FrequencyBuckets;
         std::vector<std::shared_ptr<SuggestionArtwork> > m_Suggestions;
         QVector<SuggestionQueryEngineBase*> m_QueryEngines;
         QStringList m_QueryEnginesNames;
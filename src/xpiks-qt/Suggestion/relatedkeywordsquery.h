@@ -0,0 +1,51 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef RELATEDKEYWORDSQUERY_H
+#define RELATEDKEYWORDSQUERY_H
+
+#include <QObject>
+#include <QVector>
+#include <QPair>
+#include <QStringList>
+
+namespace Suggestion {
+    class RelatedKeywordsQuery: public QObject {
+        Q_OBJECT
+    public:
+        RelatedKeywordsQuery():
+            QObject(),
+            m_MaxResults(0)
+        { }
+
+    public:
+        void setKeywords(const QStringList &keywords, int maxResults) { m_Keywords = keywords; m_MaxResults = maxResults; }
+        const QStringList &getKeywords() const { return m_Keywords; }
+        int getMaxResults() const { return m_MaxResults; }
+        // keyword and count of its co-occurrences
+        QVector<QPair<QString, int> > &getResults() { return m_Results; }
+
+    public:
+        void clear() { m_Results.clear(); }
+
+    public:
+        void notifyResultsReady() { emit resultsReady(); }
+
+    signals:
+        void resultsReady();
+
+    private:
+        QVector<QPair<QString, int> > m_Results;
+        QStringList m_Keywords;
+        int m_MaxResults;
+    };
+}
+
+#endif // RELATEDKEYWORDSQUERY_H
@@ -0,0 +1,47 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "relatedkeywordsqueryengine.h"
+#include "../MetadataIO/metadataioservice.h"
+#include "../Common/defines.h"
+
+namespace Suggestion {
+    RelatedKeywordsQueryEngine::RelatedKeywordsQueryEngine(int engineID, MetadataIO::MetadataIOService *metadataIOService):
+        SuggestionQueryEngineBase(engineID),
+        m_MetadataIOService(metadataIOService)
+    {
+        Q_ASSERT(metadataIOService != nullptr);
+
+        QObject::connect(&m_Query, &RelatedKeywordsQuery::resultsReady,
+                         this, &RelatedKeywordsQueryEngine::resultsFoundHandler);
+    }
+
+    void RelatedKeywordsQueryEngine::submitQuery(const SearchQuery &query) {
+        LOG_DEBUG << query.m_SearchTerms;
+        m_Query.clear();
+        m_Query.setKeywords(query.m_SearchTerms, query.m_MaxResults);
+
+        m_MetadataIOService->suggestKeywords(&m_Query);
+    }
+
+    void RelatedKeywordsQueryEngine::resultsFoundHandler() {
+        QStringList keywords;
+
+        auto &results = m_Query.getResults();
+        keywords.reserve(results.size());
+        for (auto &item: results) {
+            keywords.append(item.first);
+        }
+
+        setKeywordsResults(keywords);
+        results.clear();
+        emit resultsAvailable();
+    }
+}
@@ -0,0 +1,46 @@
+/*
+ * This file is a part of Xpiks - cross platform application for
+ * keywording and uploading images for microstocks
+ * Copyright (C) 2014-2018 Taras Kushnir <kushnirTV@gmail.com>
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef RELATEDKEYWORDSQUERYENGINE_H
+#define RELATEDKEYWORDSQUERYENGINE_H
+
+#include <QObject>
+#include <QString>
+#include "suggestionqueryenginebase.h"
+#include "relatedkeywordsquery.h"
+
+namespace MetadataIO {
+    class MetadataIOService;
+}
+
+namespace Suggestion {
+    class RelatedKeywordsQueryEngine : public SuggestionQueryEngineBase
+    {
+        Q_OBJECT
+    public:
+        RelatedKeywordsQueryEngine(int engineID, MetadataIO::MetadataIOService *metadataIOService);
+
+        // ISuggestionQueryEngine interface
+    public:
+        virtual int getMaxResults() const override { return 80; }
+        virtual void submitQuery(const SearchQuery &query) override;
+        virtual QString getName() const override { return tr("Related keywords"); }
+        virtual bool getIsKeywordsOnly() const override { return true; }
+
+    private slots:
+        void resultsFoundHandler();
+
+    private:
+        RelatedKeywordsQuery m_Query;
+        MetadataIO::MetadataIOService *m_MetadataIOService;
+    };
+}
+
+#endif // RELATEDKEYWORDSQUERYENGINE_H
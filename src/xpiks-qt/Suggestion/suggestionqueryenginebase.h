@@ -39,16 +39,23 @@ namespace Suggestion {
         virtual int getMaxResults() const { return 100; }
         virtual void submitQuery(const SearchQuery &query) = 0;
         virtual QString getName() const = 0;
+        // engine suggests keywords directly instead of artworks
+        virtual bool getIsKeywordsOnly() const { return false; }
 
     public:
         int getID() const { return m_EngineID; }
         void cancelQueries() { emit cancelAllQueries(); }
         std::vector<std::shared_ptr<SuggestionArtwork> > &getLastResults() { return m_LastResults; }
+        QStringList &getLastKeywords() { return m_LastKeywords; }
 
         void setResults(std::vector<std::shared_ptr<SuggestionArtwork> > &results) {
             m_LastResults = std::move(results);
         }
 
+        void setKeywordsResults(QStringList &keywords) {
+            m_LastKeywords.swap(keywords);
+        }
+
     signals:
         void resultsAvailable();
         void cancelAllQueries();
@@ -59,6 +66,7 @@ namespace Suggestion {
 
     private:
         std::vector<std::shared_ptr<SuggestionArtwork> > m_LastResults;
+        QStringList m_LastKeywords;
         Models::SettingsModel *m_SettingsModel;
         int m_EngineID;
     };
@@ -9,7 +9,6 @@
  */
 
 #include "translationservice.h"
-#include <QThread>
 #include "translationworker.h"
 #include "translationquery.h"
 #include "../Helpers/asynccoordinator.h"
@@ -38,14 +37,7 @@ namespace Translation {
 
         m_TranslationWorker = new TranslationWorker(coordinator);
 
-        QThread *thread = new QThread();
-        m_TranslationWorker->moveToThread(thread);
-
-        QObject::connect(thread, &QThread::started, m_TranslationWorker, &TranslationWorker::process);
-        QObject::connect(m_TranslationWorker, &TranslationWorker::stopped, thread, &QThread::quit);
-
         QObject::connect(m_TranslationWorker, &TranslationWorker::stopped, m_TranslationWorker, &TranslationWorker::deleteLater);
-        QObject::connect(thread, &QThread::finished, thread, &QThread::deleteLater);
 
         QObject::connect(m_TranslationWorker, &TranslationWorker::stopped,
                          this, &TranslationService::workerFinished);
@@ -53,8 +45,8 @@ namespace Translation {
         QObject::connect(m_TranslationWorker, &TranslationWorker::destroyed,
                          this, &TranslationService::workerDestroyed);
 
-        LOG_DEBUG << "starting thread...";
-        thread->start();
+        LOG_DEBUG << "starting worker...";
+        m_TranslationWorker->doWorkOnExecutor(Common::TaskPriority::Interactive);
     }
 
     void TranslationService::stopService() {
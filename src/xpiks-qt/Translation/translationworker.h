@@ -37,6 +37,7 @@ namespace Translation {
 
     protected:
         virtual bool initWorker() override;
+        virtual const char *getWorkerName() const override { return "TranslationWorker"; }
         virtual void processOneItem(std::shared_ptr<TranslationQuery> &item) override;
 
     protected:
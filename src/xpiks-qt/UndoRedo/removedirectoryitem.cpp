@@ -32,21 +32,16 @@ void UndoRedo::RemoveDirectoryHistoryItem::fillFilesAndVectors(const QString &di
     vectorFiles.reserve(files.size());
 
     if (autoFindVectors) {
+        QSet<QString> directories;
         for (auto &filepath: files) {
-            QStringList vectors = Helpers::convertToVectorFilenames(filepath);
-
-            bool anyFound = false;
-            foreach (const QString &item, vectors) {
-                if (QFileInfo(item).exists()) {
-                    anyFound = true;
-                    vectorFiles.append(item);
-                    break;
-                }
-            }
-
-            if (!anyFound) {
-                vectorFiles.append("");
-            }
+            directories.insert(QFileInfo(filepath).absolutePath());
+        }
+
+        QHash<QString, QHash<QString, QString> > vectors;
+        Helpers::listVectorsInDirectories(directories, vectors);
+
+        for (auto &filepath: files) {
+            vectorFiles.append(Helpers::findVectorForImage(filepath, vectors));
         }
     } else {
         int n = files.size();
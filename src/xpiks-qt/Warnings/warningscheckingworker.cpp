@@ -20,7 +20,6 @@
 #include "warningssettingsmodel.h"
 #include "warningsitem.h"
 
-#define WARNINGS_WORKER_SLEEP_INTERVAL 500
 #define WARNINGS_DELAY_PERIOD 50
 
 namespace Warnings {
@@ -47,15 +46,20 @@ namespace Warnings {
         return true;
     }
 
+    bool WarningsCheckingWorker::tryGetCoalescingKey(const std::shared_ptr<IWarningsItem> &item, coalescing_key_t &key) const {
+        auto warningsItem = std::dynamic_pointer_cast<WarningsItem>(item);
+        if (!warningsItem) { return false; }
+
+        // item copies artwork's metadata on creation so the newest copy is enough
+        key = coalescing_key_t((quintptr)warningsItem->getCheckableItem(), (quint64)warningsItem->getCheckingFlags());
+        return true;
+    }
+
     void WarningsCheckingWorker::processOneItemEx(std::shared_ptr<IWarningsItem> &item, batch_id_t batchID, Common::flag_t flags) {
         if (getIsSeparatorFlag(flags)) {
             emit queueIsEmpty();
         } else {
             ItemProcessingWorker::processOneItemEx(item, batchID, flags);
-
-            if (getWithDelayFlag(flags)) {
-                QThread::msleep(WARNINGS_WORKER_SLEEP_INTERVAL);
-            }
         }
     }
 
@@ -30,8 +30,10 @@ namespace Warnings {
 
     protected:
         virtual bool initWorker() override;
+        virtual const char *getWorkerName() const override { return "WarningsCheckingWorker"; }
         virtual void processOneItemEx(std::shared_ptr<IWarningsItem> &item, batch_id_t batchID, Common::flag_t flags) override;
         virtual void processOneItem(std::shared_ptr<IWarningsItem> &item) override;
+        virtual bool tryGetCoalescingKey(const std::shared_ptr<IWarningsItem> &item, coalescing_key_t &key) const override;
 
     private:
         void processWarningsItem(std::shared_ptr<WarningsItem> &item);
@@ -39,14 +39,7 @@ namespace Warnings {
         Q_UNUSED(params);
         m_WarningsWorker = new WarningsCheckingWorker(&m_WarningsSettingsModel);
 
-        QThread *thread = new QThread();
-        m_WarningsWorker->moveToThread(thread);
-
-        QObject::connect(thread, &QThread::started, m_WarningsWorker, &WarningsCheckingWorker::process);
-        QObject::connect(m_WarningsWorker, &WarningsCheckingWorker::stopped, thread, &QThread::quit);
-
         QObject::connect(m_WarningsWorker, &WarningsCheckingWorker::stopped, m_WarningsWorker, &WarningsCheckingWorker::deleteLater);
-        QObject::connect(thread, &QThread::finished, thread, &QThread::deleteLater);
 
         QObject::connect(m_WarningsWorker, &WarningsCheckingWorker::destroyed,
                          this, &WarningsService::workerDestoyed);
@@ -59,7 +52,7 @@ namespace Warnings {
 
         LOG_INFO << "Starting worker";
 
-        thread->start();
+        m_WarningsWorker->doWorkOnExecutor(Common::TaskPriority::Normal);
 
         m_IsStopped = false;
     }
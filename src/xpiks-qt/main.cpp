@@ -24,6 +24,7 @@
 #include <QApplication>
 #include <QQuickWindow>
 #include <QStandardPaths>
+#include <QCommandLineParser>
 #include <QQmlApplicationEngine>
 #include <QDesktopWidget>
 // -------------------------------------
@@ -75,11 +76,13 @@
 #include "Helpers/constants.h"
 #include "Helpers/runguard.h"
 #include "Models/logsmodel.h"
+#include "Models/metricsmodel.h"
 #include "Models/uimanager.h"
 #include "Helpers/database.h"
 #include "Helpers/logger.h"
 #include "Common/version.h"
 #include "Common/defines.h"
+#include "Common/workstealingexecutor.h"
 #include "Models/proxysettings.h"
 #include "Models/findandreplacemodel.h"
 #include "Models/previewartworkelement.h"
@@ -94,10 +97,16 @@
 #include "KeywordsPresets/presetgroupsmodel.h"
 #include <ftpcoordinator.h>
 #include "Helpers/filehelpers.h"
+#include "Helpers/startuptimeline.h"
+#include "Helpers/tracing.h"
 
 void myMessageHandler(QtMsgType type, const QMessageLogContext &context, const QString &msg) {
     Q_UNUSED(context);
 
+    Helpers::Logger &logger = Helpers::Logger::getInstance();
+    // do not spend time on formatting of filtered out messages
+    if (!logger.isLevelEnabled(type)) { return; }
+
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 4, 0))
     QString logLine = qFormatLogMessage(type, context, msg);
 #else
@@ -130,7 +139,6 @@ void myMessageHandler(QtMsgType type, const QMessageLogContext &context, const Q
                           .arg(msg);
 #endif
 
-    Helpers::Logger &logger = Helpers::Logger::getInstance();
     logger.log(logLine);
 
     if (type == QtFatalMsg) {
@@ -216,6 +224,32 @@ int main(int argc, char *argv[]) {
     QApplication app(argc, argv);
     // ----------------------------------------------
 
+    QCommandLineParser parser;
+    QCommandLineOption traceOption(QStringList() << "trace",
+                                   "Record spans and write them to <file> in Chrome trace_event format on exit.",
+                                   "file");
+    parser.addOption(traceOption);
+    QCommandLineOption logLevelOption(QStringList() << "log-level",
+                                      "Minimal level of messages to log: debug, info or warning.",
+                                      "level");
+    parser.addOption(logLevelOption);
+    // unknown arguments (e.g. -psn_* on OS X) are not an error
+    parser.parse(app.arguments());
+
+    const QString traceFilePath = parser.value(traceOption);
+    Helpers::Tracer &tracer = Helpers::Tracer::getInstance();
+    tracer.setEnabled(!traceFilePath.isEmpty());
+
+    const QString logLevel = parser.value(logLevelOption).toLower();
+    if (logLevel == QLatin1String("warning")) {
+        Helpers::Logger::getInstance().setMinimumLevel(QtWarningMsg);
+    }
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 5, 0))
+    else if (logLevel == QLatin1String("info")) {
+        Helpers::Logger::getInstance().setMinimumLevel(QtInfoMsg);
+    }
+#endif
+
     QString appDataPath = XPIKS_USERDATA_PATH;
 
 #ifdef WITH_LOGS
@@ -241,6 +275,9 @@ int main(int argc, char *argv[]) {
     Models::LogsModel logsModel(&colorsModel);
     logsModel.startLogging();
 
+    Helpers::StartupTimeline &startupTimeline = Helpers::StartupTimeline::getInstance();
+    startupTimeline.reportMilestone("Logging started");
+
     LOG_INFO << "Log started. Today is" << QDateTime::currentDateTimeUtc().toString("dd.MM.yyyy");
     LOG_INFO << "Xpiks" << XPIKS_FULL_VERSION_STRING << "-" << STRINGIZE(BUILDNUMBER);
     LOG_INFO << QSysInfo::productType() << QSysInfo::productVersion() << QSysInfo::currentCpuArchitecture();
@@ -306,6 +343,8 @@ int main(int argc, char *argv[]) {
     Helpers::DatabaseManager databaseManager;
     SpellCheck::DuplicatesReviewModel duplicatesModel(&colorsModel);
     MetadataIO::CsvExportModel csvExportModel;
+    Models::MetricsModel metricsModel;
+    metricsModel.startLogging();
 
     Connectivity::UpdateService updateService(&settingsModel, &switcherModel);
 
@@ -400,7 +439,7 @@ int main(int argc, char *argv[]) {
 
     QQmlApplicationEngine engine;
     Helpers::GlobalImageProvider *globalProvider = new Helpers::GlobalImageProvider(QQmlImageProviderBase::Image);
-    QMLExtensions::CachingImageProvider *cachingProvider = new QMLExtensions::CachingImageProvider(QQmlImageProviderBase::Image);
+    QMLExtensions::CachingImageProvider *cachingProvider = new QMLExtensions::CachingImageProvider();
     cachingProvider->setImageCachingService(&imageCachingService);
 
     QQmlContext *rootContext = engine.rootContext();
@@ -434,6 +473,7 @@ int main(int argc, char *argv[]) {
     rootContext->setContextProperty("switcher", &switcherModel);
     rootContext->setContextProperty("duplicatesModel", &duplicatesModel);
     rootContext->setContextProperty("csvExportModel", &csvExportModel);
+    rootContext->setContextProperty("metricsModel", &metricsModel);
     rootContext->setContextProperty("presetsGroups", presetsModel.getGroupsModel());
 
     rootContext->setContextProperty("tabsModel", uiManager.getTabsModel());
@@ -460,6 +500,7 @@ int main(int argc, char *argv[]) {
     LOG_DEBUG << "About to load main view...";
     engine.load(QUrl(QStringLiteral("qrc:/main.qml")));
     LOG_DEBUG << "Main view loaded";
+    startupTimeline.reportMilestone("Main view loaded");
 
     auto *uiProvider = pluginManager.getUIProvider();
     uiProvider->setQmlEngine(&engine);
@@ -476,5 +517,17 @@ int main(int argc, char *argv[]) {
 
     commandManager.afterConstructionCallback();
 
-    return app.exec();
+    int result = app.exec();
+
+    // let stopped services finish their last items
+    Common::WorkStealingExecutor::getInstance().stop();
+
+    metricsModel.stopLogging();
+    metricsModel.logSnapshot();
+
+    if (tracer.isEnabled()) {
+        tracer.dumpChromeTrace(traceFilePath);
+    }
+
+    return result;
 }
@@ -515,10 +515,7 @@ ApplicationWindow {
                     delegate: MenuItem {
                         text: display
                         onTriggered: {
-                            var filesAdded = artItemsModel.addRecentDirectory(display)
-                            if (filesAdded === 0) {
-                                noNewFilesDialog.open()
-                            }
+                            artItemsModel.addRecentDirectory(display)
                         }
                     }
                 }
@@ -772,6 +769,14 @@ ApplicationWindow {
                     text: i18.n + qsTr("Show logs")
                     action: showLogsAction
                 }
+
+                MenuItem {
+                    text: i18.n + qsTr("Diagnostics")
+                    enabled: applicationWindow.openedDialogsCount == 0
+                    onTriggered: {
+                        Common.launchDialog("Dialogs/DiagnosticsDialog.qml", applicationWindow, {})
+                    }
+                }
             }
         }
 
@@ -1126,11 +1131,8 @@ ApplicationWindow {
 
         onAccepted: {
             console.debug("You chose: " + chooseDirectoryDialog.fileUrls)
-            var filesAdded = artItemsModel.addLocalDirectories(chooseDirectoryDialog.fileUrls)
-            console.debug("" + filesAdded + ' files via Open Directory')
-            if (filesAdded === 0) {
-                noNewFilesDialog.open()
-            }
+            // files are reported with artworksAdded() when the directory is listed
+            artItemsModel.addLocalDirectories(chooseDirectoryDialog.fileUrls)
         }
 
         onRejected: {
@@ -182,7 +182,21 @@ SOURCES += main.cpp \
     Common/basickeywordsmodelimpl.cpp \
     Maintenance/xpkscleanupjob.cpp \
     Commands/maindelegator.cpp \
-    Common/baseentity.cpp
+    Common/baseentity.cpp \
+    Helpers/startuptimeline.cpp \
+    Helpers/tracing.cpp \
+    Helpers/directorywatcher.cpp \
+    MetadataIO/librarysearchworker.cpp \
+    MetadataIO/keywordscooccurrenceindex.cpp \
+    Suggestion/relatedkeywordsqueryengine.cpp \
+    QMLExtensions/cachedimageresponse.cpp \
+    Common/workstealingexecutor.cpp \
+    Helpers/metrics.cpp \
+    Models/metricsmodel.cpp \
+    AutoComplete/wordlistindex.cpp \
+    AutoComplete/keywordsfrequencytrie.cpp \
+    AutoComplete/keywordscompletionengine.cpp \
+    KeywordsPresets/presetsnameindex.cpp
 
 RESOURCES += qml.qrc
 
@@ -426,7 +440,23 @@ HEADERS += \
     Maintenance/xpkscleanupjob.h \
     Commands/maindelegator.h \
     KeywordsPresets/presetmodel.h \
-    KeywordsPresets/groupmodel.h
+    KeywordsPresets/groupmodel.h \
+    Helpers/startuptimeline.h \
+    Helpers/tracing.h \
+    Helpers/directorywatcher.h \
+    MetadataIO/librarysearchworker.h \
+    MetadataIO/keywordscooccurrenceindex.h \
+    Suggestion/relatedkeywordsquery.h \
+    Suggestion/relatedkeywordsqueryengine.h \
+    QMLExtensions/cachedimageresponse.h \
+    Common/workstealingexecutor.h \
+    Common/mpscqueue.h \
+    Helpers/metrics.h \
+    Models/metricsmodel.h \
+    AutoComplete/wordlistindex.h \
+    AutoComplete/keywordsfrequencytrie.h \
+    AutoComplete/keywordscompletionengine.h \
+    KeywordsPresets/presetsnameindex.h
 
 DISTFILES += \
     Components/CloseIcon.qml \
@@ -0,0 +1,140 @@
+#include "benchmarkrunner.h"
+#include <algorithm>
+#include <iostream>
+#include <QElapsedTimer>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QDateTime>
+#include <QSysInfo>
+#include <QThread>
+#include <QFile>
+#include "../../xpiks-qt/Common/version.h"
+
+#define BENCHMARKS_FORMAT_VERSION 1
+
+namespace Benchmarks {
+    qint64 percentile(const std::vector<qint64> &sortedSamples, int percent) {
+        if (sortedSamples.empty()) { return 0; }
+        size_t index = (sortedSamples.size() * percent) / 100;
+        if (index >= sortedSamples.size()) { index = sortedSamples.size() - 1; }
+        return sortedSamples[index];
+    }
+
+    BenchmarkRunner::BenchmarkRunner(const BenchmarkOptions &options):
+        m_Options(options),
+        m_FilterRegExp(options.m_Filter, Qt::CaseInsensitive, QRegExp::Wildcard)
+    {
+        Q_ASSERT(m_Options.m_Iterations > 0);
+    }
+
+    bool BenchmarkRunner::isSelected(const QString &name) const {
+        if (m_Options.m_Filter.isEmpty()) { return true; }
+        return m_FilterRegExp.exactMatch(name);
+    }
+
+    void BenchmarkRunner::run(const QString &name, BenchmarkKind kind, qint64 itemsPerIteration,
+                              const std::function<void ()> &body,
+                              const std::function<void ()> &setup) {
+        if (!isSelected(name)) { return; }
+
+        std::cerr << "Running " << name.toStdString() << "..." << std::endl;
+
+        BenchmarkResult result;
+        result.m_Name = name;
+        result.m_Kind = kind;
+        result.m_ItemsPerIteration = itemsPerIteration;
+        result.m_SamplesNs.reserve(m_Options.m_Iterations);
+
+        if (setup) { setup(); }
+        body();
+
+        QElapsedTimer timer;
+        for (int i = 0; i < m_Options.m_Iterations; i++) {
+            if (setup) { setup(); }
+
+            timer.start();
+            body();
+            result.m_SamplesNs.push_back(timer.nsecsElapsed());
+        }
+
+        m_Results.emplace_back(std::move(result));
+    }
+
+    QJsonObject BenchmarkRunner::toJson() const {
+        QJsonArray results;
+
+        for (auto &result: m_Results) {
+            std::vector<qint64> samples = result.m_SamplesNs;
+            std::sort(samples.begin(), samples.end());
+
+            qint64 sum = 0;
+            for (qint64 sample: samples) { sum += sample; }
+            const qint64 mean = samples.empty() ? 0 : sum / (qint64)samples.size();
+            const qint64 median = percentile(samples, 50);
+
+            QJsonObject item;
+            item.insert("name", result.m_Name);
+            item.insert("kind", QLatin1String(result.m_Kind == BenchmarkKind::Micro ? "micro" : "macro"));
+            item.insert("iterations", (int)samples.size());
+            item.insert("items", (double)result.m_ItemsPerIteration);
+            item.insert("min_ns", (double)(samples.empty() ? 0 : samples.front()));
+            item.insert("max_ns", (double)(samples.empty() ? 0 : samples.back()));
+            item.insert("mean_ns", (double)mean);
+            item.insert("median_ns", (double)median);
+            item.insert("p95_ns", (double)percentile(samples, 95));
+            item.insert("ns_per_item", result.m_ItemsPerIteration > 0 ? (double)median / result.m_ItemsPerIteration : 0.0);
+
+            results.append(item);
+        }
+
+        QJsonObject options;
+        options.insert("artworks", m_Options.m_ArtworksCount);
+        options.insert("iterations", m_Options.m_Iterations);
+        options.insert("seed", (double)m_Options.m_Seed);
+
+        QJsonObject machine;
+        machine.insert("os", QSysInfo::prettyProductName());
+        machine.insert("cpu_arch", QSysInfo::currentCpuArchitecture());
+        machine.insert("cores", QThread::idealThreadCount());
+
+        QJsonObject root;
+        root.insert("format", BENCHMARKS_FORMAT_VERSION);
+        root.insert("xpiks_version", QString(XPIKS_VERSION_STRING));
+        root.insert("timestamp", QDateTime::currentDateTimeUtc().toString(Qt::ISODate));
+        root.insert("machine", machine);
+        root.insert("options", options);
+        root.insert("results", results);
+
+        return root;
+    }
+
+    bool BenchmarkRunner::saveJson(const QString &filepath) const {
+        QFile file(filepath);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            std::cerr << "Failed to open " << filepath.toStdString() << std::endl;
+            return false;
+        }
+
+        QJsonDocument document(toJson());
+        file.write(document.toJson(QJsonDocument::Indented));
+        file.close();
+
+        return true;
+    }
+
+    void BenchmarkRunner::printSummary() const {
+        for (auto &result: m_Results) {
+            std::vector<qint64> samples = result.m_SamplesNs;
+            std::sort(samples.begin(), samples.end());
+            const qint64 median = percentile(samples, 50);
+
+            std::cerr << result.m_Name.toStdString()
+                      << ": median " << (median / 1000) << " us"
+                      << ", p95 " << (percentile(samples, 95) / 1000) << " us";
+            if (result.m_ItemsPerIteration > 0) {
+                std::cerr << ", " << (median / result.m_ItemsPerIteration) << " ns/item";
+            }
+            std::cerr << std::endl;
+        }
+    }
+}
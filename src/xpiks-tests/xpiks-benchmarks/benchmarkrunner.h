@@ -0,0 +1,64 @@
+#ifndef BENCHMARKRUNNER_H
+#define BENCHMARKRUNNER_H
+
+#include <QString>
+#include <QRegExp>
+#include <QJsonObject>
+#include <vector>
+#include <functional>
+
+namespace Benchmarks {
+    enum struct BenchmarkKind {
+        Micro,
+        Macro
+    };
+
+    struct BenchmarkOptions {
+        BenchmarkOptions():
+            m_ArtworksCount(5000),
+            m_Iterations(10),
+            m_Seed(42)
+        {}
+
+        QString m_Filter;
+        int m_ArtworksCount;
+        int m_Iterations;
+        unsigned int m_Seed;
+    };
+
+    struct BenchmarkResult {
+        QString m_Name;
+        BenchmarkKind m_Kind;
+        qint64 m_ItemsPerIteration;
+        std::vector<qint64> m_SamplesNs;
+    };
+
+    class BenchmarkRunner
+    {
+    public:
+        BenchmarkRunner(const BenchmarkOptions &options);
+
+    public:
+        const BenchmarkOptions &getOptions() const { return m_Options; }
+        bool isSelected(const QString &name) const;
+
+    public:
+        // body is executed once for warmup and then measured
+        // for each iteration, setup is not included in the measurements
+        void run(const QString &name, BenchmarkKind kind, qint64 itemsPerIteration,
+                 const std::function<void ()> &body,
+                 const std::function<void ()> &setup = std::function<void ()>());
+
+    public:
+        QJsonObject toJson() const;
+        bool saveJson(const QString &filepath) const;
+        void printSummary() const;
+
+    private:
+        BenchmarkOptions m_Options;
+        QRegExp m_FilterRegExp;
+        std::vector<BenchmarkResult> m_Results;
+    };
+}
+
+#endif // BENCHMARKRUNNER_H
@@ -0,0 +1,33 @@
+#ifndef BENCHMARKSESSION_H
+#define BENCHMARKSESSION_H
+
+#include "../xpiks-tests-core/Mocks/commandmanagermock.h"
+#include "../xpiks-tests-core/Mocks/artitemsmodelmock.h"
+#include "../../xpiks-qt/Models/artworksrepository.h"
+#include "../../xpiks-qt/Models/filteredartitemsproxymodel.h"
+#include "../../xpiks-qt/Models/settingsmodel.h"
+#include "sessiongenerator.h"
+
+namespace Benchmarks {
+    // same wiring of models as in core tests
+    struct BenchmarkSession {
+        BenchmarkSession(SessionGenerator &generator, int artworksCount, int directoriesCount=10) {
+            m_CommandManager.InjectDependency(&m_ArtworksRepository);
+            m_CommandManager.InjectDependency(&m_ArtItemsModel);
+            m_FilteredModel.setSourceModel(&m_ArtItemsModel);
+            m_CommandManager.InjectDependency(&m_FilteredModel);
+            m_SettingsModel.initializeConfigs();
+            m_CommandManager.InjectDependency(&m_SettingsModel);
+
+            generator.generateArtworks(m_CommandManager, artworksCount, directoriesCount);
+        }
+
+        Mocks::CommandManagerMock m_CommandManager;
+        Mocks::ArtItemsModelMock m_ArtItemsModel;
+        Models::ArtworksRepository m_ArtworksRepository;
+        Models::FilteredArtItemsProxyModel m_FilteredModel;
+        Models::SettingsModel m_SettingsModel;
+    };
+}
+
+#endif // BENCHMARKSESSION_H
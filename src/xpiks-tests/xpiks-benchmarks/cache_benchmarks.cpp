@@ -0,0 +1,164 @@
+#include "cache_benchmarks.h"
+#include <QTemporaryDir>
+#include <QImage>
+#include <QColor>
+#include <QDir>
+#include <QDebug>
+#include <vector>
+#include <memory>
+#include "benchmarkrunner.h"
+#include "benchmarksession.h"
+#include "sessiongenerator.h"
+#include "../../xpiks-qt/Helpers/database.h"
+#include "../../xpiks-qt/MetadataIO/metadatacache.h"
+#include "../../xpiks-qt/MetadataIO/cachedartwork.h"
+#include "../../xpiks-qt/Suggestion/searchquery.h"
+#include "../../xpiks-qt/QMLExtensions/imagecachingworker.h"
+#include "../../xpiks-qt/QMLExtensions/imagecacherequest.h"
+
+#define SOURCE_IMAGES_COUNT 20
+#define SOURCE_IMAGE_WIDTH 3000
+#define SOURCE_IMAGE_HEIGHT 2000
+#define SEARCH_MAX_RESULTS 100
+
+namespace Benchmarks {
+    class ImageCachingWorkerForBenchmarks: public QMLExtensions::ImageCachingWorker {
+    public:
+        ImageCachingWorkerForBenchmarks(Helpers::DatabaseManager *dbManager):
+            QMLExtensions::ImageCachingWorker(nullptr, dbManager)
+        {}
+
+    public:
+        void initialize() { initWorker(); }
+        void cacheImage(std::shared_ptr<QMLExtensions::ImageCacheRequest> &request) { processOneItem(request); }
+        void finalize() { workerStopped(); }
+    };
+
+    void runMetadataCacheBenchmarks(BenchmarkRunner &runner, SessionGenerator &generator, Helpers::DatabaseManager &databaseManager) {
+        const int artworksCount = runner.getOptions().m_ArtworksCount;
+        BenchmarkSession session(generator, artworksCount);
+        Models::ArtItemsModel &artItemsModel = session.m_ArtItemsModel;
+
+        MetadataIO::MetadataCache metadataCache(&databaseManager);
+        if (!metadataCache.initialize()) {
+            qWarning() << "Failed to initialize metadata cache";
+            return;
+        }
+
+        runner.run("MetadataCache/save", BenchmarkKind::Macro, artworksCount, [&]() {
+            for (int i = 0; i < artworksCount; i++) {
+                metadataCache.save(artItemsModel.getArtwork(i));
+            }
+
+            metadataCache.sync();
+        });
+
+        std::vector<Models::ArtworkMetadata *> artworks;
+        artworks.reserve(artworksCount);
+        for (int i = 0; i < artworksCount; i++) {
+            artworks.push_back(artItemsModel.getArtwork(i));
+        }
+
+        volatile int foundCount = 0;
+
+        runner.run("MetadataCache/read/oneByOne", BenchmarkKind::Macro, artworksCount, [&]() {
+            int found = 0;
+            for (auto *artwork: artworks) {
+                MetadataIO::CachedArtwork cachedArtwork;
+                if (metadataCache.read(artwork, cachedArtwork)) {
+                    found++;
+                }
+            }
+            foundCount = found;
+        });
+
+        runner.run("MetadataCache/read/batched", BenchmarkKind::Macro, artworksCount, [&]() {
+            QVector<MetadataIO::CachedArtwork> cachedArtworks;
+            QVector<int> foundIndices;
+            foundCount = metadataCache.readMany(artworks, cachedArtworks, foundIndices);
+        });
+
+        Q_UNUSED(foundCount);
+
+        const Suggestion::SearchQuery oneTermQuery(generator.generateSearchTerm(1), 0, SEARCH_MAX_RESULTS);
+        const Suggestion::SearchQuery threeTermsQuery(generator.generateSearchTerm(3), 0, SEARCH_MAX_RESULTS);
+        QVector<MetadataIO::CachedArtwork> results;
+
+        runner.run("MetadataCache/search/oneTerm", BenchmarkKind::Macro, artworksCount, [&]() {
+            metadataCache.search(oneTermQuery, results);
+        }, [&]() { results.clear(); });
+
+        runner.run("MetadataCache/search/threeTerms", BenchmarkKind::Macro, artworksCount, [&]() {
+            metadataCache.search(threeTermsQuery, results);
+        }, [&]() { results.clear(); });
+
+        metadataCache.finalize();
+    }
+
+    bool generateSourceImages(const QString &dirPath, QStringList &imagePaths) {
+        QImage image(SOURCE_IMAGE_WIDTH, SOURCE_IMAGE_HEIGHT, QImage::Format_RGB32);
+
+        for (int i = 0; i < SOURCE_IMAGES_COUNT; i++) {
+            // gradient with some high frequency details for the encoder
+            for (int y = 0; y < SOURCE_IMAGE_HEIGHT; y++) {
+                QRgb *line = reinterpret_cast<QRgb*>(image.scanLine(y));
+                for (int x = 0; x < SOURCE_IMAGE_WIDTH; x++) {
+                    const int noise = ((x * 7 + y * 13 + i) % 17) * 4;
+                    line[x] = qRgb((x + i * 11 + noise) % 256, (y + noise) % 256, (x + y + i * 29) % 256);
+                }
+            }
+
+            const QString path = QDir(dirPath).filePath(QString("source%1.jpg").arg(i));
+            if (!image.save(path, "JPG", 90)) {
+                qWarning() << "Failed to save source image" << path;
+                return false;
+            }
+
+            imagePaths.append(path);
+        }
+
+        return true;
+    }
+
+    void runImageCachingBenchmarks(BenchmarkRunner &runner, Helpers::DatabaseManager &databaseManager) {
+        if (!runner.isSelected("ImageCachingWorker/processOneItem")) { return; }
+
+        QTemporaryDir imagesDir;
+        QStringList imagePaths;
+        if (!imagesDir.isValid() || !generateSourceImages(imagesDir.path(), imagePaths)) { return; }
+
+        ImageCachingWorkerForBenchmarks cachingWorker(&databaseManager);
+        cachingWorker.initialize();
+
+        std::vector<std::shared_ptr<QMLExtensions::ImageCacheRequest> > requests;
+        const QSize thumbnailSize(DEFAULT_THUMB_WIDTH, DEFAULT_THUMB_HEIGHT);
+        const bool recache = true;
+        for (auto &path: imagePaths) {
+            requests.emplace_back(new QMLExtensions::ImageCacheRequest(path, thumbnailSize, recache));
+        }
+
+        runner.run("ImageCachingWorker/processOneItem", BenchmarkKind::Macro, (qint64)requests.size(), [&]() {
+            for (auto &request: requests) {
+                cachingWorker.cacheImage(request);
+            }
+        });
+
+        cachingWorker.finalize();
+    }
+
+    void runCacheBenchmarks(BenchmarkRunner &runner, SessionGenerator &generator) {
+        QTemporaryDir dbDir;
+        if (!dbDir.isValid()) {
+            qWarning() << "Failed to create temporary directory for the database";
+            return;
+        }
+
+        Helpers::DatabaseManager databaseManager;
+        if (!databaseManager.initialize(dbDir.path())) { return; }
+
+        runMetadataCacheBenchmarks(runner, generator, databaseManager);
+        runImageCachingBenchmarks(runner, databaseManager);
+
+        databaseManager.prepareToFinalize();
+    }
+}
@@ -0,0 +1,11 @@
+#ifndef CACHEBENCHMARKS_H
+#define CACHEBENCHMARKS_H
+
+namespace Benchmarks {
+    class BenchmarkRunner;
+    class SessionGenerator;
+
+    void runCacheBenchmarks(BenchmarkRunner &runner, SessionGenerator &generator);
+}
+
+#endif // CACHEBENCHMARKS_H
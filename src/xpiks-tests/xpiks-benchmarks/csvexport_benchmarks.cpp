@@ -0,0 +1,66 @@
+#include "csvexport_benchmarks.h"
+#include <QTemporaryDir>
+#include <QDebug>
+#include <vector>
+#include <memory>
+#include "benchmarkrunner.h"
+#include "benchmarksession.h"
+#include "sessiongenerator.h"
+#include "../../xpiks-qt/MetadataIO/artworkssnapshot.h"
+#include "../../xpiks-qt/MetadataIO/csvexportproperties.h"
+#include "../../xpiks-qt/MetadataIO/csvexportworker.h"
+
+#define CSV_EXPORT_ARTWORKS_COUNT 100000
+
+namespace Benchmarks {
+    void addExportPlan(std::vector<std::shared_ptr<MetadataIO::CsvExportPlan> > &plans, const QString &name,
+                       const std::vector<MetadataIO::CsvExportPropertyType> &properties) {
+        std::shared_ptr<MetadataIO::CsvExportPlan> plan(new MetadataIO::CsvExportPlan(name));
+        for (auto property: properties) {
+            plan->m_PropertiesToExport.emplace_back(property);
+        }
+
+        plan->m_IsSelected = true;
+        plans.push_back(plan);
+    }
+
+    void runCsvExportBenchmarks(BenchmarkRunner &runner, SessionGenerator &generator) {
+        if (!runner.isSelected("CsvExportWorker/onePlan") &&
+                !runner.isSelected("CsvExportWorker/fivePlans")) { return; }
+
+        QTemporaryDir exportDir;
+        if (!exportDir.isValid()) {
+            qWarning() << "Failed to create temporary directory for the export";
+            return;
+        }
+
+        BenchmarkSession session(generator, CSV_EXPORT_ARTWORKS_COUNT);
+        Models::ArtItemsModel &artItemsModel = session.m_ArtItemsModel;
+
+        MetadataIO::ArtworksSnapshot snapshot;
+        snapshot.reserve(CSV_EXPORT_ARTWORKS_COUNT);
+        for (int i = 0; i < CSV_EXPORT_ARTWORKS_COUNT; i++) {
+            snapshot.append(artItemsModel.getArtwork(i));
+        }
+
+        using namespace MetadataIO;
+        std::vector<std::shared_ptr<CsvExportPlan> > onePlan, fivePlans;
+        addExportPlan(onePlan, "agency1", {Filename, Title, Description, Keywords});
+
+        addExportPlan(fivePlans, "agency1", {Filename, Title, Description, Keywords});
+        addExportPlan(fivePlans, "agency2", {Filename, Description, Keywords, Category1, Category2});
+        addExportPlan(fivePlans, "agency3", {Filename, Keywords, Empty, Title});
+        addExportPlan(fivePlans, "agency4", {Title, Keywords, Filename});
+        addExportPlan(fivePlans, "agency5", {Filename, Title, Keywords, Empty, Empty});
+
+        runner.run("CsvExportWorker/onePlan", BenchmarkKind::Macro, CSV_EXPORT_ARTWORKS_COUNT, [&]() {
+            CsvExportWorker exportWorker(onePlan, snapshot, exportDir.path());
+            exportWorker.process();
+        });
+
+        runner.run("CsvExportWorker/fivePlans", BenchmarkKind::Macro, CSV_EXPORT_ARTWORKS_COUNT, [&]() {
+            CsvExportWorker exportWorker(fivePlans, snapshot, exportDir.path());
+            exportWorker.process();
+        });
+    }
+}
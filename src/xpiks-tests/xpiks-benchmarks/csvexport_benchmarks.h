@@ -0,0 +1,11 @@
+#ifndef CSVEXPORTBENCHMARKS_H
+#define CSVEXPORTBENCHMARKS_H
+
+namespace Benchmarks {
+    class BenchmarkRunner;
+    class SessionGenerator;
+
+    void runCsvExportBenchmarks(BenchmarkRunner &runner, SessionGenerator &generator);
+}
+
+#endif // CSVEXPORTBENCHMARKS_H
@@ -0,0 +1,44 @@
+#include "filtering_benchmarks.h"
+#include "benchmarkrunner.h"
+#include "benchmarksession.h"
+#include "sessiongenerator.h"
+
+namespace Benchmarks {
+    void runFilteringBenchmarks(BenchmarkRunner &runner, SessionGenerator &generator) {
+        const int artworksCount = runner.getOptions().m_ArtworksCount;
+        BenchmarkSession session(generator, artworksCount);
+        Models::FilteredArtItemsProxyModel &filteredModel = session.m_FilteredModel;
+
+        const QString oneTerm = generator.generateSearchTerm(1);
+        const QString threeTerms = generator.generateSearchTerm(3);
+
+        session.m_SettingsModel.setSearchUsingAnd(false);
+
+        runner.run("FilteredArtItemsProxyModel/filter/oneTerm", BenchmarkKind::Macro, artworksCount, [&]() {
+            filteredModel.setSearchTerm(oneTerm);
+        });
+
+        runner.run("FilteredArtItemsProxyModel/filter/anyOfThreeTerms", BenchmarkKind::Macro, artworksCount, [&]() {
+            filteredModel.setSearchTerm(threeTerms);
+        });
+
+        session.m_SettingsModel.setSearchUsingAnd(true);
+
+        runner.run("FilteredArtItemsProxyModel/filter/allOfThreeTerms", BenchmarkKind::Macro, artworksCount, [&]() {
+            filteredModel.setSearchTerm(threeTerms);
+        });
+
+        filteredModel.setSearchTerm(QString());
+
+        bool isSorted = false;
+        runner.run("FilteredArtItemsProxyModel/sort", BenchmarkKind::Macro, artworksCount, [&]() {
+            filteredModel.toggleSorted();
+            isSorted = true;
+        }, [&]() {
+            if (isSorted) {
+                filteredModel.toggleSorted();
+                isSorted = false;
+            }
+        });
+    }
+}
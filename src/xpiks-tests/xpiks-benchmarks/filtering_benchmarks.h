@@ -0,0 +1,11 @@
+#ifndef FILTERINGBENCHMARKS_H
+#define FILTERINGBENCHMARKS_H
+
+namespace Benchmarks {
+    class BenchmarkRunner;
+    class SessionGenerator;
+
+    void runFilteringBenchmarks(BenchmarkRunner &runner, SessionGenerator &generator);
+}
+
+#endif // FILTERINGBENCHMARKS_H
@@ -0,0 +1,235 @@
+#include "keywords_benchmarks.h"
+#include <vector>
+#include <memory>
+#include "benchmarkrunner.h"
+#include "benchmarksession.h"
+#include "sessiongenerator.h"
+#include "../../xpiks-qt/Helpers/filterhelpers.h"
+#include "../../xpiks-qt/Helpers/stringhelper.h"
+#include "../../xpiks-qt/Common/basickeywordsmodelimpl.h"
+#include "../../xpiks-qt/Common/hold.h"
+#include "../../xpiks-qt/AutoComplete/keywordsfrequencytrie.h"
+
+#define KEYWORDS_LISTS_COUNT 1000
+#define LEVENSTEIN_PAIRS_COUNT 20000
+#define LEVENSTEIN_LONG_PAIRS_COUNT 2000
+#define SYNONYMS_MAX_DISTANCE 3
+#define AUTOCOMPLETE_SIMILARITY_THRESHOLD 70
+#define TRIE_KEYWORDS_LISTS_COUNT 100000
+#define TRIE_PHRASES_PER_LIST 3
+#define TRIE_PROMPTS_COUNT 10000
+#define TRIE_COMPLETIONS_COUNT 8
+
+namespace Benchmarks {
+    void runSearchMatchBenchmarks(BenchmarkRunner &runner, SessionGenerator &generator) {
+        const int artworksCount = runner.getOptions().m_ArtworksCount;
+        BenchmarkSession session(generator, artworksCount);
+        Models::ArtItemsModel &artItemsModel = session.m_ArtItemsModel;
+
+        const QString oneTerm = generator.generateSearchTerm(1);
+        const QString threeTerms = generator.generateSearchTerm(3);
+        volatile int matchesCount = 0;
+
+        auto searchAll = [&](const QString &searchTerm, Common::SearchFlags flags) {
+            int matches = 0;
+            for (int i = 0; i < artworksCount; i++) {
+                if (Helpers::hasSearchMatch(searchTerm, artItemsModel.getArtwork(i), flags)) {
+                    matches++;
+                }
+            }
+            matchesCount = matches;
+        };
+
+        runner.run("hasSearchMatch/oneTerm", BenchmarkKind::Micro, artworksCount, [&]() {
+            searchAll(oneTerm, Common::SearchFlags::AnyTermsEverything);
+        });
+
+        runner.run("hasSearchMatch/anyOfThreeTerms", BenchmarkKind::Micro, artworksCount, [&]() {
+            searchAll(threeTerms, Common::SearchFlags::AnyTermsEverything);
+        });
+
+        runner.run("hasSearchMatch/allOfThreeTerms", BenchmarkKind::Micro, artworksCount, [&]() {
+            searchAll(threeTerms, Common::SearchFlags::AllTermsEverything);
+        });
+
+        runner.run("hasSearchMatch/exactKeywords", BenchmarkKind::Micro, artworksCount, [&]() {
+            searchAll(threeTerms, Common::SearchFlags::ExactKeywords);
+        });
+
+        Q_UNUSED(matchesCount);
+    }
+
+    void runAppendKeywordsBenchmarks(BenchmarkRunner &runner, SessionGenerator &generator) {
+        std::vector<QStringList> keywordsLists;
+        keywordsLists.reserve(KEYWORDS_LISTS_COUNT);
+        qint64 keywordsCount = 0;
+
+        for (int i = 0; i < KEYWORDS_LISTS_COUNT; i++) {
+            keywordsLists.emplace_back(generator.generateKeywords());
+            keywordsCount += keywordsLists.back().size();
+        }
+
+        runner.run("appendKeywords/fresh", BenchmarkKind::Micro, keywordsCount, [&]() {
+            for (auto &keywords: keywordsLists) {
+                Common::Hold hold;
+                Common::BasicKeywordsModelImpl keywordsModel(hold);
+                keywordsModel.appendKeywords(keywords);
+            }
+        });
+
+        runner.run("appendKeywords/duplicates", BenchmarkKind::Micro, keywordsCount, [&]() {
+            for (auto &keywords: keywordsLists) {
+                Common::Hold hold;
+                Common::BasicKeywordsModelImpl keywordsModel(hold);
+                keywordsModel.appendKeywords(keywords);
+                // second append only hits the duplicates checks
+                keywordsModel.appendKeywords(keywords);
+            }
+        });
+    }
+
+    void runLevensteinBenchmarks(BenchmarkRunner &runner, SessionGenerator &generator) {
+        std::vector<std::pair<QString, QString> > wordPairs, phrasePairs, longPairs;
+        wordPairs.reserve(LEVENSTEIN_PAIRS_COUNT);
+        phrasePairs.reserve(LEVENSTEIN_PAIRS_COUNT);
+        longPairs.reserve(LEVENSTEIN_LONG_PAIRS_COUNT);
+
+        for (int i = 0; i < LEVENSTEIN_PAIRS_COUNT; i++) {
+            wordPairs.emplace_back(generator.generateWord(), generator.generateWord());
+            phrasePairs.emplace_back(generator.generateSearchTerm(3), generator.generateSearchTerm(3));
+        }
+
+        // longer than 64 characters so the non bit-parallel path is measured too
+        for (int i = 0; i < LEVENSTEIN_LONG_PAIRS_COUNT; i++) {
+            longPairs.emplace_back(generator.generateSearchTerm(12), generator.generateSearchTerm(12));
+        }
+
+        volatile unsigned int distancesSum = 0;
+
+        runner.run("levensteinDistance/words", BenchmarkKind::Micro, LEVENSTEIN_PAIRS_COUNT, [&]() {
+            unsigned int sum = 0;
+            for (auto &pair: wordPairs) {
+                sum += Helpers::levensteinDistance(pair.first, pair.second);
+            }
+            distancesSum = sum;
+        });
+
+        runner.run("levensteinDistance/phrases", BenchmarkKind::Micro, LEVENSTEIN_PAIRS_COUNT, [&]() {
+            unsigned int sum = 0;
+            for (auto &pair: phrasePairs) {
+                sum += Helpers::levensteinDistance(pair.first, pair.second);
+            }
+            distancesSum = sum;
+        });
+
+        runner.run("levensteinDistance/long", BenchmarkKind::Micro, LEVENSTEIN_LONG_PAIRS_COUNT, [&]() {
+            unsigned int sum = 0;
+            for (auto &pair: longPairs) {
+                sum += Helpers::levensteinDistance(pair.first, pair.second);
+            }
+            distancesSum = sum;
+        });
+
+        volatile int similarCount = 0;
+
+        runner.run("isLevensteinDistanceWithin/words", BenchmarkKind::Micro, LEVENSTEIN_PAIRS_COUNT, [&]() {
+            int similar = 0;
+            for (auto &pair: wordPairs) {
+                if (Helpers::isLevensteinDistanceWithin(pair.first, pair.second, SYNONYMS_MAX_DISTANCE, Qt::CaseInsensitive)) {
+                    similar++;
+                }
+            }
+            similarCount = similar;
+        });
+
+        runner.run("levensteinPercentage/words", BenchmarkKind::Micro, LEVENSTEIN_PAIRS_COUNT, [&]() {
+            int similar = 0;
+            for (auto &pair: wordPairs) {
+                if (Helpers::levensteinPercentage(pair.first, pair.second) >= AUTOCOMPLETE_SIMILARITY_THRESHOLD) {
+                    similar++;
+                }
+            }
+            similarCount = similar;
+        });
+
+        runner.run("hasLevensteinPercentage/words", BenchmarkKind::Micro, LEVENSTEIN_PAIRS_COUNT, [&]() {
+            int similar = 0;
+            for (auto &pair: wordPairs) {
+                if (Helpers::hasLevensteinPercentage(pair.first, pair.second, AUTOCOMPLETE_SIMILARITY_THRESHOLD)) {
+                    similar++;
+                }
+            }
+            similarCount = similar;
+        });
+
+        Q_UNUSED(distancesSum);
+        Q_UNUSED(similarCount);
+    }
+
+    void runKeywordsTrieBenchmarks(BenchmarkRunner &runner, SessionGenerator &generator) {
+        if (!runner.isSelected("KeywordsFrequencyTrie/build") &&
+                !runner.isSelected("KeywordsFrequencyTrie/prompt/oneLetter") &&
+                !runner.isSelected("KeywordsFrequencyTrie/prompt/threeLetters")) { return; }
+
+        // two-word phrases give hundreds of thousands of distinct keywords
+        std::vector<QStringList> keywordsLists;
+        keywordsLists.reserve(TRIE_KEYWORDS_LISTS_COUNT);
+        for (int i = 0; i < TRIE_KEYWORDS_LISTS_COUNT; i++) {
+            QStringList keywords = generator.generateKeywords();
+            for (int j = 0; j < TRIE_PHRASES_PER_LIST; j++) {
+                keywords.append(generator.generateSearchTerm(2));
+            }
+
+            keywordsLists.emplace_back(keywords);
+        }
+
+        AutoComplete::KeywordsFrequencyTrie trie;
+
+        runner.run("KeywordsFrequencyTrie/build", BenchmarkKind::Macro, TRIE_KEYWORDS_LISTS_COUNT, [&]() {
+            for (auto &keywords: keywordsLists) {
+                trie.accountKeywords(keywords, +1);
+            }
+        }, [&]() { trie.clear(); });
+
+        if (trie.getKeywordsCount() == 0) {
+            for (auto &keywords: keywordsLists) { trie.accountKeywords(keywords, +1); }
+        }
+
+        QStringList oneLetterPrefixes, threeLettersPrefixes;
+        for (int i = 0; i < TRIE_PROMPTS_COUNT; i++) {
+            const QString word = generator.generateWord();
+            oneLetterPrefixes.append(word.left(1));
+            threeLettersPrefixes.append(word.left(3));
+        }
+
+        volatile int completionsCount = 0;
+        std::vector<AutoComplete::CompletionResult> completions;
+        completions.reserve(TRIE_COMPLETIONS_COUNT);
+
+        auto promptAll = [&](const QStringList &prefixes) {
+            int count = 0;
+            for (auto &prefix: prefixes) {
+                completions.clear();
+                count += trie.prompt(prefix, TRIE_COMPLETIONS_COUNT, completions);
+            }
+            completionsCount = count;
+        };
+
+        runner.run("KeywordsFrequencyTrie/prompt/oneLetter", BenchmarkKind::Micro, TRIE_PROMPTS_COUNT, [&]() {
+            promptAll(oneLetterPrefixes);
+        });
+
+        runner.run("KeywordsFrequencyTrie/prompt/threeLetters", BenchmarkKind::Micro, TRIE_PROMPTS_COUNT, [&]() {
+            promptAll(threeLettersPrefixes);
+        });
+
+        Q_UNUSED(completionsCount);
+    }
+
+    void runKeywordsBenchmarks(BenchmarkRunner &runner, SessionGenerator &generator) {
+        runSearchMatchBenchmarks(runner, generator);
+        runAppendKeywordsBenchmarks(runner, generator);
+        runLevensteinBenchmarks(runner, generator);
+        runKeywordsTrieBenchmarks(runner, generator);
+    }
+}
@@ -0,0 +1,11 @@
+#ifndef KEYWORDSBENCHMARKS_H
+#define KEYWORDSBENCHMARKS_H
+
+namespace Benchmarks {
+    class BenchmarkRunner;
+    class SessionGenerator;
+
+    void runKeywordsBenchmarks(BenchmarkRunner &runner, SessionGenerator &generator);
+}
+
+#endif // KEYWORDSBENCHMARKS_H
@@ -0,0 +1,79 @@
+#include <iostream>
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QStandardPaths>
+#include <QJsonDocument>
+#include "benchmarkrunner.h"
+#include "sessiongenerator.h"
+#include "keywords_benchmarks.h"
+#include "filtering_benchmarks.h"
+#include "cache_benchmarks.h"
+#include "csvexport_benchmarks.h"
+#include "../../xpiks-qt/Common/defines.h"
+
+#define VOCABULARY_SIZE 20000
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("xpiks-benchmarks");
+    // caches and databases should not touch real user data
+    QStandardPaths::setTestModeEnabled(true);
+    // logging is not what is benchmarked
+    Common::minimumLogSeverity().store(2);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Benchmarks for Xpiks hot paths");
+    parser.addHelpOption();
+    QCommandLineOption artworksOption(QStringList() << "n" << "artworks", "Count of artworks in generated session.", "count");
+    parser.addOption(artworksOption);
+    QCommandLineOption iterationsOption(QStringList() << "i" << "iterations", "Measured iterations of each benchmark.", "count");
+    parser.addOption(iterationsOption);
+    QCommandLineOption seedOption(QStringList() << "seed", "Seed of the session generator.", "seed");
+    parser.addOption(seedOption);
+    QCommandLineOption filterOption(QStringList() << "f" << "filter", "Run only benchmarks matching wildcard <pattern>.", "pattern");
+    parser.addOption(filterOption);
+    QCommandLineOption outputOption(QStringList() << "o" << "output", "Write JSON results to <file> instead of stdout.", "file");
+    parser.addOption(outputOption);
+    parser.process(app);
+
+    Benchmarks::BenchmarkOptions options;
+    if (parser.isSet(artworksOption)) { options.m_ArtworksCount = qMax(1, parser.value(artworksOption).toInt()); }
+    if (parser.isSet(iterationsOption)) { options.m_Iterations = qMax(1, parser.value(iterationsOption).toInt()); }
+    if (parser.isSet(seedOption)) { options.m_Seed = parser.value(seedOption).toUInt(); }
+    options.m_Filter = parser.value(filterOption);
+
+    Benchmarks::BenchmarkRunner runner(options);
+    // same seed for every suite so that results do not depend on selected benchmarks
+    {
+        Benchmarks::SessionGenerator generator(options.m_Seed, VOCABULARY_SIZE);
+        Benchmarks::runKeywordsBenchmarks(runner, generator);
+    }
+
+    {
+        Benchmarks::SessionGenerator generator(options.m_Seed, VOCABULARY_SIZE);
+        Benchmarks::runFilteringBenchmarks(runner, generator);
+    }
+
+    {
+        Benchmarks::SessionGenerator generator(options.m_Seed, VOCABULARY_SIZE);
+        Benchmarks::runCacheBenchmarks(runner, generator);
+    }
+
+    {
+        Benchmarks::SessionGenerator generator(options.m_Seed, VOCABULARY_SIZE);
+        Benchmarks::runCsvExportBenchmarks(runner, generator);
+    }
+
+    runner.printSummary();
+
+    int result = 0;
+    const QString outputPath = parser.value(outputOption);
+    if (!outputPath.isEmpty()) {
+        if (!runner.saveJson(outputPath)) { result = 1; }
+    } else {
+        QJsonDocument document(runner.toJson());
+        std::cout << document.toJson(QJsonDocument::Indented).toStdString() << std::endl;
+    }
+
+    return result;
+}
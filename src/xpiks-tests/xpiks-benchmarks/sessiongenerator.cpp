@@ -0,0 +1,154 @@
+#include "sessiongenerator.h"
+#include <algorithm>
+#include <cmath>
+#include <QSet>
+#include "../xpiks-tests-core/Mocks/commandmanagermock.h"
+#include "../xpiks-tests-core/Mocks/artitemsmodelmock.h"
+#include "../xpiks-tests-core/Mocks/artworkmetadatamock.h"
+#include "../../xpiks-qt/Models/artworksrepository.h"
+
+// exponent of the Zipf distribution of keywords usage
+#define ZIPF_EXPONENT 1.07
+#define MIN_KEYWORDS_COUNT 15
+#define MAX_KEYWORDS_COUNT 50
+
+namespace Benchmarks {
+    const char *syllables[] = {
+        "ba", "be", "bi", "bo", "ca", "ce", "co", "da", "de", "di", "do", "fa", "fe", "fi",
+        "ga", "ge", "go", "ha", "he", "hi", "ka", "ke", "ko", "la", "le", "li", "lo", "ma",
+        "me", "mi", "mo", "na", "ne", "ni", "no", "pa", "pe", "pi", "po", "ra", "re", "ri",
+        "ro", "sa", "se", "si", "so", "ta", "te", "ti", "to", "va", "ve", "vi", "za", "zo",
+        "ar", "en", "in", "or", "ul", "st", "th", "sh", "ck", "ng"
+    };
+
+    SessionGenerator::SessionGenerator(unsigned int seed, int vocabularySize):
+        m_Generator(seed)
+    {
+        Q_ASSERT(vocabularySize > 0);
+        generateVocabulary(vocabularySize);
+    }
+
+    QString SessionGenerator::generateWord() {
+        std::uniform_real_distribution<double> distribution(0.0, m_CumulativeWeights.back());
+        const double value = distribution(m_Generator);
+
+        auto it = std::upper_bound(m_CumulativeWeights.begin(), m_CumulativeWeights.end(), value);
+        size_t index = std::distance(m_CumulativeWeights.begin(), it);
+        if (index >= m_CumulativeWeights.size()) { index = m_CumulativeWeights.size() - 1; }
+
+        return m_Vocabulary.at((int)index);
+    }
+
+    QStringList SessionGenerator::generateKeywords() {
+        return generateKeywords(nextInt(MIN_KEYWORDS_COUNT, MAX_KEYWORDS_COUNT));
+    }
+
+    QStringList SessionGenerator::generateKeywords(int count) {
+        QStringList keywords;
+        keywords.reserve(count);
+        QSet<QString> added;
+
+        // frequent words would collide often so limit the attempts
+        int attempts = count * 4;
+        while ((keywords.size() < count) && (attempts > 0)) {
+            QString word = generateWord();
+
+            // every fifth keyword is a two-words phrase
+            if (nextInt(0, 4) == 0) {
+                word.append(QChar::Space);
+                word.append(generateWord());
+            }
+
+            if (!added.contains(word)) {
+                added.insert(word);
+                keywords.append(word);
+            }
+
+            attempts--;
+        }
+
+        return keywords;
+    }
+
+    QString SessionGenerator::generateTitle() {
+        return generateSentence(3, 10);
+    }
+
+    QString SessionGenerator::generateDescription() {
+        return generateSentence(8, 25);
+    }
+
+    QString SessionGenerator::generateSearchTerm(int wordsCount) {
+        QStringList words;
+        for (int i = 0; i < wordsCount; i++) {
+            words.append(generateWord());
+        }
+
+        return words.join(QChar::Space);
+    }
+
+    void SessionGenerator::generateArtworks(Mocks::CommandManagerMock &commandManager, int count, int directoriesCount) {
+        Q_ASSERT(directoriesCount > 0);
+        Models::ArtworksRepository *artworksRepository = commandManager.getArtworksRepository();
+        Models::ArtItemsModel *artItemsModel = commandManager.getArtItemsModel();
+
+        for (int i = 0; i < count; i++) {
+            QString filename = QString(ARTWORK_PATH).arg(i % directoriesCount).arg(i);
+            qint64 directoryID;
+
+            if (!artworksRepository->accountFile(filename, directoryID)) {
+                Q_ASSERT(false);
+                continue;
+            }
+
+            Models::ArtworkMetadata *artwork = artItemsModel->createArtwork(filename, directoryID);
+            Mocks::ArtworkMetadataMock *mock = dynamic_cast<Mocks::ArtworkMetadataMock*>(artwork);
+            Q_ASSERT(mock != nullptr);
+            mock->set(generateTitle(), generateDescription(), generateKeywords());
+
+            commandManager.connectArtworkSignals(artwork);
+            artItemsModel->appendArtwork(artwork);
+        }
+    }
+
+    QString SessionGenerator::generateSentence(int minWords, int maxWords) {
+        const int wordsCount = nextInt(minWords, maxWords);
+        QString sentence = generateSearchTerm(wordsCount);
+        if (!sentence.isEmpty()) {
+            sentence[0] = sentence[0].toUpper();
+        }
+
+        return sentence;
+    }
+
+    void SessionGenerator::generateVocabulary(int vocabularySize) {
+        const int syllablesCount = sizeof(syllables) / sizeof(syllables[0]);
+        QSet<QString> words;
+        m_Vocabulary.reserve(vocabularySize);
+
+        while (m_Vocabulary.size() < vocabularySize) {
+            QString word;
+            const int wordSyllables = nextInt(2, 4);
+            for (int i = 0; i < wordSyllables; i++) {
+                word.append(QString::fromLatin1(syllables[nextInt(0, syllablesCount - 1)]));
+            }
+
+            if (!words.contains(word)) {
+                words.insert(word);
+                m_Vocabulary.append(word);
+            }
+        }
+
+        m_CumulativeWeights.resize(vocabularySize);
+        double sum = 0.0;
+        for (int i = 0; i < vocabularySize; i++) {
+            sum += 1.0 / std::pow((double)(i + 1), ZIPF_EXPONENT);
+            m_CumulativeWeights[i] = sum;
+        }
+    }
+
+    int SessionGenerator::nextInt(int min, int max) {
+        std::uniform_int_distribution<int> distribution(min, max);
+        return distribution(m_Generator);
+    }
+}
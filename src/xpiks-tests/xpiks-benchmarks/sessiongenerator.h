@@ -0,0 +1,45 @@
+#ifndef SESSIONGENERATOR_H
+#define SESSIONGENERATOR_H
+
+#include <QString>
+#include <QStringList>
+#include <vector>
+#include <random>
+
+namespace Mocks {
+    class CommandManagerMock;
+}
+
+namespace Benchmarks {
+    // generates reproducible sessions where keyword frequencies
+    // follow Zipf's law like in real stock photography sessions
+    class SessionGenerator
+    {
+    public:
+        SessionGenerator(unsigned int seed, int vocabularySize);
+
+    public:
+        const QStringList &getVocabulary() const { return m_Vocabulary; }
+
+    public:
+        QString generateWord();
+        QStringList generateKeywords();
+        QStringList generateKeywords(int count);
+        QString generateTitle();
+        QString generateDescription();
+        QString generateSearchTerm(int wordsCount);
+        void generateArtworks(Mocks::CommandManagerMock &commandManager, int count, int directoriesCount);
+
+    private:
+        QString generateSentence(int minWords, int maxWords);
+        void generateVocabulary(int vocabularySize);
+        int nextInt(int min, int max);
+
+    private:
+        std::mt19937 m_Generator;
+        QStringList m_Vocabulary;
+        std::vector<double> m_CumulativeWeights;
+    };
+}
+
+#endif // SESSIONGENERATOR_H
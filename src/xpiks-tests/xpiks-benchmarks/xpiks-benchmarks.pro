@@ -0,0 +1,330 @@
+#-------------------------------------------------
+#
+# Benchmarks of core hot paths, reuses mocks of core tests
+#
+#-------------------------------------------------
+
+QMAKE_MAC_SDK = macosx10.11
+
+QT       += core gui qml quick concurrent
+
+TARGET = xpiks-benchmarks
+CONFIG   += console
+CONFIG   -= app_bundle
+CONFIG   += c++11
+
+win32:QT += winextras
+
+INCLUDEPATH += ../../../vendors/tiny-aes
+win32:INCLUDEPATH += ../../xpiks-qt/Encryption
+INCLUDEPATH += ../../../vendors/hunspell-repo/src
+INCLUDEPATH += ../../../vendors/ssdll/src/ssdll
+INCLUDEPATH += ../../../vendors/libthmbnlr
+INCLUDEPATH += ../xpiks-tests-core
+
+DEFINES += HUNSPELL_STATIC
+DEFINES += CORE_TESTS
+DEFINES += DEBUG_UTILITY
+# logging overhead is not what is measured
+DEFINES += QT_NO_DEBUG_OUTPUT
+
+DEFINES += QT_NO_CAST_TO_ASCII \
+           QT_RESTRICTED_CAST_FROM_ASCII \
+           QT_NO_CAST_FROM_BYTEARRAY
+
+CONFIG(debug, debug|release)  {
+    LIBS += -L"$$PWD/../../../libs/debug"
+} else {
+    LIBS += -L"$$PWD/../../../libs/release"
+}
+
+LIBS += -lhunspell
+LIBS += -lssdll
+
+macx {
+    #INCLUDEPATH += "../quazip"
+    #INCLUDEPATH += "../../libcurl/include"
+}
+
+win32 {
+    INCLUDEPATH += "../../../vendors/zlib-1.2.8"
+    #INCLUDEPATH += "../quazip"
+    #INCLUDEPATH += "../libcurl/include"
+    #LIBS -= -lcurl
+    #LIBS += -llibcurl_debug
+}
+
+travis-ci {
+    message("for Travis CI")
+    DEFINES += TRAVIS_CI
+
+    # gcov
+    QMAKE_CXXFLAGS += -fprofile-arcs -ftest-coverage
+    LIBS += -lgcov
+}
+
+appveyor {
+    DEFINES += APPVEYOR
+}
+
+linux-g++-64 {
+    target.path=/usr/bin/
+    QML_IMPORT_PATH += /usr/lib/x86_64-linux-gnu/qt5/imports/
+    UNAME = $$system(cat /proc/version)
+
+    #contains(UNAME, Debian): {
+    #    message("on Debian Linux")
+    #    LIBS += -L/lib/x86_64-linux-gnu/
+    #    LIBS -= -lquazip # temporary static link
+    #    LIBS += /usr/lib/x86_64-linux-gnu/libquazip-qt5.a
+    #}
+    #contains(UNAME, SUSE): {
+    #    message("on SUSE Linux")
+    #    LIBS += -L/usr/lib64/
+    #    LIBS += /usr/lib64/libcurl.so.4
+    #}
+}
+
+TEMPLATE = app
+
+SOURCES += main.cpp \
+    benchmarkrunner.cpp \
+    sessiongenerator.cpp \
+    keywords_benchmarks.cpp \
+    filtering_benchmarks.cpp \
+    cache_benchmarks.cpp \
+    csvexport_benchmarks.cpp \
+    ../../../vendors/tiny-aes/aes.cpp \
+    ../../xpiks-qt/Helpers/indiceshelper.cpp \
+    ../../xpiks-qt/Commands/commandmanager.cpp \
+    ../../xpiks-qt/Commands/findandreplacecommand.cpp \
+    ../../xpiks-qt/Models/artworkmetadata.cpp \
+    ../../xpiks-qt/Models/artworksrepository.cpp \
+    ../../xpiks-qt/Models/artitemsmodel.cpp \
+    ../../xpiks-qt/Models/filteredartitemsproxymodel.cpp \
+    ../../xpiks-qt/Commands/addartworkscommand.cpp \
+    ../../xpiks-qt/Models/combinedartworksmodel.cpp \
+    ../../xpiks-qt/UndoRedo/addartworksitem.cpp \
+    ../../xpiks-qt/UndoRedo/undoredomanager.cpp \
+    ../../xpiks-qt/Encryption/secretsmanager.cpp \
+    ../../xpiks-qt/Commands/combinededitcommand.cpp \
+    ../../xpiks-qt/Commands/pastekeywordscommand.cpp \
+    ../../xpiks-qt/Commands/removeartworkscommand.cpp \
+    ../../xpiks-qt/UndoRedo/artworkmetadatabackup.cpp \
+    ../../xpiks-qt/UndoRedo/modifyartworkshistoryitem.cpp \
+    ../../xpiks-qt/UndoRedo/removeartworksitem.cpp \
+    ../../xpiks-qt/Encryption/aes-qt.cpp \
+    ../../xpiks-qt/Helpers/filehelpers.cpp \
+    ../../xpiks-qt/Helpers/helpersqmlwrapper.cpp \
+    ../../xpiks-qt/Models/recentitemsmodel.cpp \
+    ../../xpiks-qt/Models/recentdirectoriesmodel.cpp \
+    ../../xpiks-qt/Models/recentfilesmodel.cpp \
+    ../../xpiks-qt/Helpers/keywordshelpers.cpp \
+    ../../xpiks-qt/SpellCheck/spellcheckerservice.cpp \
+    ../../xpiks-qt/SpellCheck/spellcheckitem.cpp \
+    ../../xpiks-qt/SpellCheck/spellcheckworker.cpp \
+    ../../xpiks-qt/SpellCheck/spellchecksuggestionmodel.cpp \
+    ../../xpiks-qt/SpellCheck/spellcheckiteminfo.cpp \
+    ../../xpiks-qt/SpellCheck/spellsuggestionsitem.cpp \
+    ../../xpiks-qt/Common/basickeywordsmodel.cpp \
+    ../../xpiks-qt/Common/basicmetadatamodel.cpp \
+    ../../xpiks-qt/SpellCheck/spellcheckerrorshighlighter.cpp \
+    ../../xpiks-qt/Helpers/localconfig.cpp \
+    ../../xpiks-qt/Models/proxysettings.cpp \
+    ../../xpiks-qt/Models/uploadinforepository.cpp \
+    ../../xpiks-qt/Models/settingsmodel.cpp \
+    ../../xpiks-qt/Helpers/stringhelper.cpp \
+    ../../xpiks-qt/Helpers/filterhelpers.cpp \
+    ../../xpiks-qt/Models/ziparchiver.cpp \
+    ../../xpiks-qt/Helpers/jsonhelper.cpp \
+    ../../xpiks-qt/AutoComplete/stringsautocompletemodel.cpp \
+    ../../xpiks-qt/Models/imageartwork.cpp \
+    ../../xpiks-qt/Common/flags.cpp \
+    ../../xpiks-qt/Models/findandreplacemodel.cpp \
+    ../../xpiks-qt/Models/artworksviewmodel.cpp \
+    ../../xpiks-qt/Models/deletekeywordsviewmodel.cpp \
+    ../../xpiks-qt/Commands/deletekeywordscommand.cpp \
+    ../../xpiks-qt/Connectivity/uploadwatcher.cpp \
+    ../../xpiks-qt/Helpers/updatehelpers.cpp \
+    ../../xpiks-qt/KeywordsPresets/presetkeywordsmodel.cpp \
+    ../../xpiks-qt/Models/artworkproxybase.cpp \
+    ../../xpiks-qt/Commands/expandpresetcommand.cpp \
+    ../../xpiks-qt/QuickBuffer/currenteditableartwork.cpp \
+    ../../xpiks-qt/QuickBuffer/currenteditableproxyartwork.cpp \
+    ../../xpiks-qt/QuickBuffer/quickbuffer.cpp \
+    ../../xpiks-qt/Models/artworkproxymodel.cpp \
+    ../../xpiks-qt/Models/uimanager.cpp \
+    ../../xpiks-qt/Models/sessionmanager.cpp \
+    ../../xpiks-qt/Warnings/warningsmodel.cpp \
+    ../../xpiks-qt/QMLExtensions/tabsmodel.cpp \
+    ../../xpiks-qt/Helpers/asynccoordinator.cpp \
+    ../../xpiks-qt/Models/videoartwork.cpp \
+    ../../xpiks-qt/Helpers/artworkshelpers.cpp \
+    ../../xpiks-qt/Models/keyvaluelist.cpp \
+    ../../xpiks-qt/MetadataIO/cachedartwork.cpp \
+    ../../xpiks-qt/Maintenance/logscleanupjobitem.cpp \
+    ../../xpiks-qt/MetadataIO/artworkssnapshot.cpp \
+    ../../xpiks-qt/Helpers/threadhelpers.cpp \
+    ../../xpiks-qt/AutoComplete/autocompletemodel.cpp \
+    ../../xpiks-qt/AutoComplete/keywordsautocompletemodel.cpp \
+    ../../xpiks-qt/SpellCheck/duplicatesreviewmodel.cpp \
+    ../../xpiks-qt/KeywordsPresets/presetkeywordsmodelconfig.cpp \
+    ../../xpiks-qt/Common/statefulentity.cpp \
+    ../../xpiks-qt/KeywordsPresets/presetgroupsmodel.cpp \
+    ../../xpiks-qt/UndoRedo/removedirectoryitem.cpp \
+    ../../xpiks-qt/Common/basickeywordsmodelimpl.cpp \
+    ../../xpiks-qt/Commands/maindelegator.cpp \
+    ../../xpiks-qt/Common/baseentity.cpp \
+    ../../xpiks-qt/Helpers/startuptimeline.cpp \
+    ../../xpiks-qt/Helpers/tracing.cpp \
+    ../../xpiks-qt/Helpers/database.cpp \
+    ../../../vendors/sqlite/sqlite3.c \
+    ../../xpiks-qt/MetadataIO/metadatacache.cpp \
+    ../../xpiks-qt/QMLExtensions/imagecachingworker.cpp \
+    ../../xpiks-qt/QMLExtensions/dbimagecacheindex.cpp \
+    ../../xpiks-qt/Helpers/directorywatcher.cpp \
+    ../../xpiks-qt/MetadataIO/keywordscooccurrenceindex.cpp \
+    ../../xpiks-qt/Common/workstealingexecutor.cpp \
+    ../../xpiks-qt/Helpers/metrics.cpp \
+    ../../xpiks-qt/AutoComplete/keywordsfrequencytrie.cpp \
+    ../../xpiks-qt/KeywordsPresets/presetsnameindex.cpp \
+    ../../xpiks-qt/MetadataIO/csvexportproperties.cpp \
+    ../../xpiks-qt/MetadataIO/csvexportworker.cpp
+
+HEADERS += \
+    benchmarkrunner.h \
+    sessiongenerator.h \
+    benchmarksession.h \
+    keywords_benchmarks.h \
+    filtering_benchmarks.h \
+    cache_benchmarks.h \
+    csvexport_benchmarks.h \
+    ../../../vendors/tiny-aes/aes.h \
+    ../../xpiks-qt/Encryption/aes-qt.h \
+    ../../xpiks-qt/Helpers/indiceshelper.h \
+    ../xpiks-tests-core/Mocks/commandmanagermock.h \
+    ../../xpiks-qt/Common/abstractlistmodel.h \
+    ../../xpiks-qt/Commands/commandmanager.h \
+    ../../xpiks-qt/Commands/findandreplacecommand.h \
+    ../../xpiks-qt/Models/artworkmetadata.h \
+    ../../xpiks-qt/Models/artworksrepository.h \
+    ../../xpiks-qt/Models/artitemsmodel.h \
+    ../../xpiks-qt/Models/filteredartitemsproxymodel.h \
+    ../xpiks-tests-core/Mocks/artitemsmodelmock.h \
+    ../../xpiks-qt/Commands/addartworkscommand.h \
+    ../../xpiks-qt/Models/combinedartworksmodel.h \
+    ../../xpiks-qt/UndoRedo/addartworksitem.h \
+    ../../xpiks-qt/UndoRedo/historyitem.h \
+    ../../xpiks-qt/UndoRedo/undoredomanager.h \
+    ../../xpiks-qt/Encryption/secretsmanager.h \
+    ../../xpiks-qt/Commands/combinededitcommand.h \
+    ../../xpiks-qt/Commands/commandbase.h \
+    ../../xpiks-qt/Commands/pastekeywordscommand.h \
+    ../../xpiks-qt/Commands/removeartworkscommand.h \
+    ../../xpiks-qt/UndoRedo/artworkmetadatabackup.h \
+    ../../xpiks-qt/UndoRedo/modifyartworkshistoryitem.h \
+    ../../xpiks-qt/UndoRedo/removeartworksitem.h \
+    ../xpiks-tests-core/Mocks/artworkmetadatamock.h \
+    ../../xpiks-qt/Common/basickeywordsmodel.h \
+    ../../xpiks-qt/Common/basicmetadatamodel.h \
+    ../../xpiks-qt/Helpers/filehelpers.h \
+    ../../xpiks-qt/Helpers/helpersqmlwrapper.h \
+    ../../xpiks-qt/Models/recentitemsmodel.h \
+    ../../xpiks-qt/Models/recentdirectoriesmodel.h \
+    ../../xpiks-qt/Models/recentfilesmodel.h \
+    ../../xpiks-qt/Helpers/keywordshelpers.h \
+    ../../xpiks-qt/Common/flags.h \
+    ../../xpiks-qt/SpellCheck/spellcheckerservice.h \
+    ../../xpiks-qt/SpellCheck/spellcheckitem.h \
+    ../../xpiks-qt/SpellCheck/spellcheckworker.h \
+    ../../xpiks-qt/SpellCheck/spellchecksuggestionmodel.h \
+    ../../xpiks-qt/Connectivity/analyticsuserevent.h \
+    ../../xpiks-qt/SpellCheck/spellcheckiteminfo.h \
+    ../../xpiks-qt/SpellCheck/spellsuggestionsitem.h \
+    ../../xpiks-qt/SpellCheck/spellcheckerrorshighlighter.h \
+    ../../xpiks-qt/Helpers/localconfig.h \
+    ../../xpiks-qt/Models/proxysettings.h \
+    ../../xpiks-qt/Models/uploadinfo.h \
+    ../../xpiks-qt/Models/uploadinforepository.h \
+    ../../xpiks-qt/Models/settingsmodel.h \
+    ../../xpiks-qt/Common/itemprocessingworker.h \
+    ../../xpiks-qt/MetadataIO/artworkssnapshot.h \
+    ../../xpiks-qt/Common/baseentity.h \
+    ../../xpiks-qt/Common/defines.h \
+    ../../xpiks-qt/Common/iartworkssource.h \
+    ../../xpiks-qt/Common/ibasicartwork.h \
+    ../../xpiks-qt/Common/iservicebase.h \
+    ../../xpiks-qt/Common/version.h \
+    ../../xpiks-qt/Commands/icommandbase.h \
+    ../../xpiks-qt/Commands/icommandmanager.h \
+    ../../xpiks-qt/Helpers/filterhelpers.h \
+    ../../xpiks-qt/Connectivity/iftpcoordinator.h \
+    ../../xpiks-qt/Models/ziparchiver.h \
+    ../xpiks-tests-core/Mocks/artworksrepositorymock.h \
+    ../../xpiks-qt/Helpers/jsonhelper.h \
+    ../../xpiks-qt/AutoComplete/stringsautocompletemodel.h \
+    ../../xpiks-qt/Models/imageartwork.h \
+    ../../xpiks-qt/Common/hold.h \
+    ../xpiks-tests-core/Mocks/spellcheckservicemock.h \
+    ../../xpiks-qt/Models/findandreplacemodel.h \
+    ../../xpiks-qt/Models/artworksviewmodel.h \
+    ../../xpiks-qt/Models/deletekeywordsviewmodel.h \
+    ../../xpiks-qt/Commands/deletekeywordscommand.h \
+    ../../xpiks-qt/Common/iflagsprovider.h \
+    ../../xpiks-qt/Connectivity/uploadwatcher.h \
+    ../../xpiks-qt/Helpers/updatehelpers.h \
+    ../../xpiks-qt/KeywordsPresets/presetkeywordsmodel.h \
+    ../../xpiks-qt/Common/imetadataoperator.h \
+    ../../xpiks-qt/Models/artworkproxybase.h \
+    ../../xpiks-qt/Commands/expandpresetcommand.h \
+    ../../xpiks-qt/QuickBuffer/currenteditableartwork.h \
+    ../../xpiks-qt/QuickBuffer/currenteditableproxyartwork.h \
+    ../../xpiks-qt/QuickBuffer/icurrenteditable.h \
+    ../../xpiks-qt/QuickBuffer/quickbuffer.h \
+    ../../xpiks-qt/Models/artworkproxymodel.h \
+    ../../xpiks-qt/Models/uimanager.h \
+    ../../xpiks-qt/Models/sessionmanager.h \
+    ../../xpiks-qt/Warnings/warningsmodel.h \
+    ../../xpiks-qt/KeywordsPresets/ipresetsmanager.h \
+    ../../xpiks-qt/QMLExtensions/tabsmodel.h \
+    ../../xpiks-qt/Models/videoartwork.h \
+    ../../xpiks-qt/Helpers/asynccoordinator.h \
+    ../../xpiks-qt/Helpers/artworkshelpers.h \
+    ../../xpiks-qt/Models/keyvaluelist.h \
+    ../../xpiks-qt/MetadataIO/cachedartwork.h \
+    ../../xpiks-qt/Maintenance/imaintenanceitem.h \
+    ../../xpiks-qt/Maintenance/logscleanupjobitem.h \
+    ../../xpiks-qt/Helpers/threadhelpers.h \
+    ../../xpiks-qt/AutoComplete/autocompletemodel.h \
+    ../../xpiks-qt/AutoComplete/keywordsautocompletemodel.h \
+    ../../xpiks-qt/Common/keyword.h \
+    ../../xpiks-qt/SpellCheck/duplicatesreviewmodel.h \
+    ../../xpiks-qt/KeywordsPresets/presetkeywordsmodelconfig.h \
+    ../../xpiks-qt/Common/statefulentity.h \
+    ../../xpiks-qt/Common/delayedactionentity.h \
+    ../../xpiks-qt/KeywordsPresets/presetgroupsmodel.h \
+    ../../xpiks-qt/UndoRedo/removedirectoryitem.h \
+    ../../xpiks-qt/Common/basickeywordsmodelimpl.h \
+    ../../xpiks-qt/Commands/maindelegator.h \
+    ../../xpiks-qt/KeywordsPresets/groupmodel.h \
+    ../../xpiks-qt/KeywordsPresets/presetmodel.h \
+    ../../xpiks-qt/Helpers/startuptimeline.h \
+    ../../xpiks-qt/Helpers/tracing.h \
+    ../../xpiks-qt/Helpers/database.h \
+    ../../../vendors/sqlite/sqlite3.h \
+    ../../xpiks-qt/MetadataIO/metadatacache.h \
+    ../../xpiks-qt/QMLExtensions/imagecachingworker.h \
+    ../../xpiks-qt/QMLExtensions/dbimagecacheindex.h \
+    ../../xpiks-qt/QMLExtensions/dbcacheindex.h \
+    ../../xpiks-qt/QMLExtensions/imagecacherequest.h \
+    ../../xpiks-qt/Suggestion/searchquery.h \
+    ../../xpiks-qt/Helpers/directorywatcher.h \
+    ../../xpiks-qt/MetadataIO/keywordscooccurrenceindex.h \
+    ../../xpiks-qt/Common/workstealingexecutor.h \
+    ../../xpiks-qt/Common/mpscqueue.h \
+    ../../xpiks-qt/Helpers/metrics.h \
+    ../../xpiks-qt/AutoComplete/keywordsfrequencytrie.h \
+    ../../xpiks-qt/KeywordsPresets/presetsnameindex.h \
+    ../../xpiks-qt/MetadataIO/csvexportproperties.h \
+    ../../xpiks-qt/MetadataIO/csvexportworker.h
+
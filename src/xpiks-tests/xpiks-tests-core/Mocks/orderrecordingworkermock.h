@@ -0,0 +1,41 @@
+#ifndef ORDERRECORDINGWORKERMOCK_H
+#define ORDERRECORDINGWORKERMOCK_H
+
+#include <QSemaphore>
+#include <QAtomicInt>
+#include <vector>
+#include <memory>
+#include "../../xpiks-qt/Common/itemprocessingworker.h"
+
+namespace Mocks {
+    class OrderRecordingWorker: public Common::ItemProcessingWorker<int> {
+    public:
+        // items with same value / coalescingGroup are coalesced if group is positive
+        OrderRecordingWorker(int coalescingGroup = 0):
+            m_QueueIsEmptyCount(0),
+            m_CoalescingGroup(coalescingGroup)
+        {}
+
+    public:
+        std::vector<int> m_ProcessedItems;
+        QSemaphore m_Stopped;
+        QAtomicInt m_QueueIsEmptyCount;
+
+    protected:
+        virtual bool initWorker() override { return true; }
+        virtual void processOneItem(std::shared_ptr<int> &item) override { m_ProcessedItems.push_back(*item); }
+        virtual void onQueueIsEmpty() override { m_QueueIsEmptyCount.ref(); }
+        virtual void workerStopped() override { m_Stopped.release(); }
+        virtual bool tryGetCoalescingKey(const std::shared_ptr<int> &item, coalescing_key_t &key) const override {
+            // negative items are never coalesced
+            if ((m_CoalescingGroup <= 0) || (*item < 0)) { return false; }
+            key = coalescing_key_t(0, *item / m_CoalescingGroup);
+            return true;
+        }
+
+    private:
+        int m_CoalescingGroup;
+    };
+}
+
+#endif // ORDERRECORDINGWORKERMOCK_H
@@ -407,6 +407,48 @@ void ArtworkRepositoryTests::selectFolderTest() {
     QCOMPARE(repository.isDirectorySelected(dirIDs[3]), true);
 }
 
+void ArtworkRepositoryTests::lookupAfterDirectoryRemovalTest() {
+    Mocks::CommandManagerMock commandManagerMock;
+    Models::ArtworksRepository repository;
+    commandManagerMock.InjectDependency(&repository);
+
+#ifdef Q_OS_WIN
+    QString filename1 = "C:/path1/to/some/file";
+    QString filename2 = "C:/path2/to/some/file";
+    QString filename3 = "C:/path3/to/some/file";
+    QString anotherFilename3 = "C:/PATH3/to/some/another";
+#else
+    QString filename1 = "/path1/to/some/file";
+    QString filename2 = "/path2/to/some/file";
+    QString filename3 = "/path3/to/some/file";
+    QString anotherFilename3 = "/PATH3/to/some/another";
+#endif
+
+    std::vector<qint64> dirIDs;
+    foreach (const QString &file, QStringList() << filename1 << filename2 << filename3) {
+        qint64 dirID;
+        repository.accountFile(file, dirID);
+        dirIDs.push_back(dirID);
+    }
+
+    repository.removeItem(0);
+    QCOMPARE(repository.rowCount(), 2);
+
+    QString path;
+    QCOMPARE(repository.tryGetDirectoryPath(dirIDs[0], path), false);
+    QCOMPARE(repository.tryGetDirectoryPath(dirIDs[2], path), true);
+    QCOMPARE(path, repository.getDirectoryPath(1));
+    QCOMPARE(repository.isDirectorySelected(dirIDs[0]), false);
+    QCOMPARE(repository.isDirectorySelected(dirIDs[2]), true);
+
+    // directories are matched case insensitively after indices were shifted
+    qint64 dirID = -1;
+    QCOMPARE(repository.accountFile(anotherFilename3, dirID), true);
+    QCOMPARE(dirID, dirIDs[2]);
+    QCOMPARE(repository.rowCount(), 2);
+    QCOMPARE(repository.getFilesCountForDirectory(1), 2);
+}
+
 void ArtworkRepositoryTests::oneEmptyDirectoryStaysTest() {
     const int count = 1;
     DECLARE_MODELS_AND_GENERATE(count, false);
@@ -22,6 +22,7 @@ private slots:
     void selectFolderTest();
     void oneEmptyDirectoryStaysTest();
     void fewEmptyDirectoriesStayTest();
+    void lookupAfterDirectoryRemovalTest();
     // selection tests
     void allDirsInitiallySelectedTest();
     void unselectOneSelectsOnlyOneTest();
@@ -0,0 +1,132 @@
+#include "itemprocessingworker_tests.h"
+#include <QSemaphore>
+#include <QThread>
+#include <vector>
+#include <memory>
+#include "../../xpiks-qt/Common/mpscqueue.h"
+#include "Mocks/orderrecordingworkermock.h"
+
+#define PRODUCERS_COUNT 4
+#define ITEMS_PER_PRODUCER 10000
+#define ITEMS_COUNT 1000
+#define COALESCING_GROUP 100
+#define WAIT_TIMEOUT 5000
+
+class ProducerThread: public QThread {
+public:
+    ProducerThread(Common::MpscQueue<int> &queue, int producerIndex):
+        m_Queue(queue),
+        m_ProducerIndex(producerIndex)
+    {}
+
+protected:
+    virtual void run() override {
+        for (int i = 0; i < ITEMS_PER_PRODUCER; i++) {
+            m_Queue.push(m_ProducerIndex * ITEMS_PER_PRODUCER + i);
+        }
+    }
+
+private:
+    Common::MpscQueue<int> &m_Queue;
+    int m_ProducerIndex;
+};
+
+bool processAll(Mocks::OrderRecordingWorker &worker) {
+    // everything is submitted before the worker starts so the order is deterministic
+    worker.doWorkOnExecutor(Common::TaskPriority::Normal);
+
+    for (int i = 0; (i < WAIT_TIMEOUT / 10) && worker.hasPendingJobs(); i++) {
+        QTest::qWait(10);
+    }
+
+    worker.stopWorking(false);
+    return worker.m_Stopped.tryAcquire(1, WAIT_TIMEOUT);
+}
+
+void ItemProcessingWorkerTests::mpscQueueKeepsOrderOfProducerTest() {
+    Common::MpscQueue<int> queue;
+    std::vector<std::unique_ptr<ProducerThread> > producers;
+
+    for (int i = 0; i < PRODUCERS_COUNT; i++) {
+        producers.emplace_back(new ProducerThread(queue, i));
+        producers.back()->start();
+    }
+
+    for (auto &producer: producers) {
+        producer->wait();
+    }
+
+    std::vector<int> lastValues(PRODUCERS_COUNT, -1);
+    int value = 0, count = 0;
+    while (queue.tryPop(value)) {
+        const int producerIndex = value / ITEMS_PER_PRODUCER;
+        QVERIFY(value > lastValues[producerIndex]);
+        lastValues[producerIndex] = value;
+        count++;
+    }
+
+    QCOMPARE(count, PRODUCERS_COUNT * ITEMS_PER_PRODUCER);
+}
+
+void ItemProcessingWorkerTests::submitFirstIsProcessedFirstTest() {
+    Mocks::OrderRecordingWorker worker;
+
+    for (int i = 0; i < ITEMS_COUNT; i++) {
+        worker.submitItem(std::shared_ptr<int>(new int(i)));
+    }
+
+    worker.submitFirst(std::shared_ptr<int>(new int(-1)));
+    QVERIFY(processAll(worker));
+
+    QCOMPARE((int)worker.m_ProcessedItems.size(), ITEMS_COUNT + 1);
+    QCOMPARE(worker.m_ProcessedItems.front(), -1);
+    QCOMPARE(worker.m_ProcessedItems.back(), ITEMS_COUNT - 1);
+}
+
+void ItemProcessingWorkerTests::cancelledBatchIsSkippedTest() {
+    Mocks::OrderRecordingWorker worker;
+    std::vector<std::shared_ptr<int> > first, second;
+
+    for (int i = 0; i < ITEMS_COUNT; i++) {
+        (i < ITEMS_COUNT / 2 ? first : second).emplace_back(new int(i));
+    }
+
+    auto firstBatchID = worker.submitItems(first);
+    worker.submitItems(second);
+    worker.cancelBatch(firstBatchID);
+    QVERIFY(processAll(worker));
+
+    QCOMPARE((int)worker.m_ProcessedItems.size(), ITEMS_COUNT / 2);
+    QCOMPARE(worker.m_ProcessedItems.front(), ITEMS_COUNT / 2);
+    QVERIFY(!worker.hasPendingJobs());
+}
+
+void ItemProcessingWorkerTests::newerItemReplacesPendingTest() {
+    Mocks::OrderRecordingWorker worker(COALESCING_GROUP);
+
+    for (int i = 0; i < ITEMS_COUNT; i++) {
+        worker.submitItem(std::shared_ptr<int>(new int(i)));
+    }
+
+    QVERIFY(processAll(worker));
+
+    QCOMPARE((int)worker.m_ProcessedItems.size(), ITEMS_COUNT / COALESCING_GROUP);
+    for (size_t i = 0; i < worker.m_ProcessedItems.size(); i++) {
+        QCOMPARE(worker.m_ProcessedItems[i], (int)(i + 1) * COALESCING_GROUP - 1);
+    }
+}
+
+void ItemProcessingWorkerTests::itemsWithoutKeyAreNotCoalescedTest() {
+    Mocks::OrderRecordingWorker worker(COALESCING_GROUP);
+
+    for (int i = 0; i < ITEMS_COUNT; i++) {
+        worker.submitItem(std::shared_ptr<int>(new int(-i - 1)));
+    }
+
+    worker.submitItem(std::shared_ptr<int>(new int(0)));
+    worker.submitItem(std::shared_ptr<int>(new int(1)));
+    QVERIFY(processAll(worker));
+
+    QCOMPARE((int)worker.m_ProcessedItems.size(), ITEMS_COUNT + 1);
+    QCOMPARE(worker.m_ProcessedItems.back(), 1);
+}
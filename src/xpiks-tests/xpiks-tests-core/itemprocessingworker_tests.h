@@ -0,0 +1,18 @@
+#ifndef ITEMPROCESSINGWORKER_TESTS_H
+#define ITEMPROCESSINGWORKER_TESTS_H
+
+#include <QObject>
+#include <QtTest/QtTest>
+
+class ItemProcessingWorkerTests : public QObject
+{
+    Q_OBJECT
+private slots:
+    void mpscQueueKeepsOrderOfProducerTest();
+    void submitFirstIsProcessedFirstTest();
+    void cancelledBatchIsSkippedTest();
+    void newerItemReplacesPendingTest();
+    void itemsWithoutKeyAreNotCoalescedTest();
+};
+
+#endif // ITEMPROCESSINGWORKER_TESTS_H
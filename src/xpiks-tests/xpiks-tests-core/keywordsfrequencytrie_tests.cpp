@@ -0,0 +1,142 @@
+#include "keywordsfrequencytrie_tests.h"
+#include "../../xpiks-qt/AutoComplete/keywordsfrequencytrie.h"
+#include "../../xpiks-qt/AutoComplete/keywordscompletionengine.h"
+
+QStringList completionsToList(const std::vector<AutoComplete::CompletionResult> &completions) {
+    QStringList result;
+    for (auto &completion: completions) { result.append(completion.m_Completion); }
+    return result;
+}
+
+AutoComplete::CompletionResult scoredCompletion(const QString &completion, int score) {
+    AutoComplete::CompletionResult result(completion);
+    result.m_Score = score;
+    return result;
+}
+
+void KeywordsFrequencyTrieTests::mostFrequentFirstTest() {
+    AutoComplete::KeywordsFrequencyTrie trie;
+    trie.accountKeywords(QStringList() << "sunset" << "sun" << "summer", +1);
+    trie.accountKeywords(QStringList() << "sunset" << "summer", +1);
+    trie.accountKeywords(QStringList() << "summer", +1);
+    trie.accountKeywords(QStringList() << "sunflower" << "sea", +1);
+
+    std::vector<AutoComplete::CompletionResult> completions;
+    QCOMPARE(trie.prompt("su", 3, completions), 3);
+    QCOMPARE(completionsToList(completions), QStringList() << "summer" << "sunset" << "sun");
+    QCOMPARE(completions[0].m_Score, 3);
+    QCOMPARE(completions[1].m_Score, 2);
+
+    completions.clear();
+    QCOMPARE(trie.prompt("su", 10, completions), 4);
+    QCOMPARE(completions.back().m_Completion, QString("sunflower"));
+    QCOMPARE(trie.getKeywordsCount(), 5);
+}
+
+void KeywordsFrequencyTrieTests::keywordsAreNormalizedTest() {
+    AutoComplete::KeywordsFrequencyTrie trie;
+    trie.accountKeywords(QStringList() << "Beach" << " beach " << "BEACH", +1);
+    trie.accountKeywords(QStringList() << "beach", +1);
+
+    std::vector<AutoComplete::CompletionResult> completions;
+    QCOMPARE(trie.prompt("Bea", 10, completions), 1);
+    QCOMPARE(completions[0].m_Completion, QString("beach"));
+    // duplicates within one artwork are counted once
+    QCOMPARE(completions[0].m_Score, 2);
+}
+
+void KeywordsFrequencyTrieTests::removedKeywordsAreNotCompletedTest() {
+    AutoComplete::KeywordsFrequencyTrie trie;
+    trie.accountKeywords(QStringList() << "mountain" << "mount", +1);
+    trie.accountKeywords(QStringList() << "mountain", +1);
+    trie.accountKeywords(QStringList() << "mount", +1);
+    trie.accountKeywords(QStringList() << "mountain", -1);
+    trie.accountKeywords(QStringList() << "mountain", -1);
+    // never accounted keywords are ignored
+    trie.accountKeywords(QStringList() << "mountains", -1);
+
+    std::vector<AutoComplete::CompletionResult> completions;
+    QCOMPARE(trie.prompt("mou", 10, completions), 1);
+    QCOMPARE(completions[0].m_Completion, QString("mount"));
+    QCOMPARE(trie.getKeywordsCount(), 1);
+
+    trie.accountKeywords(QStringList() << "mount", -1);
+    trie.accountKeywords(QStringList() << "mount", -1);
+    trie.accountKeywords(QStringList() << "mount", -1);
+
+    completions.clear();
+    QCOMPARE(trie.prompt("m", 10, completions), 0);
+    QCOMPARE(trie.getKeywordsCount(), 0);
+}
+
+void KeywordsFrequencyTrieTests::prefixIsCompletedTest() {
+    AutoComplete::KeywordsFrequencyTrie trie;
+    trie.accountKeywords(QStringList() << "cat" << "catalog", +1);
+    trie.accountKeywords(QStringList() << "catalog", +1);
+
+    std::vector<AutoComplete::CompletionResult> completions;
+    QCOMPARE(trie.prompt("cat", 10, completions), 2);
+    QCOMPARE(completionsToList(completions), QStringList() << "catalog" << "cat");
+
+    completions.clear();
+    QCOMPARE(trie.prompt("dog", 10, completions), 0);
+    QCOMPARE(trie.prompt("catalogs", 10, completions), 0);
+    QCOMPARE(trie.prompt("cat", 0, completions), 0);
+}
+
+void KeywordsFrequencyTrieTests::loadedFrequenciesAreAccountedTest() {
+    AutoComplete::KeywordsFrequencyTrie trie;
+    QHash<QString, int> frequencies;
+    frequencies.insert("forest", 10);
+    frequencies.insert("fog", 4);
+    frequencies.insert("Foggy", 7);
+    trie.accountFrequencies(frequencies);
+
+    trie.accountKeywords(QStringList() << "fog", +1);
+
+    std::vector<AutoComplete::CompletionResult> completions;
+    QCOMPARE(trie.prompt("fo", 10, completions), 3);
+    QCOMPARE(completionsToList(completions), QStringList() << "forest" << "foggy" << "fog");
+    QCOMPARE(completions[2].m_Score, 5);
+}
+
+void KeywordsFrequencyTrieTests::clearTest() {
+    AutoComplete::KeywordsFrequencyTrie trie;
+    trie.accountKeywords(QStringList() << "river" << "rain", +1);
+    trie.clear();
+
+    std::vector<AutoComplete::CompletionResult> completions;
+    QCOMPARE(trie.prompt("r", 10, completions), 0);
+    QCOMPARE(trie.getKeywordsCount(), 0);
+
+    trie.accountKeywords(QStringList() << "rain", +1);
+    QCOMPARE(trie.prompt("r", 10, completions), 1);
+}
+
+void KeywordsFrequencyTrieTests::mergeCompletionsTest() {
+    std::vector<AutoComplete::CompletionResult> keywords, wordlist, merged;
+    keywords.push_back(scoredCompletion("sunset", 10));
+    keywords.push_back(scoredCompletion("sunrise", 2));
+    wordlist.push_back(scoredCompletion("sun", 200));
+    wordlist.push_back(scoredCompletion("sunday", 100));
+    wordlist.push_back(scoredCompletion("sunny", 10));
+
+    AutoComplete::mergeCompletions(keywords, wordlist, 4, merged);
+
+    QCOMPARE(completionsToList(merged), QStringList() << "sunset" << "sun" << "sunday" << "sunrise");
+}
+
+void KeywordsFrequencyTrieTests::mergeRemovesDuplicatesTest() {
+    std::vector<AutoComplete::CompletionResult> keywords, wordlist, merged;
+    keywords.push_back(scoredCompletion("tree", 3));
+    wordlist.push_back(scoredCompletion("tree", 50));
+    wordlist.push_back(scoredCompletion("trees", 20));
+
+    AutoComplete::mergeCompletions(keywords, wordlist, 8, merged);
+
+    QCOMPARE(completionsToList(merged), QStringList() << "tree" << "trees");
+
+    merged.clear();
+    AutoComplete::mergeCompletions(std::vector<AutoComplete::CompletionResult>(), wordlist, 8, merged);
+    QCOMPARE(completionsToList(merged), QStringList() << "tree" << "trees");
+}
@@ -0,0 +1,21 @@
+#ifndef KEYWORDSFREQUENCYTRIE_TESTS_H
+#define KEYWORDSFREQUENCYTRIE_TESTS_H
+
+#include <QObject>
+#include <QtTest/QtTest>
+
+class KeywordsFrequencyTrieTests : public QObject
+{
+    Q_OBJECT
+private slots:
+    void mostFrequentFirstTest();
+    void keywordsAreNormalizedTest();
+    void removedKeywordsAreNotCompletedTest();
+    void prefixIsCompletedTest();
+    void loadedFrequenciesAreAccountedTest();
+    void clearTest();
+    void mergeCompletionsTest();
+    void mergeRemovesDuplicatesTest();
+};
+
+#endif // KEYWORDSFREQUENCYTRIE_TESTS_H
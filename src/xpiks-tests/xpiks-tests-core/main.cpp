@@ -27,6 +27,13 @@
 #include "preset_tests.h"
 #include "quickbuffer_tests.h"
 #include "jsonmerge_tests.h"
+#include "workstealingexecutor_tests.h"
+#include "itemprocessingworker_tests.h"
+#include "metrics_tests.h"
+#include "spellcheckitem_tests.h"
+#include "wordlistindex_tests.h"
+#include "keywordsfrequencytrie_tests.h"
+#include "presetsnameindex_tests.h"
 
 #define QTEST_CLASS(TestObject, vName, result) \
     TestObject vName; \
@@ -63,6 +70,13 @@ int main(int argc, char *argv[]) {
     QTEST_CLASS(PresetTests, pst, result);
     QTEST_CLASS(QuickBufferTests, qbt, result);
     QTEST_CLASS(JsonMergeTests, jmt, result);
+    QTEST_CLASS(WorkStealingExecutorTests, wset, result);
+    QTEST_CLASS(ItemProcessingWorkerTests, ipwt, result);
+    QTEST_CLASS(MetricsTests, mt, result);
+    QTEST_CLASS(SpellCheckItemTests, scit, result);
+    QTEST_CLASS(WordlistIndexTests, wit, result);
+    QTEST_CLASS(KeywordsFrequencyTrieTests, kftt, result);
+    QTEST_CLASS(PresetsNameIndexTests, pnit, result);
 
     QThread::sleep(1);
 
@@ -0,0 +1,73 @@
+#include "metrics_tests.h"
+#include <vector>
+#include "../../xpiks-qt/Helpers/metrics.h"
+
+void MetricsTests::bucketsCoverValuesTest() {
+    int previousIndex = -1;
+
+    for (qint64 value = 0; value < 100000; value++) {
+        const int index = Helpers::LatencyHistogram::getBucketIndex(value);
+        QVERIFY(index >= previousIndex);
+        QVERIFY(index < HISTOGRAM_BUCKETS_COUNT);
+
+        // bucket value is never further than 1/8 from the recorded one
+        const qint64 bucketValue = Helpers::LatencyHistogram::getBucketValue(index);
+        QVERIFY(qAbs(bucketValue - value) * HISTOGRAM_SUB_BUCKETS <= value);
+
+        previousIndex = index;
+    }
+
+    QCOMPARE(Helpers::LatencyHistogram::getBucketIndex(Q_INT64_C(1) << 62), HISTOGRAM_BUCKETS_COUNT - 1);
+}
+
+void MetricsTests::percentilesAreWithinPrecisionTest() {
+    Helpers::LatencyHistogram histogram;
+
+    for (qint64 value = 1; value <= 1000; value++) {
+        histogram.record(value);
+    }
+
+    Helpers::HistogramSnapshot snapshot;
+    histogram.snapshot(snapshot);
+
+    QCOMPARE(snapshot.m_Count, Q_INT64_C(1000));
+    QCOMPARE(snapshot.m_Max, Q_INT64_C(1000));
+    QCOMPARE(snapshot.m_Mean, Q_INT64_C(500));
+    QVERIFY(qAbs(snapshot.m_P50 - 500) <= 500 / HISTOGRAM_SUB_BUCKETS);
+    QVERIFY(qAbs(snapshot.m_P90 - 900) <= 900 / HISTOGRAM_SUB_BUCKETS);
+    QVERIFY(qAbs(snapshot.m_P99 - 990) <= 990 / HISTOGRAM_SUB_BUCKETS);
+    QVERIFY(snapshot.m_P99 <= snapshot.m_Max);
+}
+
+void MetricsTests::gaugeTracksMaximumTest() {
+    Helpers::MetricGauge gauge;
+    gauge.set(10);
+    gauge.set(3);
+
+    QCOMPARE(gauge.get(), Q_INT64_C(3));
+    QCOMPARE(gauge.getMax(), Q_INT64_C(10));
+}
+
+void MetricsTests::workerMetricsAreSharedTest() {
+    Helpers::MetricsRegistry &registry = Helpers::MetricsRegistry::getInstance();
+    Helpers::WorkerMetrics *first = registry.getWorkerMetrics("MetricsTestsWorker");
+    Helpers::WorkerMetrics *second = registry.getWorkerMetrics("MetricsTestsWorker");
+
+    QVERIFY(first == second);
+    QVERIFY(first->m_Processed == registry.getCounter("MetricsTestsWorker.processed"));
+
+    first->m_Processed->add(5);
+
+    std::vector<Helpers::MetricValue> values;
+    registry.snapshot(values);
+
+    bool found = false;
+    for (auto &value: values) {
+        if (value.m_Name == "MetricsTestsWorker.processed") {
+            QCOMPARE(value.m_Value, Q_INT64_C(5));
+            found = true;
+        }
+    }
+
+    QVERIFY(found);
+}
@@ -0,0 +1,17 @@
+#ifndef METRICS_TESTS_H
+#define METRICS_TESTS_H
+
+#include <QObject>
+#include <QtTest/QtTest>
+
+class MetricsTests : public QObject
+{
+    Q_OBJECT
+private slots:
+    void bucketsCoverValuesTest();
+    void percentilesAreWithinPrecisionTest();
+    void gaugeTracksMaximumTest();
+    void workerMetricsAreSharedTest();
+};
+
+#endif // METRICS_TESTS_H
@@ -482,3 +482,40 @@ void PresetTests::addGroupTest() {
     QVERIFY(foundGroup);
     QCOMPARE(foundID, groupID);
 }
+
+void PresetTests::findPresetAfterRenameTest() {
+    const int itemsToGenerate = 5;
+    DECLARE_MODELS_AND_GENERATE(itemsToGenerate);
+    presetKeywordsModel.addItem("cat", QStringList() << "some" << "keywords");
+    KeywordsPresets::ID_t id2 = presetKeywordsModel.addItem("dog", QStringList() << "other" << "keywords");
+
+    presetKeywordsModel.setName(0, "horse");
+
+    KeywordsPresets::ID_t id;
+    QVERIFY(!presetKeywordsModel.tryFindSinglePresetByName("cat", false, id));
+    QVERIFY(presetKeywordsModel.tryFindSinglePresetByName("Horse", false, id));
+
+    presetKeywordsModel.setName(1, "hot dog");
+    QVERIFY(presetKeywordsModel.tryFindSinglePresetByName("hot dog", true, id)); QCOMPARE(id, id2);
+    QVERIFY(!presetKeywordsModel.tryFindSinglePresetByName("ho", false, id));
+}
+
+void PresetTests::findPresetAfterRemoveTest() {
+    const int itemsToGenerate = 5;
+    DECLARE_MODELS_AND_GENERATE(itemsToGenerate);
+    KeywordsPresets::ID_t id1 = presetKeywordsModel.addItem("first", QStringList() << "some" << "keywords");
+    KeywordsPresets::ID_t id2 = presetKeywordsModel.addItem("second", QStringList() << "other" << "keywords");
+    KeywordsPresets::ID_t id3 = presetKeywordsModel.addItem("third", QStringList() << "more" << "keywords");
+
+    QVERIFY(presetKeywordsModel.removePresetByID(id1));
+
+    KeywordsPresets::ID_t id;
+    QVERIFY(!presetKeywordsModel.tryFindSinglePresetByName("first", false, id));
+    QVERIFY(presetKeywordsModel.tryFindSinglePresetByName("second", true, id)); QCOMPARE(id, id2);
+    QVERIFY(presetKeywordsModel.tryFindSinglePresetByName("thi", false, id)); QCOMPARE(id, id3);
+
+    QVector<QPair<int, QString> > results;
+    presetKeywordsModel.findPresetsByName("ird", results);
+    QCOMPARE(results.size(), 1);
+    QCOMPARE(results[0].first, 1);
+}
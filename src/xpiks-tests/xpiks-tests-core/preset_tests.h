@@ -29,6 +29,8 @@ private slots:
     void registerGroupTwiceTest();
     void setPresetUnknownGroupTest();
     void addGroupTest();
+    void findPresetAfterRenameTest();
+    void findPresetAfterRemoveTest();
 };
 
 #endif // PRESETTESTS_H
@@ -0,0 +1,109 @@
+#include "presetsnameindex_tests.h"
+#include <vector>
+#include "../../xpiks-qt/KeywordsPresets/presetsnameindex.h"
+
+void addNames(KeywordsPresets::PresetsNameIndex &index, const QStringList &names) {
+    for (auto &name: names) {
+        index.addName(index.size(), name);
+    }
+}
+
+void PresetsNameIndexTests::exactMatchIgnoresCaseTest() {
+    KeywordsPresets::PresetsNameIndex index;
+    addNames(index, QStringList() << "Man" << "woman" << "MAN");
+
+    std::vector<size_t> indices;
+    index.findExact("man", indices);
+    QCOMPARE(indices, std::vector<size_t>({0, 2}));
+
+    indices.clear();
+    index.findExact("wo", indices);
+    QVERIFY(indices.empty());
+}
+
+void PresetsNameIndexTests::prefixMatchTest() {
+    KeywordsPresets::PresetsNameIndex index;
+    addNames(index, QStringList() << "summer beach" << "Sunset" << "winter" << "sun");
+
+    std::vector<size_t> indices;
+    index.findByPrefix("SU", 10, indices);
+    QCOMPARE(indices, std::vector<size_t>({0, 3, 1}));
+
+    indices.clear();
+    index.findByPrefix("su", 2, indices);
+    QCOMPARE(indices.size(), (size_t)2);
+}
+
+void PresetsNameIndexTests::containingShortTermTest() {
+    KeywordsPresets::PresetsNameIndex index;
+    addNames(index, QStringList() << "man" << "woman" << "dog");
+
+    std::vector<size_t> indices;
+    index.findContaining("An", indices);
+    QCOMPARE(indices, std::vector<size_t>({0, 1}));
+}
+
+void PresetsNameIndexTests::containingLongTermTest() {
+    KeywordsPresets::PresetsNameIndex index;
+    addNames(index, QStringList() << "shutterstock" << "canstockphoto" << "stoke on trent" << "Stock photos" << "abcd xbcy");
+
+    std::vector<size_t> indices;
+    index.findContaining("stock", indices);
+    QCOMPARE(indices, std::vector<size_t>({0, 1, 3}));
+
+    // all trigrams are present but not in this order
+    indices.clear();
+    index.findContaining("abcy", indices);
+    QVERIFY(indices.empty());
+}
+
+void PresetsNameIndexTests::renameUpdatesIndexTest() {
+    KeywordsPresets::PresetsNameIndex index;
+    addNames(index, QStringList() << "cat" << "dog");
+
+    index.rename(0, "Horse");
+
+    std::vector<size_t> indices;
+    index.findExact("cat", indices);
+    QVERIFY(indices.empty());
+
+    index.findContaining("cat", indices);
+    QVERIFY(indices.empty());
+
+    index.findExact("horse", indices);
+    QCOMPARE(indices, std::vector<size_t>({0}));
+
+    indices.clear();
+    index.findByPrefix("hor", 10, indices);
+    QCOMPARE(indices, std::vector<size_t>({0}));
+}
+
+void PresetsNameIndexTests::fuzzyCandidatesTest() {
+    KeywordsPresets::PresetsNameIndex index;
+    addNames(index, QStringList() << "canstockphoto" << "shutterstock" << "shuttle");
+
+    std::vector<size_t> indices;
+    index.findFuzzyCandidates("shuterstock", 10, indices);
+    QVERIFY(!indices.empty());
+    QCOMPARE(indices.front(), (size_t)1);
+
+    indices.clear();
+    index.findFuzzyCandidates("xyz", 10, indices);
+    QVERIFY(indices.empty());
+}
+
+void PresetsNameIndexTests::clearTest() {
+    KeywordsPresets::PresetsNameIndex index;
+    addNames(index, QStringList() << "first" << "second");
+
+    index.clear();
+    QCOMPARE(index.size(), (size_t)0);
+
+    std::vector<size_t> indices;
+    index.findContaining("first", indices);
+    QVERIFY(indices.empty());
+
+    addNames(index, QStringList() << "third");
+    index.findExact("third", indices);
+    QCOMPARE(indices, std::vector<size_t>({0}));
+}
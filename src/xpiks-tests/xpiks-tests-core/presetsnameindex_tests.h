@@ -0,0 +1,20 @@
+#ifndef PRESETSNAMEINDEX_TESTS_H
+#define PRESETSNAMEINDEX_TESTS_H
+
+#include <QObject>
+#include <QtTest/QtTest>
+
+class PresetsNameIndexTests : public QObject
+{
+    Q_OBJECT
+private slots:
+    void exactMatchIgnoresCaseTest();
+    void prefixMatchTest();
+    void containingShortTermTest();
+    void containingLongTermTest();
+    void renameUpdatesIndexTest();
+    void fuzzyCandidatesTest();
+    void clearTest();
+};
+
+#endif // PRESETSNAMEINDEX_TESTS_H
@@ -414,3 +414,107 @@ void ReplaceTests::replaceKeywordsToEmptyTest() {
     }
 }
 
+
+void ReplaceTests::previewHitsTest() {
+    const int itemsToGenerate = 5;
+    DECLARE_MODELS_AND_GENERATE(itemsToGenerate);
+
+    QString replaceFrom = "vector";
+
+    auto flags = Common::SearchFlags::Description |
+            Common::SearchFlags::Title |
+            Common::SearchFlags::Keywords |
+            Common::SearchFlags::IncludeSpaces;
+
+    for (int i = 0; i < itemsToGenerate; i++) {
+        auto *metadata = artItemsModelMock.getMockArtwork(i);
+        if (i % 2 == 0) {
+            metadata->set(QString("A Vector and a vector"), QString("No match here"),
+                          QStringList() << "keyword" << "vectors" << "vector art");
+        } else {
+            metadata->set(QString("Nothing"), QString("No match here"), QStringList() << "keyword");
+        }
+    }
+
+    auto artWorksInfo = filteredItemsModel.getSearchablePreviewOriginalItems(replaceFrom, flags);
+    QCOMPARE((int)artWorksInfo.size(), 3);
+
+    for (auto &locker: artWorksInfo) {
+        auto preview = std::dynamic_pointer_cast<Models::PreviewArtworkElement>(locker);
+        QVERIFY(preview);
+        QVERIFY(preview->hasTitleMatch());
+        QVERIFY(!preview->hasDescriptionMatch());
+        QVERIFY(preview->hasKeywordsMatch());
+        QCOMPARE(preview->getTitleHits(), std::vector<int>({2, 15}));
+        QCOMPARE(preview->getKeywordsHits(), std::vector<int>({1, 2}));
+    }
+}
+
+void ReplaceTests::wholeWordsPreviewTest() {
+    const int itemsToGenerate = 4;
+    DECLARE_MODELS_AND_GENERATE(itemsToGenerate);
+
+    QString replaceFrom = "wall";
+
+    auto flags = Common::SearchFlags::Description |
+            Common::SearchFlags::Title |
+            Common::SearchFlags::Keywords |
+            Common::SearchFlags::WholeWords |
+            Common::SearchFlags::IncludeSpaces;
+
+    for (int i = 0; i < itemsToGenerate; i++) {
+        auto *metadata = artItemsModelMock.getMockArtwork(i);
+        if (i == 0) {
+            metadata->set(QString("Title"), QString("Stone wall"), QStringList() << "wallpaper" << "old wall");
+        } else {
+            metadata->set(QString("Wallpaper"), QString("Walls"), QStringList() << "wallpaper");
+        }
+    }
+
+    auto artWorksInfo = filteredItemsModel.getSearchablePreviewOriginalItems(replaceFrom, flags);
+    QCOMPARE((int)artWorksInfo.size(), 1);
+
+    auto preview = std::dynamic_pointer_cast<Models::PreviewArtworkElement>(artWorksInfo.front());
+    QVERIFY(preview);
+    QCOMPARE(preview->getArtworkMetadata(), artItemsModelMock.getArtwork(0));
+    QCOMPARE(preview->getDescriptionHits(), std::vector<int>({6}));
+    QCOMPARE(preview->getKeywordsHits(), std::vector<int>({1}));
+}
+
+void ReplaceTests::replaceUsesPreviewHitsTest() {
+    const int itemsToGenerate = 5;
+    DECLARE_MODELS_AND_GENERATE(itemsToGenerate);
+
+    QString replaceFrom = "Replace";
+    QString replaceTo = "Replaced";
+    QString initString = "ReplaceMe";
+
+    auto flags = Common::SearchFlags::CaseSensitive |
+                Common::SearchFlags::Description |
+                Common::SearchFlags::Title |
+                Common::SearchFlags::Keywords;
+
+    for (int i = 0; i < itemsToGenerate; i++) {
+        auto *metadata = artItemsModelMock.getMockArtwork(i);
+        metadata->set(QString("Title"), initString, QStringList() << initString);
+    }
+
+    auto artWorksInfo = filteredItemsModel.getSearchablePreviewOriginalItems(replaceFrom, flags);
+    QCOMPARE((int)artWorksInfo.size(), itemsToGenerate);
+
+    // title had no hits when preview was built
+    for (int i = 0; i < itemsToGenerate; i++) {
+        artItemsModelMock.getMockArtwork(i)->setTitle(initString);
+    }
+
+    std::shared_ptr<Commands::FindAndReplaceCommand> replaceCommand(
+                new Commands::FindAndReplaceCommand(artWorksInfo, replaceFrom, replaceTo, flags));
+    auto result = commandManagerMock.processCommand(replaceCommand);
+
+    for (int i = 0; i < itemsToGenerate; i++) {
+        auto *metadata = artItemsModelMock.getMockArtwork(i);
+        QCOMPARE(metadata->getDescription(), QString("ReplacedMe"));
+        QCOMPARE(metadata->getTitle(), initString);
+        QCOMPARE(metadata->getKeywords()[0], QString("ReplacedMe"));
+    }
+}
@@ -20,6 +20,9 @@ private slots:
     void replaceSpacesToWordsTest();
     void replaceSpacesToSpacesTest();
     void replaceKeywordsToEmptyTest();
+    void previewHitsTest();
+    void wholeWordsPreviewTest();
+    void replaceUsesPreviewHitsTest();
 };
 
 #endif // REPLACETEST_H
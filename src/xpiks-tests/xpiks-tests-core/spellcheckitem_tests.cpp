@@ -0,0 +1,127 @@
+#include "spellcheckitem_tests.h"
+#include <QHash>
+#include "../../xpiks-qt/SpellCheck/spellcheckitem.h"
+#include "../../xpiks-qt/SpellCheck/spellcheckiteminfo.h"
+#include "../../xpiks-qt/Common/basicmetadatamodel.h"
+#include "../../xpiks-qt/Common/flags.h"
+
+#define INIT_SPELLCHECK_ITEM_TEST \
+    Common::BasicMetadataModel basicModel(m_FakeHold); \
+    SpellCheck::SpellCheckItemInfo spellCheckInfo; \
+    basicModel.setSpellCheckInfo(&spellCheckInfo);
+
+std::shared_ptr<SpellCheck::SpellCheckQueryItem> findQuery(const SpellCheck::SpellCheckItem &item, const QString &word) {
+    for (auto &query: item.getQueries()) {
+        if (query->m_Word == word) { return query; }
+    }
+
+    return std::shared_ptr<SpellCheck::SpellCheckQueryItem>();
+}
+
+void SpellCheckItemTests::onlyChangedWordsAreAnalyzedTest() {
+    INIT_SPELLCHECK_ITEM_TEST;
+
+    basicModel.initialize("sunny beach", "sunny wavess", "keyword");
+
+    QHash<QString, Common::WordAnalysisResult> previousResults;
+    previousResults.insert("sunny", Common::WordAnalysisResult("sun", true));
+    previousResults.insert("wavess", Common::WordAnalysisResult("wavess", false));
+    spellCheckInfo.updateWordsAnalysis(previousResults, Common::WordAnalysisFlags::All, true, spellCheckInfo.getAnalysisGeneration());
+
+    SpellCheck::SpellCheckItem item(&basicModel, Common::SpellCheckFlags::Description, Common::WordAnalysisFlags::All);
+    QCOMPARE((int)item.getQueries().size(), 2);
+
+    auto sunny = findQuery(item, "sunny");
+    QVERIFY(sunny);
+    QVERIFY(sunny->m_IsAnalyzed);
+    QVERIFY(sunny->m_IsCorrect);
+    QCOMPARE(sunny->m_Stem, QString("sun"));
+
+    auto wavess = findQuery(item, "wavess");
+    QVERIFY(wavess);
+    QVERIFY(wavess->m_IsAnalyzed);
+    QVERIFY(!wavess->m_IsCorrect);
+
+    SpellCheck::SpellCheckItem titleItem(&basicModel, Common::SpellCheckFlags::Title, Common::WordAnalysisFlags::All);
+    auto beach = findQuery(titleItem, "beach");
+    QVERIFY(beach);
+    QVERIFY(!beach->m_IsAnalyzed);
+    QVERIFY(findQuery(titleItem, "sunny")->m_IsAnalyzed);
+}
+
+void SpellCheckItemTests::analysisWithOtherFlagsIsIgnoredTest() {
+    INIT_SPELLCHECK_ITEM_TEST;
+
+    basicModel.initialize("title", "description", "keyword");
+
+    QHash<QString, Common::WordAnalysisResult> previousResults;
+    previousResults.insert("description", Common::WordAnalysisResult("", true));
+    spellCheckInfo.updateWordsAnalysis(previousResults, Common::WordAnalysisFlags::Spelling, true, spellCheckInfo.getAnalysisGeneration());
+
+    SpellCheck::SpellCheckItem item(&basicModel, Common::SpellCheckFlags::Description, Common::WordAnalysisFlags::All);
+    auto description = findQuery(item, "description");
+    QVERIFY(description);
+    QVERIFY(!description->m_IsAnalyzed);
+}
+
+void SpellCheckItemTests::fullCheckReplacesAnalysisTest() {
+    INIT_SPELLCHECK_ITEM_TEST;
+
+    basicModel.initialize("title", "description", "keyword");
+
+    QHash<QString, Common::WordAnalysisResult> previousResults;
+    previousResults.insert("removed", Common::WordAnalysisResult("remove", true));
+    spellCheckInfo.updateWordsAnalysis(previousResults, Common::WordAnalysisFlags::All, true, spellCheckInfo.getAnalysisGeneration());
+
+    {
+        SpellCheck::SpellCheckItem item(&basicModel, Common::SpellCheckFlags::All, Common::WordAnalysisFlags::All);
+        item.getQueries().front()->m_IsCorrect = false;
+        item.accountResults();
+        item.submitSpellCheckResult();
+    }
+
+    Common::WordAnalysisResult result;
+    QVERIFY(!spellCheckInfo.tryGetWordAnalysis("removed", Common::WordAnalysisFlags::All, result));
+    QVERIFY(spellCheckInfo.tryGetWordAnalysis("keyword", Common::WordAnalysisFlags::All, result));
+    QVERIFY(!result.m_IsCorrect);
+    QVERIFY(spellCheckInfo.tryGetWordAnalysis("description", Common::WordAnalysisFlags::All, result));
+    QVERIFY(result.m_IsCorrect);
+    QCOMPARE(spellCheckInfo.getAnalyzedWordsCount(), 3);
+}
+
+void SpellCheckItemTests::userDictionaryChangeResetsAnalysisTest() {
+    INIT_SPELLCHECK_ITEM_TEST;
+
+    basicModel.initialize("title", "descriptionn", "keyword");
+
+    QHash<QString, Common::WordAnalysisResult> previousResults;
+    previousResults.insert("descriptionn", Common::WordAnalysisResult("descriptionn", false));
+    spellCheckInfo.updateWordsAnalysis(previousResults, Common::WordAnalysisFlags::All, true, spellCheckInfo.getAnalysisGeneration());
+    spellCheckInfo.setDescriptionErrors(QSet<QString>() << "descriptionn");
+
+    spellCheckInfo.removeWordsFromErrors(QStringList() << "descriptionn");
+
+    QVERIFY(!spellCheckInfo.hasDescriptionError("descriptionn"));
+    QCOMPARE(spellCheckInfo.getAnalyzedWordsCount(), 0);
+
+    SpellCheck::SpellCheckItem item(&basicModel, Common::SpellCheckFlags::Description, Common::WordAnalysisFlags::All);
+    QVERIFY(!findQuery(item, "descriptionn")->m_IsAnalyzed);
+}
+
+void SpellCheckItemTests::staleAnalysisIsDroppedAfterResetTest() {
+    INIT_SPELLCHECK_ITEM_TEST;
+
+    basicModel.initialize("title", "descriptionn", "keyword");
+
+    SpellCheck::SpellCheckItem item(&basicModel, Common::SpellCheckFlags::All, Common::WordAnalysisFlags::All);
+
+    // user dictionary changed while the item was being checked
+    spellCheckInfo.resetWordsAnalysis();
+
+    item.accountResults();
+    item.submitSpellCheckResult();
+
+    Common::WordAnalysisResult result;
+    QVERIFY(!spellCheckInfo.tryGetWordAnalysis("descriptionn", Common::WordAnalysisFlags::All, result));
+    QCOMPARE(spellCheckInfo.getAnalyzedWordsCount(), 0);
+}
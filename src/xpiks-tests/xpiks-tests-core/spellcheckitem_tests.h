@@ -0,0 +1,22 @@
+#ifndef SPELLCHECKITEM_TESTS_H
+#define SPELLCHECKITEM_TESTS_H
+
+#include <QObject>
+#include <QtTest/QtTest>
+#include "../../xpiks-qt/Common/hold.h"
+
+class SpellCheckItemTests : public QObject
+{
+    Q_OBJECT
+private slots:
+    void onlyChangedWordsAreAnalyzedTest();
+    void analysisWithOtherFlagsIsIgnoredTest();
+    void fullCheckReplacesAnalysisTest();
+    void userDictionaryChangeResetsAnalysisTest();
+    void staleAnalysisIsDroppedAfterResetTest();
+
+private:
+    Common::Hold m_FakeHold;
+};
+
+#endif // SPELLCHECKITEM_TESTS_H
@@ -129,6 +129,28 @@ void StringHelpersTests::replaceWholeNoHitTest() {
     QCOMPARE(replaced, text);
 }
 
+void StringHelpersTests::findAllHitsTest() {
+    QString text = "Word inWord and the Wordend";
+    std::vector<int> hits;
+    Helpers::findAllHits(text, "word", Qt::CaseInsensitive, false, hits);
+    QCOMPARE(hits, std::vector<int>({0, 7, 20}));
+
+    hits.clear();
+    Helpers::findAllHits(text, "word", Qt::CaseSensitive, false, hits);
+    QVERIFY(hits.empty());
+
+    hits.clear();
+    Helpers::findAllHits("aaaa", "aa", Qt::CaseSensitive, false, hits);
+    QCOMPARE(hits, std::vector<int>({0, 2}));
+}
+
+void StringHelpersTests::findAllWholeWordsHitsTest() {
+    QString text = "Word inWord and the Wordend, word";
+    std::vector<int> hits;
+    Helpers::findAllHits(text, "word", Qt::CaseInsensitive, true, hits);
+    QCOMPARE(hits, std::vector<int>({0, 29}));
+}
+
 void StringHelpersTests::switcherHashTest() {
     QCOMPARE(Helpers::switcherHash(""), quint32(3820012610));
     QCOMPARE(Helpers::switcherHash("-"), quint32(963895330));
@@ -143,3 +165,75 @@ void StringHelpersTests::switcherHashTest() {
     QCOMPARE(Helpers::switcherHash("dc16d9fe-61d6-4564-931b-650e42fcf443"), quint32(3282680053));
 
 }
+
+void StringHelpersTests::levensteinDistanceTest() {
+    QCOMPARE(Helpers::levensteinDistance("", ""), 0u);
+    QCOMPARE(Helpers::levensteinDistance("", "abc"), 3u);
+    QCOMPARE(Helpers::levensteinDistance("abc", ""), 3u);
+    QCOMPARE(Helpers::levensteinDistance("abc", "abc"), 0u);
+    QCOMPARE(Helpers::levensteinDistance("kitten", "sitting"), 3u);
+    QCOMPARE(Helpers::levensteinDistance("sitting", "kitten"), 3u);
+    QCOMPARE(Helpers::levensteinDistance("flaw", "lawn"), 2u);
+    QCOMPARE(Helpers::levensteinDistance("gumbo", "gambol"), 2u);
+    QCOMPARE(Helpers::levensteinDistance(QString::fromUtf8("кошка"), QString::fromUtf8("мошки")), 2u);
+}
+
+void StringHelpersTests::levensteinDistanceLongStringsTest() {
+    QString a(100, QChar('a'));
+    QString b = a;
+    b[50] = QChar('b');
+    b.append("cc");
+    // both strings are longer than a machine word
+    QCOMPARE(Helpers::levensteinDistance(a, b), 3u);
+    QCOMPARE(Helpers::levensteinDistance(b, a), 3u);
+
+    QString shortString(30, QChar('a'));
+    QCOMPARE(Helpers::levensteinDistance(shortString, a), 70u);
+    QCOMPARE(Helpers::levensteinDistance(a, shortString), 70u);
+
+    QString pattern(64, QChar('x'));
+    QString text = pattern;
+    text[0] = QChar('y');
+    text[63] = QChar('y');
+    QCOMPARE(Helpers::levensteinDistance(pattern, text), 2u);
+}
+
+void StringHelpersTests::levensteinDistanceCaseInsensitiveTest() {
+    QCOMPARE(Helpers::levensteinDistance("Kitten", "kitten"), 1u);
+    QCOMPARE(Helpers::levensteinDistance("Kitten", "kitten", Qt::CaseInsensitive), 0u);
+    QCOMPARE(Helpers::levensteinDistance("KITTEN", "sitting", Qt::CaseInsensitive), 3u);
+    QCOMPARE(Helpers::levensteinDistance(QString::fromUtf8("КОШКА"), QString::fromUtf8("мошки"), Qt::CaseInsensitive), 2u);
+}
+
+void StringHelpersTests::levensteinDistanceWithinTest() {
+    QVERIFY(Helpers::isLevensteinDistanceWithin("kitten", "sitting", 3));
+    QVERIFY(Helpers::isLevensteinDistanceWithin("kitten", "sitting", 10));
+    QVERIFY(!Helpers::isLevensteinDistanceWithin("kitten", "sitting", 2));
+    QVERIFY(!Helpers::isLevensteinDistanceWithin("abc", "abcdefgh", 4));
+    QVERIFY(Helpers::isLevensteinDistanceWithin("", "", 0));
+    QVERIFY(!Helpers::isLevensteinDistanceWithin("", "a", 0));
+    QVERIFY(Helpers::isLevensteinDistanceWithin("Stock", "stock", 0, Qt::CaseInsensitive));
+
+    QString a(100, QChar('a'));
+    QString b(100, QChar('b'));
+    QVERIFY(!Helpers::isLevensteinDistanceWithin(a, b, 5));
+    QVERIFY(Helpers::isLevensteinDistanceWithin(a, b, 100));
+}
+
+void StringHelpersTests::levensteinPercentageTest() {
+    const char *words[] = {"", "a", "sun", "sunny", "Sunset", "sunrise", "kitten", "sitting", "absolutely"};
+    const int wordsCount = sizeof(words) / sizeof(words[0]);
+
+    for (int i = 0; i < wordsCount; i++) {
+        for (int j = 0; j < wordsCount; j++) {
+            const QString s1 = words[i], s2 = words[j];
+            const int percentage = Helpers::levensteinPercentage(s1, s2);
+
+            for (int threshold = 0; threshold <= 100; threshold += 5) {
+                QCOMPARE(Helpers::hasLevensteinPercentage(s1, s2, threshold), percentage >= threshold);
+            }
+        }
+    }
+
+    QCOMPARE(Helpers::levensteinPercentage("Sunset", "sunset"), 100);
+}
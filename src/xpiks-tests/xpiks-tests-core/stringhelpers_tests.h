@@ -24,7 +24,14 @@ private slots:
     void replaceWholeWithCommaTest();
     void replaceWholeNoCaseHitTest();
     void replaceWholeNoHitTest();
+    void findAllHitsTest();
+    void findAllWholeWordsHitsTest();
     void switcherHashTest();
+    void levensteinDistanceTest();
+    void levensteinDistanceLongStringsTest();
+    void levensteinDistanceCaseInsensitiveTest();
+    void levensteinDistanceWithinTest();
+    void levensteinPercentageTest();
 };
 
 #endif // STRINGHELPERSTESTS_H
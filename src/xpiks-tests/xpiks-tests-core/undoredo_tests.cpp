@@ -136,7 +136,11 @@ void UndoRedoTests::undoRemoveAddFullDirectoryTest() {
 
     QList<QUrl> dirs;
     dirs << QUrl::fromLocalFile(DIRECTORY_PATH);
-    int addedCount = artItemsModel->addLocalDirectories(dirs);
+    QSignalSpy addedSpy(artItemsModel, SIGNAL(artworksAdded(int,int,int)));
+    artItemsModel->addLocalDirectories(dirs);
+    // directories are listed asynchronously
+    QVERIFY(addedSpy.wait());
+    int addedCount = addedSpy.at(0).at(1).toInt();
 
     artItemsMock.removeItemsFromRanges({{1, 3}});
     QCOMPARE(artItemsMock.getArtworksCount(), addedCount - 3);
@@ -159,7 +163,11 @@ void UndoRedoTests::undoRemoveNotFullDirectoryTest() {
 
     QList<QUrl> dirs;
     dirs << QUrl::fromLocalFile(DIRECTORY_PATH);
-    int addedCount = artItemsModel->addLocalDirectories(dirs);
+    QSignalSpy addedSpy(artItemsModel, SIGNAL(artworksAdded(int,int,int)));
+    artItemsModel->addLocalDirectories(dirs);
+    // directories are listed asynchronously
+    QVERIFY(addedSpy.wait());
+    int addedCount = addedSpy.at(0).at(1).toInt();
 
     artworksRepository.unsetWasAddedAsFullDirectory(0);
 
@@ -188,7 +196,9 @@ void UndoRedoTests::undoRemoveLaterFullDirectoryTest() {
 
     QList<QUrl> dirs;
     dirs << QUrl::fromLocalFile(DIRECTORY_PATH "_0");
+    QSignalSpy addedSpy(artItemsModel, SIGNAL(artworksAdded(int,int,int)));
     artItemsModel->addLocalDirectories(dirs);
+    QVERIFY(addedSpy.wait());
 
     const int maxCount = artItemsModel->getArtworksCount();
     qDebug() << "max count is" << maxCount;
@@ -207,6 +217,31 @@ void UndoRedoTests::undoRemoveLaterFullDirectoryTest() {
     QVERIFY(artItemsMock.getArtworksCount() == maxCount);
 }
 
+void UndoRedoTests::undoAddDirectoriesAsOneActionTest() {
+    SETUP_TEST;
+    Models::SettingsModel settingsModel;
+    commandManagerMock.InjectDependency(&settingsModel);
+    settingsModel.setAutoFindVectors(false);
+
+    QList<QUrl> dirs;
+    dirs << QUrl::fromLocalFile(DIRECTORY_PATH "_0") << QUrl::fromLocalFile(DIRECTORY_PATH "_1");
+    QSignalSpy addedSpy(artItemsModel, SIGNAL(artworksAdded(int,int,int)));
+    artItemsModel->addLocalDirectories(dirs);
+    QVERIFY(addedSpy.wait());
+
+    // files of all directories are added in batches of a single add
+    QCOMPARE(addedSpy.count(), 1);
+    const int addedCount = addedSpy.at(0).at(1).toInt();
+    QCOMPARE(addedCount, 20);
+    QCOMPARE(artItemsMock.getArtworksCount(), addedCount);
+
+    bool undoStatus = undoRedoManager.undoLastAction();
+    QVERIFY(undoStatus);
+
+    QCOMPARE(artItemsMock.getArtworksCount(), 0);
+    QVERIFY(!undoRedoManager.getCanUndo());
+}
+
 void UndoRedoTests::undoUndoRemoveItemsTest() {
     SETUP_TEST;
     int itemsToAdd = 5;
@@ -15,6 +15,7 @@ private slots:
     void undoRemoveAddFullDirectoryTest();
     void undoRemoveNotFullDirectoryTest();
     void undoRemoveLaterFullDirectoryTest();
+    void undoAddDirectoriesAsOneActionTest();
     void undoUndoRemoveItemsTest();
     void undoModifyCommandTest();
     void undoUndoModifyCommandTest();
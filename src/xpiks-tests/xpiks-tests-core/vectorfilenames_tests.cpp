@@ -2,6 +2,7 @@
 #include <QStringList>
 #include <QString>
 #include <string>
+#include <QFileInfo>
 #include "../../xpiks-qt/Helpers/filehelpers.h"
 
 void CompareLists(const QStringList &actual, const QStringList &expected) {
@@ -71,3 +72,17 @@ void VectorFileNamesTests::simpleArchivePathTest() {
     QString processedPath = Helpers::getArchivePath(filepath);
     QCOMPARE(processedPath, zipPath);
 }
+
+void VectorFileNamesTests::findVectorInListingTest() {
+    const QString directory = QFileInfo("/home/file1.jpg").absolutePath();
+    QHash<QString, QHash<QString, QString> > vectors;
+    vectors[directory].insert("file1.ai", directory + "/FILE1.ai");
+    vectors[directory].insert("file1.eps", directory + "/file1.EPS");
+    vectors[directory].insert("file2.ai", directory + "/file2.ai");
+
+    QCOMPARE(Helpers::findVectorForImage(directory + "/file1.jpg", vectors), directory + "/file1.EPS");
+    QCOMPARE(Helpers::findVectorForImage(directory + "/File2.TIFF", vectors), directory + "/file2.ai");
+    QCOMPARE(Helpers::findVectorForImage(directory + "/file3.jpg", vectors), QString());
+    QCOMPARE(Helpers::findVectorForImage(directory + "/file1.mov", vectors), QString());
+    QCOMPARE(Helpers::findVectorForImage(directory + "/other/file1.jpg", vectors), QString());
+}
@@ -12,6 +12,7 @@ private slots:
     void simpleFilenamesTiffTest();
     void filenamesNotReplacedTest();
     void simpleArchivePathTest();
+    void findVectorInListingTest();
 };
 
 #endif // VECTORFILENAMES_TESTS_H
@@ -0,0 +1,133 @@
+#include "wordlistindex_tests.h"
+#include <QFile>
+#include <QDir>
+#include "../../xpiks-qt/AutoComplete/wordlistindex.h"
+
+bool writeWordlist(const QString &path, const QByteArray &contents) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) { return false; }
+    file.write(contents);
+    return true;
+}
+
+void WordlistIndexTests::initTestCase() {
+    QVERIFY(m_TempDir.isValid());
+    m_WordlistPath = QDir(m_TempDir.path()).filePath("wordlist.tsv");
+    m_IndexPath = QDir(m_TempDir.path()).filePath("wordlist.index");
+
+    QVERIFY(writeWordlist(m_WordlistPath,
+                          "50\tthe\r\n"
+                          "40\tthen\r\n"
+                          "30\tthere\r\n"
+                          "45\tthey\r\n"
+                          "20\ttheory\r\n"
+                          "10\tthermal\r\n"
+                          "35\tto\r\n"
+                          "5\tthe end\r\n"
+                          "15\tapple\r\n"
+                          "broken line\r\n"
+                          "\r\n"));
+
+    QVERIFY(AutoComplete::WordlistIndex::compile(m_WordlistPath, m_IndexPath));
+}
+
+void WordlistIndexTests::compileAndOpenTest() {
+    AutoComplete::WordlistIndex index;
+    QVERIFY(index.open(m_IndexPath, m_WordlistPath));
+    QVERIFY(index.isOpened());
+    QCOMPARE(index.getPhrasesCount(), (quint32)9);
+
+    index.close();
+    QVERIFY(!index.isOpened());
+}
+
+void WordlistIndexTests::mostFrequentFirstTest() {
+    AutoComplete::WordlistIndex index;
+    QVERIFY(index.open(m_IndexPath, m_WordlistPath));
+
+    QStringList phrases;
+    QCOMPARE(index.prompt("th", 4, phrases), 4);
+    QCOMPARE(phrases, QStringList() << "the" << "they" << "then" << "there");
+
+    phrases.clear();
+    QCOMPARE(index.prompt("th", 100, phrases), 7);
+    QCOMPARE(phrases, QStringList() << "the" << "they" << "then" << "there" << "theory" << "thermal" << "the end");
+}
+
+void WordlistIndexTests::prefixRangeTest() {
+    AutoComplete::WordlistIndex index;
+    QVERIFY(index.open(m_IndexPath, m_WordlistPath));
+
+    QStringList phrases;
+    index.prompt("ther", 10, phrases);
+    QCOMPARE(phrases, QStringList() << "there" << "thermal");
+
+    phrases.clear();
+    index.prompt("t", 10, phrases);
+    QCOMPARE(phrases.size(), 8);
+    QCOMPARE(phrases[2], QString("then"));
+    QVERIFY(phrases.contains("to"));
+
+    phrases.clear();
+    index.prompt("apple", 10, phrases);
+    QCOMPARE(phrases, QStringList() << "apple");
+}
+
+void WordlistIndexTests::noMatchesTest() {
+    AutoComplete::WordlistIndex index;
+    QVERIFY(index.open(m_IndexPath, m_WordlistPath));
+
+    QStringList phrases;
+    QCOMPARE(index.prompt("zebra", 10, phrases), 0);
+    QCOMPARE(index.prompt("apples", 10, phrases), 0);
+    QCOMPARE(index.prompt("a", 0, phrases), 0);
+    QVERIFY(phrases.isEmpty());
+}
+
+void WordlistIndexTests::duplicatesKeepMaxFrequencyTest() {
+    const QString wordlistPath = QDir(m_TempDir.path()).filePath("duplicates.tsv");
+    const QString indexPath = QDir(m_TempDir.path()).filePath("duplicates.index");
+    QVERIFY(writeWordlist(wordlistPath, "1\tsky\n7\tsea\n9\tsky\n3\tsky\n"));
+    QVERIFY(AutoComplete::WordlistIndex::compile(wordlistPath, indexPath));
+
+    AutoComplete::WordlistIndex index;
+    QVERIFY(index.open(indexPath, wordlistPath));
+    QCOMPARE(index.getPhrasesCount(), (quint32)2);
+
+    QStringList phrases;
+    index.prompt("s", 10, phrases);
+    QCOMPARE(phrases, QStringList() << "sky" << "sea");
+}
+
+void WordlistIndexTests::outdatedIndexIsRejectedTest() {
+    const QString wordlistPath = QDir(m_TempDir.path()).filePath("outdated.tsv");
+    const QString indexPath = QDir(m_TempDir.path()).filePath("outdated.index");
+    QVERIFY(writeWordlist(wordlistPath, "1\tone\n2\ttwo\n"));
+    QVERIFY(AutoComplete::WordlistIndex::compile(wordlistPath, indexPath));
+
+    QVERIFY(writeWordlist(wordlistPath, "1\tone\n2\ttwo\n3\tthree\n"));
+
+    AutoComplete::WordlistIndex index;
+    QVERIFY(!index.open(indexPath, wordlistPath));
+    QVERIFY(!index.isOpened());
+
+    QVERIFY(AutoComplete::WordlistIndex::compile(wordlistPath, indexPath));
+    QVERIFY(index.open(indexPath, wordlistPath));
+    QCOMPARE(index.getPhrasesCount(), (quint32)3);
+}
+
+void WordlistIndexTests::corruptedIndexIsRejectedTest() {
+    const QString indexPath = QDir(m_TempDir.path()).filePath("corrupted.index");
+
+    QFile source(m_IndexPath);
+    QVERIFY(source.open(QIODevice::ReadOnly));
+    QByteArray data = source.readAll();
+    data.chop(3);
+    QVERIFY(writeWordlist(indexPath, data));
+
+    AutoComplete::WordlistIndex index;
+    QVERIFY(!index.open(indexPath, QString()));
+
+    QVERIFY(writeWordlist(indexPath, "not an index"));
+    QVERIFY(!index.open(indexPath, QString()));
+}
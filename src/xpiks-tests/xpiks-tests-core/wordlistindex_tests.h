@@ -0,0 +1,27 @@
+#ifndef WORDLISTINDEX_TESTS_H
+#define WORDLISTINDEX_TESTS_H
+
+#include <QObject>
+#include <QtTest/QtTest>
+#include <QTemporaryDir>
+
+class WordlistIndexTests : public QObject
+{
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void compileAndOpenTest();
+    void mostFrequentFirstTest();
+    void prefixRangeTest();
+    void noMatchesTest();
+    void duplicatesKeepMaxFrequencyTest();
+    void outdatedIndexIsRejectedTest();
+    void corruptedIndexIsRejectedTest();
+
+private:
+    QString m_WordlistPath;
+    QString m_IndexPath;
+    QTemporaryDir m_TempDir;
+};
+
+#endif // WORDLISTINDEX_TESTS_H
@@ -0,0 +1,110 @@
+#include "workstealingexecutor_tests.h"
+#include <QSemaphore>
+#include <QAtomicInt>
+#include <vector>
+#include <memory>
+#include "../../xpiks-qt/Common/workstealingexecutor.h"
+#include "Mocks/orderrecordingworkermock.h"
+
+#define TASKS_COUNT 1000
+#define WAIT_TIMEOUT 5000
+
+void WorkStealingExecutorTests::allTasksAreExecutedTest() {
+    Common::WorkStealingExecutor executor(4);
+    QAtomicInt executedCount(0);
+
+    for (int i = 0; i < TASKS_COUNT; i++) {
+        Common::TaskPriority priority = (Common::TaskPriority)(i % 3);
+        QVERIFY(executor.submit([&executedCount]() { executedCount.ref(); }, priority));
+    }
+
+    executor.stop();
+
+    QCOMPARE(executedCount.load(), TASKS_COUNT);
+    QVERIFY(!executor.submit([]() {}, Common::TaskPriority::Normal));
+}
+
+void WorkStealingExecutorTests::nestedTasksAreExecutedTest() {
+    Common::WorkStealingExecutor executor(2);
+    QAtomicInt executedCount(0);
+    QSemaphore allDone;
+
+    for (int i = 0; i < TASKS_COUNT; i++) {
+        executor.submit([&]() {
+            executor.submit([&]() {
+                if (executedCount.fetchAndAddOrdered(1) + 1 == TASKS_COUNT) { allDone.release(); }
+            }, Common::TaskPriority::Interactive);
+        }, Common::TaskPriority::Background);
+    }
+
+    QVERIFY(allDone.tryAcquire(1, WAIT_TIMEOUT));
+    executor.stop();
+
+    QCOMPARE(executedCount.load(), TASKS_COUNT);
+}
+
+void WorkStealingExecutorTests::backgroundTasksDoNotBlockInteractiveTest() {
+    Common::WorkStealingExecutor executor(2);
+    QSemaphore unblockBackground;
+    QSemaphore interactiveDone;
+
+    // these would occupy both threads if background tasks were not limited
+    for (int i = 0; i < 2; i++) {
+        executor.submit([&]() { unblockBackground.tryAcquire(1, WAIT_TIMEOUT); }, Common::TaskPriority::Background);
+    }
+
+    executor.submit([&]() { interactiveDone.release(); }, Common::TaskPriority::Interactive);
+
+    const bool interactiveFinished = interactiveDone.tryAcquire(1, WAIT_TIMEOUT / 2);
+    unblockBackground.release(2);
+    executor.stop();
+
+    QVERIFY(interactiveFinished);
+}
+
+void WorkStealingExecutorTests::serialQueuePreservesOrderTest() {
+    Mocks::OrderRecordingWorker *worker = new Mocks::OrderRecordingWorker();
+    worker->doWorkOnExecutor(Common::TaskPriority::Normal);
+
+    std::vector<std::shared_ptr<int> > items;
+    for (int i = 0; i < TASKS_COUNT; i++) {
+        if (i % 100 == 0) {
+            worker->submitItems(items);
+            items.clear();
+        }
+
+        items.emplace_back(new int(i));
+    }
+
+    worker->submitItems(items);
+    // stopping cancels the queue so wait until everything is taken
+    QTRY_VERIFY_WITH_TIMEOUT(!worker->hasPendingJobs(), WAIT_TIMEOUT);
+    worker->stopWorking(false);
+
+    QVERIFY(worker->m_Stopped.tryAcquire(1, WAIT_TIMEOUT));
+    QCOMPARE((int)worker->m_ProcessedItems.size(), TASKS_COUNT);
+
+    for (int i = 0; i < TASKS_COUNT; i++) {
+        QCOMPARE(worker->m_ProcessedItems[i], i);
+    }
+
+    QVERIFY(!worker->isRunning());
+    delete worker;
+}
+
+void WorkStealingExecutorTests::serialQueueStopsOnceTest() {
+    Mocks::OrderRecordingWorker *worker = new Mocks::OrderRecordingWorker();
+    worker->doWorkOnExecutor(Common::TaskPriority::Background);
+
+    worker->submitItem(std::shared_ptr<int>(new int(1)));
+    worker->stopWorking();
+
+    QVERIFY(worker->m_Stopped.tryAcquire(1, WAIT_TIMEOUT));
+    QVERIFY(worker->isCancelled());
+    QCOMPARE(worker->submitItem(std::shared_ptr<int>(new int(2))), (quint32)INVALID_BATCH_ID);
+
+    // stopped worker does not schedule anything else
+    QTest::qWait(100);
+    QVERIFY(!worker->m_Stopped.tryAcquire(1, 0));
+    delete worker;
+}
@@ -0,0 +1,18 @@
+#ifndef WORKSTEALINGEXECUTOR_TESTS_H
+#define WORKSTEALINGEXECUTOR_TESTS_H
+
+#include <QObject>
+#include <QtTest/QtTest>
+
+class WorkStealingExecutorTests : public QObject
+{
+    Q_OBJECT
+private slots:
+    void allTasksAreExecutedTest();
+    void nestedTasksAreExecutedTest();
+    void backgroundTasksDoNotBlockInteractiveTest();
+    void serialQueuePreservesOrderTest();
+    void serialQueueStopsOnceTest();
+};
+
+#endif // WORKSTEALINGEXECUTOR_TESTS_H
@@ -187,13 +187,29 @@ SOURCES += main.cpp \
     ../../xpiks-qt/SpellCheck/duplicatesreviewmodel.cpp \
     deleteoldlogs_tests.cpp \
     jsonmerge_tests.cpp \
+    workstealingexecutor_tests.cpp \
+    itemprocessingworker_tests.cpp \
+    metrics_tests.cpp \
+    spellcheckitem_tests.cpp \
+    wordlistindex_tests.cpp \
+    keywordsfrequencytrie_tests.cpp \
+    presetsnameindex_tests.cpp \
     ../../xpiks-qt/KeywordsPresets/presetkeywordsmodelconfig.cpp \
     ../../xpiks-qt/Common/statefulentity.cpp \
     ../../xpiks-qt/KeywordsPresets/presetgroupsmodel.cpp \
     ../../xpiks-qt/UndoRedo/removedirectoryitem.cpp \
     ../../xpiks-qt/Common/basickeywordsmodelimpl.cpp \
     ../../xpiks-qt/Commands/maindelegator.cpp \
-    ../../xpiks-qt/Common/baseentity.cpp
+    ../../xpiks-qt/Common/baseentity.cpp \
+    ../../xpiks-qt/Helpers/startuptimeline.cpp \
+    ../../xpiks-qt/Helpers/tracing.cpp \
+    ../../xpiks-qt/Helpers/directorywatcher.cpp \
+    ../../xpiks-qt/Common/workstealingexecutor.cpp \
+    ../../xpiks-qt/Helpers/metrics.cpp \
+    ../../xpiks-qt/AutoComplete/wordlistindex.cpp \
+    ../../xpiks-qt/AutoComplete/keywordsfrequencytrie.cpp \
+    ../../xpiks-qt/AutoComplete/keywordscompletionengine.cpp \
+    ../../xpiks-qt/KeywordsPresets/presetsnameindex.cpp
 
 HEADERS += \
     encryption_tests.h \
@@ -281,6 +297,7 @@ HEADERS += \
     artitemsmodel_tests.h \
     fixspelling_tests.h \
     Mocks/spellcheckservicemock.h \
+    Mocks/orderrecordingworkermock.h \
     ../../xpiks-qt/Models/findandreplacemodel.h \
     replacepreview_tests.h \
     replace_tests.h \
@@ -323,6 +340,13 @@ HEADERS += \
     ../../xpiks-qt/SpellCheck/duplicatesreviewmodel.h \
     deleteoldlogs_tests.h \
     jsonmerge_tests.h \
+    workstealingexecutor_tests.h \
+    itemprocessingworker_tests.h \
+    metrics_tests.h \
+    spellcheckitem_tests.h \
+    wordlistindex_tests.h \
+    keywordsfrequencytrie_tests.h \
+    presetsnameindex_tests.h \
     ../../xpiks-qt/KeywordsPresets/presetkeywordsmodelconfig.h \
     ../../xpiks-qt/Common/statefulentity.h \
     ../../xpiks-qt/Common/delayedactionentity.h \
@@ -331,5 +355,15 @@ HEADERS += \
     ../../xpiks-qt/Common/basickeywordsmodelimpl.h \
     ../../xpiks-qt/Commands/maindelegator.h \
     ../../xpiks-qt/KeywordsPresets/groupmodel.h \
-    ../../xpiks-qt/KeywordsPresets/presetmodel.h
+    ../../xpiks-qt/KeywordsPresets/presetmodel.h \
+    ../../xpiks-qt/Helpers/startuptimeline.h \
+    ../../xpiks-qt/Helpers/tracing.h \
+    ../../xpiks-qt/Helpers/directorywatcher.h \
+    ../../xpiks-qt/Common/workstealingexecutor.h \
+    ../../xpiks-qt/Common/mpscqueue.h \
+    ../../xpiks-qt/Helpers/metrics.h \
+    ../../xpiks-qt/AutoComplete/wordlistindex.h \
+    ../../xpiks-qt/AutoComplete/keywordsfrequencytrie.h \
+    ../../xpiks-qt/AutoComplete/keywordscompletionengine.h \
+    ../../xpiks-qt/KeywordsPresets/presetsnameindex.h
 
@@ -108,6 +108,35 @@ int parsePlan2Csv(const QString &filepath, const std::deque<Models::ArtworkMetad
 #undef COLUMNIZE2
 }
 
+int parseQuotedValuesCsv(const QString &filepath, const QString &title, const QString &keyword) {
+#define PLAN1_COLUMNS_COUNT 4
+#define COLUMNIZE1(arr) arr[0], arr[1], arr[2], arr[3]
+
+    io::CSVReader<PLAN1_COLUMNS_COUNT,
+            io::trim_chars<' ', '\t'>,
+            io::double_quote_escape<',', '\"'>,
+            io::ignore_overflow,
+            io::empty_line_comment> csvReader(filepath.toStdString());
+
+    std::string columns[PLAN1_COLUMNS_COUNT];
+
+    bool success = csvReader.read_row(COLUMNIZE1(columns));
+    VERIFY(success, "First line cannot be read");
+
+    success = csvReader.read_row(COLUMNIZE1(columns));
+    VERIFY(success, "Row with quoted values cannot be read");
+
+    const QString keywordsString = QString::fromStdString(columns[1]);
+    VERIFY(keywordsString.contains(keyword), "Keyword with quotes and separator did not survive export");
+    VERIFY(QString::fromStdString(columns[3]) == title, "Title with quotes and separator did not survive export");
+
+    qInfo() << "Checked quoted values";
+
+    return 0;
+#undef PLAN1_COLUMNS_COUNT
+#undef COLUMNIZE1
+}
+
 void setupExportPlans(std::vector<std::shared_ptr<MetadataIO::CsvExportPlan> > &exportPlans) {
     Q_ASSERT(exportPlans.empty());
 
@@ -146,6 +175,13 @@ int CsvExportTest::doTest() {
 
     VERIFY(!ioCoordinator->getHasErrors(), "Errors in IO Coordinator while reading");
 
+    // separators and double quotes in values have to be escaped
+    const QString quotedTitle = QString::fromLatin1("Seagull \"on a pier\", sunset");
+    const QString quotedKeyword = QString::fromLatin1("12\" vinyl");
+    Models::ArtworkMetadata *quotedArtwork = artItemsModel->getArtwork(0);
+    quotedArtwork->setTitle(quotedTitle);
+    VERIFY(quotedArtwork->appendKeyword(quotedKeyword), "Failed to add keyword with quotes");
+
     Models::FilteredArtItemsProxyModel *filteredModel = m_CommandManager->getFilteredArtItemsModel();
     filteredModel->selectFilteredArtworks();
     filteredModel->setSelectedForCsvExport();
@@ -173,6 +209,7 @@ int CsvExportTest::doTest() {
 
     result += parsePlan1Csv(outputDir.filePath(filename1), artItemsModel->getArtworkList());
     result += parsePlan2Csv(outputDir.filePath(filename2), artItemsModel->getArtworkList());
+    result += parseQuotedValuesCsv(outputDir.filePath(filename1), quotedTitle, quotedKeyword);
 
     return result;
 }
@@ -121,6 +121,8 @@
 #include "reimporttest.h"
 #include "autoimporttest.h"
 #include "importlostmetadatatest.h"
+#include "movedfilecachetest.h"
+#include "relatedkeywordstest.h"
 
 #if defined(WITH_PLUGINS)
 #undef WITH_PLUGINS
@@ -412,6 +414,8 @@ int main(int argc, char *argv[]) {
     integrationTests.append(new ReimportTest(&commandManager));
     integrationTests.append(new AutoImportTest(&commandManager));
     integrationTests.append(new ImportLostMetadataTest(&commandManager));
+    integrationTests.append(new MovedFileCacheTest(&commandManager));
+    integrationTests.append(new RelatedKeywordsTest(&commandManager));
     // always the last one. insert new tests above
     integrationTests.append(new LocalLibrarySearchTest(&commandManager));
 
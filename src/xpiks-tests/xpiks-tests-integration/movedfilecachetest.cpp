@@ -0,0 +1,93 @@
+#include "movedfilecachetest.h"
+#include <QUrl>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QStringList>
+#include <QDebug>
+#include <memory>
+#include "integrationtestbase.h"
+#include "../../xpiks-qt/Commands/commandmanager.h"
+#include "../../xpiks-qt/Models/settingsmodel.h"
+#include "../../xpiks-qt/Models/imageartwork.h"
+#include "../../xpiks-qt/MetadataIO/metadataioservice.h"
+#include "../../xpiks-qt/MetadataIO/metadataioworker.h"
+#include "../../xpiks-qt/MetadataIO/metadatacache.h"
+#include "../../xpiks-qt/MetadataIO/cachedartwork.h"
+
+QString MovedFileCacheTest::testName() {
+    return QLatin1String("MovedFileCacheTest");
+}
+
+void MovedFileCacheTest::setup() {
+    Models::SettingsModel *settingsModel = m_CommandManager->getSettingsModel();
+    settingsModel->setAutoFindVectors(false);
+}
+
+static bool readFromCache(MetadataIO::MetadataCache &cache, const QString &filepath, MetadataIO::CachedArtwork &cachedArtwork) {
+    Models::ImageArtwork fakeArtwork(filepath, 12345, 0);
+    bool found = cache.read(&fakeArtwork, cachedArtwork);
+    fakeArtwork.release();
+    return found;
+}
+
+int MovedFileCacheTest::doTest() {
+    QTemporaryDir tempDir;
+    VERIFY(tempDir.isValid(), "Failed to create temporary directory");
+
+    const QString sourcePath = getFilePathForTest("images-for-tests/read-only/Nokota_Horses.jpg").toLocalFile();
+    const QString originalPath = QDir(tempDir.path()).filePath("original.jpg");
+    const QString movedPath = QDir(tempDir.path()).filePath("moved.jpg");
+    VERIFY(QFile::copy(sourcePath, originalPath), "Failed to copy image for test");
+
+    std::shared_ptr<Models::ImageArtwork> artwork(
+                new Models::ImageArtwork(originalPath, 12345, 0),
+                [](Models::ImageArtwork *item) {
+        if (item->release()) {
+            delete item;
+        } else {
+            // leak artwork to overcome assert for hold
+        }
+    });
+
+    const QStringList keywordsToCheck = QStringList() << "moved" << "file" << "keywords";
+    artwork->setKeywords(keywordsToCheck);
+
+    MetadataIO::MetadataIOService *metadataIOService = m_CommandManager->getMetadataIOService();
+    MetadataIO::MetadataCache &cache = metadataIOService->getWorker()->getMetadataCache();
+    metadataIOService->writeArtwork(artwork.get());
+
+    // wait for metadata cache timer
+    sleepWaitUntil(10, [&]() {
+        MetadataIO::CachedArtwork cachedArtwork;
+        return readFromCache(cache, originalPath, cachedArtwork) && (cachedArtwork.m_Keywords == keywordsToCheck);
+    });
+
+    {
+        MetadataIO::CachedArtwork cachedArtwork;
+        VERIFY(readFromCache(cache, originalPath, cachedArtwork), "Artwork has not been saved to cache");
+        VERIFY(!cachedArtwork.m_Fingerprint.isEmpty(), "Fingerprint has not been saved to cache");
+    }
+
+    VERIFY(QFile::rename(originalPath, movedPath), "Failed to move image");
+
+    {
+        MetadataIO::CachedArtwork cachedArtwork;
+        VERIFY(readFromCache(cache, movedPath, cachedArtwork), "Moved artwork was not found in cache");
+        VERIFY(cachedArtwork.m_Keywords == keywordsToCheck, "Keywords of moved artwork do not match");
+        VERIFY(cachedArtwork.m_Filepath == movedPath, "Filepath of moved artwork was not updated");
+    }
+
+    {
+        QFile file(movedPath);
+        VERIFY(file.open(QIODevice::Append), "Failed to open moved image");
+        file.write("modified");
+        file.close();
+    }
+
+    {
+        MetadataIO::CachedArtwork cachedArtwork;
+        VERIFY(!readFromCache(cache, movedPath, cachedArtwork), "Outdated metadata was read from cache");
+    }
+
+    return 0;
+}
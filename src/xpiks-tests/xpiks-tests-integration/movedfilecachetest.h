@@ -0,0 +1,20 @@
+#ifndef MOVEDFILECACHETEST_H
+#define MOVEDFILECACHETEST_H
+
+#include "integrationtestbase.h"
+
+class MovedFileCacheTest : public IntegrationTestBase
+{
+public:
+    MovedFileCacheTest(Commands::CommandManager *commandManager):
+        IntegrationTestBase(commandManager)
+    {}
+
+    // IntegrationTestBase interface
+public:
+    virtual QString testName();
+    virtual void setup();
+    virtual int doTest();
+};
+
+#endif // MOVEDFILECACHETEST_H
@@ -0,0 +1,75 @@
+#include "relatedkeywordstest.h"
+#include <QStringList>
+#include <QVector>
+#include <QPair>
+#include <memory>
+#include <vector>
+#include "integrationtestbase.h"
+#include "../../xpiks-qt/Commands/commandmanager.h"
+#include "../../xpiks-qt/Models/settingsmodel.h"
+#include "../../xpiks-qt/Models/imageartwork.h"
+#include "../../xpiks-qt/MetadataIO/metadataioservice.h"
+#include "../../xpiks-qt/MetadataIO/metadataioworker.h"
+#include "../../xpiks-qt/MetadataIO/metadatacache.h"
+
+QString RelatedKeywordsTest::testName() {
+    return QLatin1String("RelatedKeywordsTest");
+}
+
+void RelatedKeywordsTest::setup() {
+    Models::SettingsModel *settingsModel = m_CommandManager->getSettingsModel();
+    settingsModel->setAutoFindVectors(false);
+}
+
+int RelatedKeywordsTest::doTest() {
+    const QStringList keywordsLists[] = {
+        QStringList() << "relatedsea" << "relatedbeach" << "relatedsand",
+        QStringList() << "relatedsea" << "relatedbeach" << "relatedwave",
+        QStringList() << "relatedsea" << "relatedboat"
+    };
+
+    std::vector<std::shared_ptr<Models::ImageArtwork> > artworks;
+    MetadataIO::MetadataIOService *metadataIOService = m_CommandManager->getMetadataIOService();
+
+    int i = 0;
+    for (auto &keywords: keywordsLists) {
+        artworks.emplace_back(
+                    new Models::ImageArtwork(QString("/not/existing/related_%1.jpg").arg(i), 1000 + i, 0),
+                    [](Models::ImageArtwork *item) {
+            if (item->release()) {
+                delete item;
+            } else {
+                // leak artwork to overcome assert for hold
+            }
+        });
+
+        artworks.back()->setKeywords(keywords);
+        metadataIOService->writeArtwork(artworks.back().get());
+        i++;
+    }
+
+    MetadataIO::MetadataCache &cache = metadataIOService->getWorker()->getMetadataCache();
+    QVector<QPair<QString, int> > suggestions;
+
+    // wait for metadata cache timer
+    sleepWaitUntil(10, [&]() {
+        suggestions.clear();
+        cache.suggestKeywords(QStringList() << "relatedsea", 10, suggestions);
+        return suggestions.size() == 4;
+    });
+
+    VERIFY(suggestions.size() == 4, "Related keywords were not indexed");
+    VERIFY(suggestions[0].first == "relatedbeach", "Most frequent related keyword is not the first");
+    VERIFY(suggestions[0].second == 2, "Wrong count of the most frequent related keyword");
+
+    for (auto &suggestion: suggestions) {
+        VERIFY(suggestion.first != "relatedsea", "Existing keyword was suggested");
+    }
+
+    suggestions.clear();
+    cache.suggestKeywords(QStringList() << "relatedbeach" << "relatedwave", 10, suggestions);
+    VERIFY(!suggestions.isEmpty(), "Nothing was suggested for two keywords");
+    VERIFY(suggestions[0].first == "relatedsea", "Keyword related to both was not the first");
+
+    return 0;
+}
@@ -0,0 +1,20 @@
+#ifndef RELATEDKEYWORDSTEST_H
+#define RELATEDKEYWORDSTEST_H
+
+#include "integrationtestbase.h"
+
+class RelatedKeywordsTest : public IntegrationTestBase
+{
+public:
+    RelatedKeywordsTest(Commands::CommandManager *commandManager):
+        IntegrationTestBase(commandManager)
+    {}
+
+    // IntegrationTestBase interface
+public:
+    virtual QString testName();
+    virtual void setup();
+    virtual int doTest();
+};
+
+#endif // RELATEDKEYWORDSTEST_H
@@ -29,7 +29,13 @@ int UndoAddDirectoryTest::doTest() {
     QList<QUrl> dirs;
     dirs << dir;
 
-    const int artworksCount = artItemsModel->addLocalDirectories(dirs);
+    SignalWaiter addedWaiter;
+    QObject::connect(artItemsModel, SIGNAL(artworksAdded(int,int,int)), &addedWaiter, SIGNAL(finished()));
+
+    artItemsModel->addLocalDirectories(dirs);
+    VERIFY(addedWaiter.wait(20), "Timeout exceeded for adding directory.");
+
+    const int artworksCount = artItemsModel->getArtworksCount();
     ioCoordinator->continueReading(true);
 
     VERIFY(waiter.wait(20), "Timeout exceeded for reading metadata.");
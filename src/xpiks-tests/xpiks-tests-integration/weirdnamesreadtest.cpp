@@ -31,7 +31,13 @@ int WeirdNamesReadTest::doTest() {
     SignalWaiter waiter;
     QObject::connect(ioCoordinator, SIGNAL(metadataReadingFinished()), &waiter, SIGNAL(finished()));
 
-    int addedCount = artItemsModel->addLocalDirectories(directories);
+    SignalWaiter addedWaiter;
+    QObject::connect(artItemsModel, SIGNAL(artworksAdded(int,int,int)), &addedWaiter, SIGNAL(finished()));
+
+    artItemsModel->addLocalDirectories(directories);
+    VERIFY(addedWaiter.wait(20), "Timeout exceeded for adding directory.");
+
+    int addedCount = artItemsModel->getArtworksCount();
     VERIFY(addedCount == FILES_IN_WEIRD_DIRECTORY, "Failed to add directory");
     ioCoordinator->continueReading(true);
 
@@ -228,7 +228,21 @@ SOURCES += main.cpp \
     ../../xpiks-qt/Maintenance/xpkscleanupjob.cpp \
     ../../xpiks-qt/Common/baseentity.cpp \
     ../../xpiks-qt/Commands/maindelegator.cpp \
-    importlostmetadatatest.cpp
+    importlostmetadatatest.cpp \
+    movedfilecachetest.cpp \
+    relatedkeywordstest.cpp \
+    ../../xpiks-qt/Helpers/startuptimeline.cpp \
+    ../../xpiks-qt/Helpers/tracing.cpp \
+    ../../xpiks-qt/Helpers/directorywatcher.cpp \
+    ../../xpiks-qt/MetadataIO/librarysearchworker.cpp \
+    ../../xpiks-qt/MetadataIO/keywordscooccurrenceindex.cpp \
+    ../../xpiks-qt/Suggestion/relatedkeywordsqueryengine.cpp \
+    ../../xpiks-qt/Common/workstealingexecutor.cpp \
+    ../../xpiks-qt/Helpers/metrics.cpp \
+    ../../xpiks-qt/AutoComplete/wordlistindex.cpp \
+    ../../xpiks-qt/AutoComplete/keywordsfrequencytrie.cpp \
+    ../../xpiks-qt/AutoComplete/keywordscompletionengine.cpp \
+    ../../xpiks-qt/KeywordsPresets/presetsnameindex.cpp
 
 RESOURCES +=
 
@@ -494,7 +508,23 @@ HEADERS += \
     ../../xpiks-qt/Commands/maindelegator.h \
     ../../xpiks-qt/KeywordsPresets/groupmodel.h \
     ../../xpiks-qt/KeywordsPresets/presetmodel.h \
-    importlostmetadatatest.h
+    importlostmetadatatest.h \
+    movedfilecachetest.h \
+    relatedkeywordstest.h \
+    ../../xpiks-qt/Helpers/startuptimeline.h \
+    ../../xpiks-qt/Helpers/tracing.h \
+    ../../xpiks-qt/Helpers/directorywatcher.h \
+    ../../xpiks-qt/MetadataIO/librarysearchworker.h \
+    ../../xpiks-qt/MetadataIO/keywordscooccurrenceindex.h \
+    ../../xpiks-qt/Suggestion/relatedkeywordsquery.h \
+    ../../xpiks-qt/Suggestion/relatedkeywordsqueryengine.h \
+    ../../xpiks-qt/Common/workstealingexecutor.h \
+    ../../xpiks-qt/Common/mpscqueue.h \
+    ../../xpiks-qt/Helpers/metrics.h \
+    ../../xpiks-qt/AutoComplete/wordlistindex.h \
+    ../../xpiks-qt/AutoComplete/keywordsfrequencytrie.h \
+    ../../xpiks-qt/AutoComplete/keywordscompletionengine.h \
+    ../../xpiks-qt/KeywordsPresets/presetsnameindex.h
 
 INCLUDEPATH += ../../../vendors/tiny-aes
 INCLUDEPATH += ../../../vendors/cpp-libface
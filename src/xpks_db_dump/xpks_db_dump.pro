@@ -38,7 +38,10 @@ SOURCES += main.cpp \
     ../xpiks-qt/SpellCheck/spellcheckerrorshighlighter.cpp \
     ../xpiks-qt/Helpers/indiceshelper.cpp \
     ../xpiks-qt/Helpers/keywordshelpers.cpp \
-    ../xpiks-qt/QMLExtensions/colorsmodel.cpp
+    ../xpiks-qt/QMLExtensions/colorsmodel.cpp \
+    ../xpiks-qt/Helpers/tracing.cpp \
+    ../xpiks-qt/MetadataIO/keywordscooccurrenceindex.cpp \
+    ../xpiks-qt/AutoComplete/keywordsfrequencytrie.cpp
 
 HEADERS += \
     ../xpiks-qt/Helpers/database.h \
@@ -69,4 +72,7 @@ HEADERS += \
     ../xpiks-qt/Helpers/indiceshelper.h \
     ../xpiks-qt/Helpers/keywordshelpers.h \
     ../xpiks-qt/QMLExtensions/colorsmodel.h \
-    ../xpiks-qt/Helpers/constants.h
+    ../xpiks-qt/Helpers/constants.h \
+    ../xpiks-qt/Helpers/tracing.h \
+    ../xpiks-qt/MetadataIO/keywordscooccurrenceindex.h \
+    ../xpiks-qt/AutoComplete/keywordsfrequencytrie.h
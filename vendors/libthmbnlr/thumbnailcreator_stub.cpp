@@ -2,10 +2,15 @@
 
 
 namespace libthmbnlr {
-    ThumbnailCreator::ThumbnailCreator(const STD_STRING_TYPE &videoPath) {}
+    ThumbnailCreator::ThumbnailCreator(const STD_STRING_TYPE &videoPath):
+        m_FilePath(videoPath),
+        m_SeekPercentage(50),
+        m_CreationOption(Quick)
+    {}
 
     bool ThumbnailCreator::createThumbnail(std::vector<uint8_t> &rgbBuffer, int &width, int &height) {
 	    width = 0;
 	    height = 0;
+	    return false;
     }
 }